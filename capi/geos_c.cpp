@@ -281,6 +281,12 @@ extern "C" {
         return GEOSDistanceIndexed_r(handle, g1, g2, dist);
     }
 
+    char
+    GEOSDistanceWithin(const Geometry* g1, const Geometry* g2, double dist)
+    {
+        return GEOSDistanceWithin_r(handle, g1, g2, dist);
+    }
+
     int
     GEOSHausdorffDistance(const Geometry* g1, const Geometry* g2, double* dist)
     {
@@ -505,6 +511,12 @@ extern "C" {
         return GEOSUnaryUnion_r(handle, g);
     }
 
+    Geometry*
+    GEOSUnaryUnionThreaded(const Geometry* g, unsigned int numThreads)
+    {
+        return GEOSUnaryUnionThreaded_r(handle, g, numThreads);
+    }
+
     Geometry*
     GEOSNode(const Geometry* g)
     {
@@ -1204,6 +1216,31 @@ extern "C" {
         return GEOSPreparedWithin_r(handle, pg1, g2);
     }
 
+    char
+    GEOSPreparedRelatePattern(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2,
+                              const char* pat)
+    {
+        return GEOSPreparedRelatePattern_r(handle, pg1, g2, pat);
+    }
+
+    int
+    GEOSPreparedDistance(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2, double* dist)
+    {
+        return GEOSPreparedDistance_r(handle, pg1, g2, dist);
+    }
+
+    CoordinateSequence*
+    GEOSPreparedNearestPoints(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2)
+    {
+        return GEOSPreparedNearestPoints_r(handle, pg1, g2);
+    }
+
+    char
+    GEOSPreparedDistanceWithin(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2, double dist)
+    {
+        return GEOSPreparedDistanceWithin_r(handle, pg1, g2, dist);
+    }
+
     STRtree*
     GEOSSTRtree_create(size_t nodeCapacity)
     {
@@ -1227,6 +1264,18 @@ extern "C" {
         GEOSSTRtree_query_r(handle, tree, g, cb, userdata);
     }
 
+    int
+    GEOSSTRtree_queryBatch(geos::index::strtree::STRtree* tree,
+                           const double* envelopes,
+                           size_t numEnvelopes,
+                           unsigned int numThreads,
+                           size_t** offsets,
+                           void*** items)
+    {
+        return GEOSSTRtree_queryBatch_r(handle, tree, envelopes, numEnvelopes,
+                                        numThreads, offsets, items);
+    }
+
     const GEOSGeometry*
     GEOSSTRtree_nearest(geos::index::strtree::STRtree* tree,
                         const geos::geom::Geometry* g)
@@ -66,6 +66,7 @@
 #include <geos/operation/relate/RelateOp.h>
 #include <geos/operation/sharedpaths/SharedPathsOp.h>
 #include <geos/operation/union/CascadedPolygonUnion.h>
+#include <geos/operation/union/UnaryUnionOp.h>
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/precision/GeometryPrecisionReducer.h>
 #include <geos/linearref/LengthIndexedLine.h>
@@ -75,8 +76,10 @@
 #include <geos/util/Interrupt.h>
 #include <geos/util/UniqueCoordinateArrayFilter.h>
 #include <geos/util/Machine.h>
+#include <geos/util/ParallelChunks.h>
 #include <geos/version.h>
 
+#include <algorithm>
 // This should go away
 #include <cmath> // finite
 #include <cstdarg>
@@ -89,6 +92,7 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4099)
@@ -1104,6 +1108,33 @@ extern "C" {
         return 0;
     }
 
+    char
+    GEOSDistanceWithin_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double dist)
+    {
+        if(0 == extHandle) {
+            return 2;
+        }
+
+        GEOSContextHandleInternal_t* handle = 0;
+        handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return 2;
+        }
+
+        try {
+            bool result = g1->isWithinDistance(g2, dist);
+            return result;
+        }
+        catch(const std::exception& e) {
+            handle->ERROR_MESSAGE("%s", e.what());
+        }
+        catch(...) {
+            handle->ERROR_MESSAGE("Unknown exception thrown");
+        }
+
+        return 2;
+    }
+
     int
     GEOSHausdorffDistance_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double* dist)
     {
@@ -1425,12 +1456,8 @@ extern "C" {
 
         using geos::io::WKBReader;
         try {
-            std::string wkbstring(reinterpret_cast<const char*>(wkb), size); // make it binary !
             WKBReader r(*(static_cast<GeometryFactory const*>(handle->geomFactory)));
-            std::istringstream is(std::ios_base::binary);
-            is.str(wkbstring);
-            is.seekg(0, std::ios::beg); // rewind reader pointer
-            Geometry* g = r.read(is);
+            Geometry* g = r.read(wkb, size);
             return g;
         }
         catch(const std::exception& e) {
@@ -2177,6 +2204,36 @@ extern "C" {
         return NULL;
     }
 
+    Geometry*
+    GEOSUnaryUnionThreaded_r(GEOSContextHandle_t extHandle, const Geometry* g,
+                             unsigned int numThreads)
+    {
+        if(0 == extHandle) {
+            return NULL;
+        }
+
+        GEOSContextHandleInternal_t* handle = 0;
+        handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return NULL;
+        }
+
+        try {
+            geos::operation::geounion::UnaryUnionOp op(*g);
+            op.setNumThreads(numThreads);
+            GeomPtr g3(op.Union());
+            return g3.release();
+        }
+        catch(const std::exception& e) {
+            handle->ERROR_MESSAGE("%s", e.what());
+        }
+        catch(...) {
+            handle->ERROR_MESSAGE("Unknown exception thrown");
+        }
+
+        return NULL;
+    }
+
     Geometry*
     GEOSNode_r(GEOSContextHandle_t extHandle, const Geometry* g)
     {
@@ -4780,13 +4837,6 @@ extern "C" {
         }
     }
 
-    struct membuf : public std::streambuf {
-        membuf(char* s, std::size_t n)
-        {
-            setg(s, s, s + n);
-        }
-    };
-
     Geometry*
     GEOSWKBReader_read_r(GEOSContextHandle_t extHandle, WKBReader* reader, const unsigned char* wkb, size_t size)
     {
@@ -4804,16 +4854,7 @@ extern "C" {
         }
 
         try {
-            //std::string wkbstring(reinterpret_cast<const char*>(wkb), size); // make it binary !
-            //std::istringstream is(std::ios_base::binary);
-            //is.str(wkbstring);
-            //is.seekg(0, std::ios::beg); // rewind reader pointer
-
-            // http://stackoverflow.com/questions/2079912/simpler-way-to-create-a-c-memorystream-from-char-size-t-without-copying-t
-            membuf mb((char*)wkb, size);
-            istream is(&mb);
-
-            Geometry* g = reader->read(is);
+            Geometry* g = reader->read(wkb, size);
             return g;
         }
         catch(const std::exception& e) {
@@ -5527,6 +5568,136 @@ extern "C" {
         return 2;
     }
 
+    char
+    GEOSPreparedRelatePattern_r(GEOSContextHandle_t extHandle,
+                                const geos::geom::prep::PreparedGeometry* pg, const Geometry* g,
+                                const char* pat)
+    {
+        assert(0 != pg);
+        assert(0 != g);
+        assert(0 != pat);
+
+        if(0 == extHandle) {
+            return 2;
+        }
+
+        GEOSContextHandleInternal_t* handle = 0;
+        handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return 2;
+        }
+
+        try {
+            std::string s(pat);
+            bool result = pg->relate(g, s);
+            return result;
+        }
+        catch(const std::exception& e) {
+            handle->ERROR_MESSAGE("%s", e.what());
+        }
+        catch(...) {
+            handle->ERROR_MESSAGE("Unknown exception thrown");
+        }
+
+        return 2;
+    }
+
+    int
+    GEOSPreparedDistance_r(GEOSContextHandle_t extHandle,
+                           const geos::geom::prep::PreparedGeometry* pg,
+                           const Geometry* g, double* dist)
+    {
+        assert(0 != pg);
+        assert(0 != g);
+        assert(0 != dist);
+
+        if(0 == extHandle) {
+            return 0;
+        }
+
+        GEOSContextHandleInternal_t* handle = 0;
+        handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return 0;
+        }
+
+        try {
+            *dist = pg->distance(g);
+            return 1;
+        }
+        catch(const std::exception& e) {
+            handle->ERROR_MESSAGE("%s", e.what());
+        }
+        catch(...) {
+            handle->ERROR_MESSAGE("Unknown exception thrown");
+        }
+
+        return 0;
+    }
+
+    CoordinateSequence*
+    GEOSPreparedNearestPoints_r(GEOSContextHandle_t extHandle,
+                                const geos::geom::prep::PreparedGeometry* pg,
+                                const Geometry* g)
+    {
+        assert(0 != pg);
+        assert(0 != g);
+
+        if(0 == extHandle) {
+            return NULL;
+        }
+
+        GEOSContextHandleInternal_t* handle = 0;
+        handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return NULL;
+        }
+
+        try {
+            return pg->nearestPoints(g).release();
+        }
+        catch(const std::exception& e) {
+            handle->ERROR_MESSAGE("%s", e.what());
+        }
+        catch(...) {
+            handle->ERROR_MESSAGE("Unknown exception thrown");
+        }
+
+        return NULL;
+    }
+
+    char
+    GEOSPreparedDistanceWithin_r(GEOSContextHandle_t extHandle,
+                                 const geos::geom::prep::PreparedGeometry* pg,
+                                 const Geometry* g, double dist)
+    {
+        assert(0 != pg);
+        assert(0 != g);
+
+        if(0 == extHandle) {
+            return 2;
+        }
+
+        GEOSContextHandleInternal_t* handle = 0;
+        handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return 2;
+        }
+
+        try {
+            bool result = pg->isWithinDistance(g, dist);
+            return result;
+        }
+        catch(const std::exception& e) {
+            handle->ERROR_MESSAGE("%s", e.what());
+        }
+        catch(...) {
+            handle->ERROR_MESSAGE("Unknown exception thrown");
+        }
+
+        return 2;
+    }
+
 //-----------------------------------------------------------------
 // STRtree
 //-----------------------------------------------------------------
@@ -5641,6 +5812,91 @@ extern "C" {
         }
     }
 
+    int
+    GEOSSTRtree_queryBatch_r(GEOSContextHandle_t extHandle,
+                             geos::index::strtree::STRtree* tree,
+                             const double* envelopes,
+                             size_t numEnvelopes,
+                             unsigned int numThreads,
+                             size_t** offsets,
+                             void*** items)
+    {
+        assert(tree != 0);
+        assert(offsets != 0);
+        assert(items != 0);
+
+        if(0 == extHandle) {
+            return 0;
+        }
+
+        GEOSContextHandleInternal_t* handle = 0;
+        handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+        if(0 == handle->initialized) {
+            return 0;
+        }
+
+        try {
+            // Building is the only part of a query which modifies the
+            // tree, so do it before the work is shared between threads
+            tree->build();
+
+            // Each chunk of consecutive queries is answered into its own
+            // buffer, and the buffers are then concatenated in order
+            const size_t chunkSize = 256;
+            size_t nChunks = (numEnvelopes + chunkSize - 1) / chunkSize;
+            std::vector<std::vector<void*>> chunkItems(nChunks);
+            std::vector<size_t> counts(numEnvelopes);
+
+            geos::util::runChunks(nChunks,
+                                  geos::util::normalizeThreadCount(numThreads), 0,
+            [&](size_t chunk, int /*noWorker*/) {
+                std::vector<void*>& found = chunkItems[chunk];
+                size_t end = std::min(numEnvelopes, (chunk + 1) * chunkSize);
+                for(size_t i = chunk * chunkSize; i < end; i++) {
+                    const double* e = envelopes + 4 * i;
+                    geos::geom::Envelope env(e[0], e[2], e[1], e[3]);
+                    size_t before = found.size();
+                    tree->query(&env, found);
+                    counts[i] = found.size() - before;
+                }
+            });
+
+            size_t* resultOffsets = static_cast<size_t*>(
+                                        malloc(sizeof(size_t) * (numEnvelopes + 1)));
+            if(0 == resultOffsets) {
+                throw std::runtime_error("Failed to allocate memory for query results");
+            }
+            resultOffsets[0] = 0;
+            for(size_t i = 0; i < numEnvelopes; i++) {
+                resultOffsets[i + 1] = resultOffsets[i] + counts[i];
+            }
+
+            size_t numItems = resultOffsets[numEnvelopes];
+            void** resultItems = static_cast<void**>(
+                                     malloc(sizeof(void*) * std::max<size_t>(numItems, 1)));
+            if(0 == resultItems) {
+                free(resultOffsets);
+                throw std::runtime_error("Failed to allocate memory for query results");
+            }
+            void** out = resultItems;
+            for(const auto& chunk : chunkItems) {
+                out = std::copy(chunk.begin(), chunk.end(), out);
+            }
+
+            *offsets = resultOffsets;
+            *items = resultItems;
+            return 1;
+        }
+        catch(const std::exception& e) {
+            handle->ERROR_MESSAGE("%s", e.what());
+        }
+        catch(...) {
+            handle->ERROR_MESSAGE("Unknown exception thrown");
+        }
+
+        return 0;
+    }
+
     const GEOSGeometry*
     GEOSSTRtree_nearest_r(GEOSContextHandle_t extHandle,
                           geos::index::strtree::STRtree* tree,
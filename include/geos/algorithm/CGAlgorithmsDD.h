@@ -19,14 +19,6 @@
 #ifndef GEOS_ALGORITHM_CGALGORITHMDD_H
 #define GEOS_ALGORITHM_CGALGORITHMDD_H
 #include <geos/export.h>
-#include <geos/algorithm/ttmath/ttmath.h>
-
-// Close to DoubleDouble equivalent used by JTS
-// Usage: ttmath::Big<exponent, mantissa>
-typedef ttmath::Big<TTMATH_BITS(32), TTMATH_BITS(128)> DD;
-//typedef ttmath::Big<TTMATH_BITS(64), TTMATH_BITS(128)> DD;
-//typedef ttmath::Big<TTMATH_BITS(32), TTMATH_BITS(256)> DD;
-//typedef ttmath::Big<TTMATH_BITS(64), TTMATH_BITS(256)> DD;
 
 // Forward declarations
 namespace geos {
@@ -116,11 +108,6 @@ public:
 
     static int signOfDet2x2(double dx1, double dy1, double dx2, double dy2);
 
-
-protected:
-
-    static int signOfDet2x2(DD& x1, DD& y1, DD& x2, DD& y2);
-
 };
 
 } // namespace geos::algorithm
@@ -21,7 +21,6 @@
 #define GEOS_ALGORITHM_RAYCROSSINGCOUNTERDD_H
 
 #include <geos/export.h>
-#include <geos/algorithm/ttmath/ttmath.h>
 
 #include <vector>
 
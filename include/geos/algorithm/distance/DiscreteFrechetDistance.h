@@ -102,6 +102,12 @@ namespace distance { // geos::algorithm::distance
  *   DFD(A, B)  = 200
  *   DFD(A, B') = 282.842712474619
  * </pre>
+ *
+ * The couplings are computed row by row along the longer sequence of
+ * points, keeping two rows of the shorter one, so that the memory used
+ * is linear in the number of points of the shorter geometry. The
+ * couplings can be restricted to a band around the diagonal, and the
+ * computation abandoned as soon as a threshold distance is exceeded.
  */
 class GEOS_DLL DiscreteFrechetDistance {
 public:
@@ -112,13 +118,33 @@ public:
     static double distance(const geom::Geometry& g0,
                            const geom::Geometry& g1, double densifyFrac);
 
+    /**
+     * Tests whether the discrete Frechet distance of two geometries
+     * is at most a given distance.
+     *
+     * The computation is abandoned at the first row of couplings
+     * which are all further apart than the distance.
+     *
+     * @param g0 a geometry
+     * @param g1 another geometry
+     * @param maxDistance the distance to test
+     * @return true if the distance is at most maxDistance
+     */
+    static bool isWithinDistance(const geom::Geometry& g0,
+                                 const geom::Geometry& g1, double maxDistance);
+
+    static bool isWithinDistance(const geom::Geometry& g0,
+                                 const geom::Geometry& g1, double maxDistance,
+                                 double densifyFrac);
+
     DiscreteFrechetDistance(const geom::Geometry& p_g0,
                             const geom::Geometry& p_g1)
         :
         g0(p_g0),
         g1(p_g1),
         ptDist(),
-        densifyFrac(0.0)
+        densifyFrac(0.0),
+        bandFrac(0.0)
     {}
 
     /**
@@ -140,13 +166,49 @@ public:
         densifyFrac = dFrac;
     }
 
+    /**
+     * Sets the width of the band around the diagonal to which the
+     * couplings are restricted (a Sakoe-Chiba band).
+     *
+     * A point of one sequence is only coupled with the points of the
+     * other one whose relative positions along their sequences differ
+     * from its own by at most the fraction of the shorter sequence.
+     * The distance computed is then at least the unrestricted one,
+     * in time proportional to the fraction.
+     *
+     * @param bFrac
+     */
+    void
+    setBandFraction(double bFrac)
+    {
+        if(bFrac > 1.0 || bFrac <= 0.0) {
+            throw util::IllegalArgumentException(
+                "Fraction is not in range (0.0 - 1.0]");
+        }
+
+        bandFrac = bFrac;
+    }
+
     double
     distance()
     {
-        compute(g0, g1);
+        compute(g0, g1, DoubleInfinity);
         return ptDist.getDistance();
     }
 
+    /**
+     * Tests whether the discrete Frechet distance is at most a
+     * given distance.
+     *
+     * @param maxDistance the distance to test
+     * @return true if the distance is at most maxDistance
+     */
+    bool
+    isWithinDistance(double maxDistance)
+    {
+        return compute(g0, g1, maxDistance);
+    }
+
     const std::vector<geom::Coordinate>
     getCoordinates() const
     {
@@ -156,10 +218,17 @@ public:
 private:
     geom::Coordinate getSegementAt(const geom::CoordinateSequence& seq, size_t index);
 
-    PointPairDistance& getFrecheDistance(std::vector< std::vector<PointPairDistance> >& ca, size_t i, size_t j,
-                                         const geom::CoordinateSequence& p, const geom::CoordinateSequence& q);
+    /// Number of discrete points of a sequence
+    std::size_t getNumDiscretePoints(const geom::CoordinateSequence& seq) const;
 
-    void compute(const geom::Geometry& discreteGeom, const geom::Geometry& geom);
+    /**
+     * Computes the couplings, abandoning them at the first row
+     * further apart than maxDistance.
+     *
+     * @return false if abandoned, true if ptDist was set
+     */
+    bool compute(const geom::Geometry& discreteGeom, const geom::Geometry& geom,
+                 double maxDistance);
 
     const geom::Geometry& g0;
 
@@ -170,6 +239,9 @@ private:
     /// Value of 0.0 indicates that no densification should take place
     double densifyFrac; // = 0.0;
 
+    /// Value of 0.0 indicates that the couplings are not restricted
+    double bandFrac; // = 0.0;
+
     // Declare type as noncopyable
     DiscreteFrechetDistance(const DiscreteFrechetDistance& other) = delete;
     DiscreteFrechetDistance& operator=(const DiscreteFrechetDistance& rhs) = delete;
@@ -96,16 +96,47 @@ namespace distance { // geos::algorithm::distance
  *   DHD(A, B) = 22.360679774997898
  *   HD(A, B) ~= 47.8
  * </pre>
+ *
+ * When the product of the numbers of points of the geometries
+ * exceeds INDEXED_THRESHOLD, the facets of each geometry are indexed
+ * in an STR-tree, and the discrete points of the other one which
+ * cannot raise the maximum distance found so far are skipped.
  */
 class GEOS_DLL DiscreteHausdorffDistance {
 public:
 
+    /**
+     * Product of the numbers of points of the two geometries (and of
+     * the densified subsegments) above which the distance of the
+     * points to the facets is computed through spatial indexes.
+     */
+    static const std::size_t INDEXED_THRESHOLD = 2500;
+
     static double distance(const geom::Geometry& g0,
                            const geom::Geometry& g1);
 
     static double distance(const geom::Geometry& g0,
                            const geom::Geometry& g1, double densifyFrac);
 
+    /**
+     * Tests whether the discrete Hausdorff distance of two geometries
+     * is at most a given distance.
+     *
+     * Stops at the first discrete point further than the distance
+     * from the other geometry, without computing the maximum.
+     *
+     * @param g0 a geometry
+     * @param g1 another geometry
+     * @param maxDistance the distance to test
+     * @return true if the distance is at most maxDistance
+     */
+    static bool isWithinDistance(const geom::Geometry& g0,
+                                 const geom::Geometry& g1, double maxDistance);
+
+    static bool isWithinDistance(const geom::Geometry& g0,
+                                 const geom::Geometry& g1, double maxDistance,
+                                 double densifyFrac);
+
     DiscreteHausdorffDistance(const geom::Geometry& p_g0,
                               const geom::Geometry& p_g1)
         :
@@ -141,6 +172,15 @@ public:
         return ptDist.getDistance();
     }
 
+    /**
+     * Tests whether the discrete Hausdorff distance is at most
+     * a given distance.
+     *
+     * @param maxDistance the distance to test
+     * @return true if the distance is at most maxDistance
+     */
+    bool isWithinDistance(double maxDistance);
+
     double
     orientedDistance()
     {
@@ -245,6 +285,17 @@ private:
                                  const geom::Geometry& geom,
                                  PointPairDistance& ptDist);
 
+    bool isOrientedWithinDistance(const geom::Geometry& discreteGeom,
+                                  const geom::Geometry& geom,
+                                  double maxDistance) const;
+
+    /// Number of subsegments each segment is split into
+    std::size_t getNumSubSegments() const;
+
+    /// Whether the distance of the points to the facets is indexed
+    bool isIndexed(const geom::Geometry& discreteGeom,
+                   const geom::Geometry& geom) const;
+
     const geom::Geometry& g0;
 
     const geom::Geometry& g1;
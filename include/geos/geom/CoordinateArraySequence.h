@@ -61,7 +61,8 @@ public:
     /// Construct an empty sequence
     CoordinateArraySequence();
 
-    /// Construct sequence taking ownership of given Coordinate vector
+    /// Construct sequence taking ownership of given Coordinate vector,
+    /// whose content is moved into the sequence before it is deleted
     CoordinateArraySequence(std::vector<Coordinate>* coords,
                             std::size_t dimension = 0);
 
@@ -79,14 +80,14 @@ public:
     bool
     empty() const
     {
-        return vect->empty();
+        return vect.empty();
     }
 
     /// Reset this CoordinateArraySequence to the empty state
     void
     clear()
     {
-        vect->clear();
+        vect.clear();
     }
 
     void add(const Coordinate& c) override;
@@ -131,7 +132,7 @@ public:
     CoordinateSequence& removeRepeatedPoints() override;
 
 private:
-    std::vector<Coordinate>* vect;
+    std::vector<Coordinate> vect;
     mutable std::size_t dimension;
 };
 
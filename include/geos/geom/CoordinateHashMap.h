@@ -0,0 +1,244 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_COORDINATEHASHMAP_H
+#define GEOS_GEOM_COORDINATEHASHMAP_H
+
+#include <geos/geom/Coordinate.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace geos {
+namespace geom { // geos::geom
+
+/** \brief
+ * A hash map of values keyed by the x and y ordinates of a
+ * {@link Coordinate}.
+ *
+ * Two keys are the same if their x and y ordinates are equal, as for
+ * {@link Coordinate::equals2D}; the z ordinate is ignored.
+ *
+ * Uses open addressing with linear probing over a power-of-two table
+ * kept at most half full, so that lookups and insertions take constant
+ * time on average whatever the number of keys, and touch a single
+ * contiguous block of memory.
+ *
+ * Iteration order is unspecified: containers that need their keys in
+ * order should sort them (see {@link CoordinateLessThen}).
+ */
+template<typename T>
+class CoordinateHashMap {
+
+public:
+
+    CoordinateHashMap()
+        :
+        count(0)
+    {}
+
+    /// The number of keys in the map
+    std::size_t
+    size() const
+    {
+        return count;
+    }
+
+    bool
+    empty() const
+    {
+        return count == 0;
+    }
+
+    void
+    clear()
+    {
+        slots.clear();
+        count = 0;
+    }
+
+    /// Makes room for n keys without further rehashing
+    void
+    reserve(std::size_t n)
+    {
+        std::size_t capacity = MIN_CAPACITY;
+        while(capacity < 2 * n) {
+            capacity *= 2;
+        }
+        if(capacity > slots.size()) {
+            rehash(capacity);
+        }
+    }
+
+    /// @return the value at the given location, or null if none
+    T*
+    find(const Coordinate& c)
+    {
+        if(count == 0) {
+            return nullptr;
+        }
+        Slot& slot = slots[findSlot(keyBits(c.x), keyBits(c.y))];
+        return slot.occupied ? &slot.value : nullptr;
+    }
+
+    const T*
+    find(const Coordinate& c) const
+    {
+        return const_cast<CoordinateHashMap*>(this)->find(c);
+    }
+
+    /** \brief
+     * Adds a value at the given location, unless one is already there.
+     *
+     * @return the value now at the location, and whether it is
+     *         the one given
+     */
+    std::pair<T*, bool>
+    insert(const Coordinate& c, const T& value)
+    {
+        if(2 * (count + 1) > slots.size()) {
+            rehash(slots.empty() ? std::size_t(MIN_CAPACITY) : 2 * slots.size());
+        }
+        std::uint64_t xb = keyBits(c.x);
+        std::uint64_t yb = keyBits(c.y);
+        Slot& slot = slots[findSlot(xb, yb)];
+        if(slot.occupied) {
+            return std::make_pair(&slot.value, false);
+        }
+        slot.xbits = xb;
+        slot.ybits = yb;
+        slot.value = value;
+        slot.occupied = true;
+        count++;
+        return std::make_pair(&slot.value, true);
+    }
+
+    /** \brief
+     * Removes the value at the given location, if any.
+     *
+     * @return whether a value was removed
+     */
+    bool
+    erase(const Coordinate& c)
+    {
+        if(count == 0) {
+            return false;
+        }
+        std::size_t mask = slots.size() - 1;
+        std::size_t i = findSlot(keyBits(c.x), keyBits(c.y));
+        if(!slots[i].occupied) {
+            return false;
+        }
+        slots[i].occupied = false;
+        count--;
+
+        // Shift back the following keys of the probe sequence which
+        // would no longer be reachable from their home slot
+        for(std::size_t j = (i + 1) & mask; slots[j].occupied; j = (j + 1) & mask) {
+            std::size_t home = hash(slots[j].xbits, slots[j].ybits) & mask;
+            bool reachable = (i <= j) ? (i < home && home <= j)
+                                      : (i < home || home <= j);
+            if(!reachable) {
+                slots[i] = slots[j];
+                slots[j].occupied = false;
+                i = j;
+            }
+        }
+        return true;
+    }
+
+    /// Calls f(value) for each value of the map, in unspecified order
+    template<typename F>
+    void
+    forEach(F f) const
+    {
+        for(const Slot& slot : slots) {
+            if(slot.occupied) {
+                f(slot.value);
+            }
+        }
+    }
+
+private:
+
+    static const std::size_t MIN_CAPACITY = 16;
+
+    struct Slot {
+        std::uint64_t xbits;
+        std::uint64_t ybits;
+        T value;
+        bool occupied;
+
+        Slot() : xbits(0), ybits(0), value(), occupied(false) {}
+    };
+
+    std::vector<Slot> slots;
+
+    std::size_t count;
+
+    static std::uint64_t
+    keyBits(double d)
+    {
+        // -0.0 and 0.0 are the same ordinate
+        if(d == 0.0) {
+            d = 0.0;
+        }
+        std::uint64_t bits;
+        std::memcpy(&bits, &d, sizeof(bits));
+        return bits;
+    }
+
+    static std::size_t
+    hash(std::uint64_t xbits, std::uint64_t ybits)
+    {
+        std::uint64_t h = xbits * 0x9E3779B97F4A7C15ULL ^ ybits;
+        h ^= h >> 30;
+        h *= 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 27;
+        h *= 0x94D049BB133111EBULL;
+        h ^= h >> 31;
+        return static_cast<std::size_t>(h);
+    }
+
+    /// The slot holding the key, or the empty slot where it would go
+    std::size_t
+    findSlot(std::uint64_t xbits, std::uint64_t ybits) const
+    {
+        std::size_t mask = slots.size() - 1;
+        std::size_t i = hash(xbits, ybits) & mask;
+        while(slots[i].occupied &&
+                (slots[i].xbits != xbits || slots[i].ybits != ybits)) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    void
+    rehash(std::size_t capacity)
+    {
+        std::vector<Slot> old(capacity);
+        old.swap(slots);
+        for(const Slot& slot : old) {
+            if(slot.occupied) {
+                slots[findSlot(slot.xbits, slot.ybits)] = slot;
+            }
+        }
+    }
+};
+
+} // namespace geos::geom
+} // namespace geos
+
+#endif // GEOS_GEOM_COORDINATEHASHMAP_H
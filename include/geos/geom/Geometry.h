@@ -37,6 +37,7 @@
 #include <geos/geom/Dimension.h> // for Dimension::DimensionType
 #include <geos/geom/GeometryComponentFilter.h> // for inheritance
 
+#include <atomic>
 #include <string>
 #include <iostream>
 #include <vector>
@@ -779,7 +780,9 @@ public:
      * @param geom the Geometry to check the distance to
      * @param cDistance the distance value to compare
      * @return <code>true</code> if the geometries are less than
-     *  <code>distance</code> apart.
+     *  <code>distance</code> apart, false if either is empty.
+     *
+     * @see operation::distance::DistanceOp::isWithinDistance
      *
      * @todo doesn't seem to need being virtual, make it concrete
      */
@@ -831,8 +834,21 @@ public:
 
 protected:
 
-    /// The bounding box of this Geometry
-    mutable std::unique_ptr<Envelope> envelope;
+    /// The bounding box of this Geometry, valid once envelopeState
+    /// is ENVELOPE_COMPUTED.
+    /// Held by value to spare a heap allocation per Geometry.
+    mutable Envelope envelope;
+
+    enum EnvelopeState {
+        ENVELOPE_NONE,
+        ENVELOPE_COMPUTING,
+        ENVELOPE_COMPUTED
+    };
+
+    /// Computation state of the envelope, see getEnvelopeInternal().
+    /// The envelope is published through this flag so that a Geometry
+    /// can be read from several threads at once.
+    mutable std::atomic<unsigned char> envelopeState;
 
     /// Returns true if the array contains any non-empty Geometrys.
     static bool hasNonEmptyElements(const std::vector<Geometry*>* geometries);
@@ -861,7 +877,7 @@ protected:
 
     //virtual void checkEqualPrecisionModel(Geometry *other);
 
-    virtual Envelope::Ptr computeEnvelopeInternal() const = 0; //Abstract
+    virtual Envelope computeEnvelopeInternal() const = 0; //Abstract
 
     virtual int compareToSameClass(const Geometry* geom) const = 0; //Abstract
 
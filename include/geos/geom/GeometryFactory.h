@@ -28,6 +28,7 @@
 #include <geos/export.h>
 #include <geos/inline.h>
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <cassert>
@@ -472,7 +473,9 @@ private:
     int SRID;
     const CoordinateSequenceFactory* coordinateListFactory;
 
-    mutable int _refCount;
+    // atomic, as geometries of a factory may be created and
+    // destroyed from several threads
+    mutable std::atomic<int> _refCount;
     bool _autoDestroy;
 
     friend class Geometry;
@@ -197,7 +197,7 @@ protected:
     LineString(CoordinateSequence::Ptr pts,
                const GeometryFactory* newFactory);
 
-    Envelope::Ptr computeEnvelopeInternal() const override;
+    Envelope computeEnvelopeInternal() const override;
 
     CoordinateSequence::Ptr points;
 
@@ -0,0 +1,183 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2001-2002 Vivid Solutions Inc.
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: geom/impl/PackedCoordinateSequence.java (JTS-1.14)
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_PACKEDCOORDINATESEQUENCE_H
+#define GEOS_GEOM_PACKEDCOORDINATESEQUENCE_H
+
+#include <geos/export.h>
+#include <geos/geom/CoordinateSequence.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Coordinate;
+class Envelope;
+}
+}
+
+namespace geos {
+namespace geom { // geos.geom
+
+/**
+ * \brief
+ * A CoordinateSequence storing its ordinates in a single contiguous
+ * buffer of doubles, <code>dimension</code> values per point.
+ *
+ * A two-dimensional sequence takes 16 bytes per point rather than the
+ * 24 bytes of a CoordinateArraySequence. The raw ordinate buffer is
+ * available through the non-virtual {@link data} accessor, so that
+ * kernels which know they are dealing with a packed sequence can walk
+ * it without going through the virtual Coordinate accessors.
+ *
+ * As in JTS, the reference-returning accessors ({@link getAt(std::size_t)},
+ * {@link toVector()} and {@link apply_ro}) are served from a cache of
+ * Coordinate objects, built on first use and discarded whenever the
+ * sequence is modified. The cache takes as much memory as a
+ * CoordinateArraySequence, so code walking a packed sequence should use
+ * getAt(std::size_t, Coordinate&), getX/getY or {@link data} instead.
+ * The cache is built under a mutex, so that concurrent const use of a
+ * shared sequence is safe.
+ */
+class GEOS_DLL PackedCoordinateSequence : public CoordinateSequence {
+public:
+
+    /**
+     * Creates a sequence of <code>n</code> points, all with
+     * ordinates set to 0.
+     *
+     * @param n the number of points
+     * @param dimension 2 or 3; 0 is taken as 3
+     */
+    PackedCoordinateSequence(std::size_t n = 0, std::size_t dimension = 2);
+
+    /**
+     * Creates a sequence taking ownership of the given packed ordinates.
+     *
+     * @param ordinates <code>dimension</code> values per point
+     * @param dimension 2 or 3
+     */
+    PackedCoordinateSequence(std::vector<double>&& ordinates,
+                             std::size_t dimension);
+
+    /// Creates a copy of any CoordinateSequence with the given dimension
+    PackedCoordinateSequence(const CoordinateSequence& seq,
+                             std::size_t dimension);
+
+    PackedCoordinateSequence(const PackedCoordinateSequence& seq);
+
+    ~PackedCoordinateSequence() override;
+
+    CoordinateSequence* clone() const override;
+
+    const Coordinate& getAt(std::size_t pos) const override;
+
+    void getAt(std::size_t pos, Coordinate& c) const override;
+
+    std::size_t getSize() const override;
+
+    const std::vector<Coordinate>* toVector() const override;
+
+    void toVector(std::vector<Coordinate>& coords) const override;
+
+    bool isEmpty() const override;
+
+    void add(const Coordinate& c) override;
+
+    void add(const Coordinate& c, bool allowRepeated) override;
+
+    void add(std::size_t i, const Coordinate& coord, bool allowRepeated) override;
+
+    void setAt(const Coordinate& c, std::size_t pos) override;
+
+    void deleteAt(std::size_t pos) override;
+
+    std::string toString() const override;
+
+    void setPoints(const std::vector<Coordinate>& v) override;
+
+    std::size_t getDimension() const override;
+
+    double getOrdinate(std::size_t index, std::size_t ordinateIndex) const override;
+
+    double
+    getX(std::size_t index) const override
+    {
+        return ordinates[index * dimension];
+    }
+
+    double
+    getY(std::size_t index) const override
+    {
+        return ordinates[index * dimension + 1];
+    }
+
+    void setOrdinate(std::size_t index, std::size_t ordinateIndex,
+                     double value) override;
+
+    void expandEnvelope(Envelope& env) const override;
+
+    void apply_rw(const CoordinateFilter* filter) override;
+
+    void apply_ro(CoordinateFilter* filter) const override;
+
+    CoordinateSequence& removeRepeatedPoints() override;
+
+    /**
+     * \brief
+     * Returns the packed ordinate buffer: point <code>i</code> has its
+     * X at <code>data()[i * getDimension()]</code>, followed by Y and,
+     * for three-dimensional sequences, Z.
+     *
+     * The pointer is invalidated by any operation changing the size
+     * of the sequence.
+     */
+    const double*
+    data() const
+    {
+        return ordinates.data();
+    }
+
+private:
+
+    void
+    invalidateCache()
+    {
+        delete coordCache.exchange(nullptr);
+    }
+
+    const std::vector<Coordinate>& getCoordinateCache() const;
+
+    std::vector<double> ordinates;
+
+    std::size_t dimension;
+
+    /// Published once built, so that readers only lock when it is missing
+    mutable std::atomic<std::vector<Coordinate>*> coordCache;
+
+    mutable std::mutex coordCacheMutex;
+};
+
+} // namespace geos.geom
+} // namespace geos
+
+#endif // ndef GEOS_GEOM_PACKEDCOORDINATESEQUENCE_H
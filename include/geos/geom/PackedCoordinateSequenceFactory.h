@@ -0,0 +1,81 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2001-2002 Vivid Solutions Inc.
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: geom/impl/PackedCoordinateSequenceFactory.java (JTS-1.14)
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_PACKEDCOORDINATESEQUENCEFACTORY_H
+#define GEOS_GEOM_PACKEDCOORDINATESEQUENCEFACTORY_H
+
+#include <geos/export.h>
+#include <vector>
+
+#include <geos/geom/CoordinateSequenceFactory.h> // for inheritance
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Coordinate;
+}
+}
+
+namespace geos {
+namespace geom { // geos::geom
+
+/**
+ * \brief
+ * Creates PackedCoordinateSequences of a fixed default dimension.
+ *
+ * Pass one of the instances to GeometryFactory::create to have all
+ * geometries of that factory store their coordinates packed.
+ * A dimension passed explicitly to create() takes precedence over
+ * the default one; a dimension of 0 (unknown) uses the default.
+ */
+class GEOS_DLL PackedCoordinateSequenceFactory: public CoordinateSequenceFactory {
+
+public:
+
+    PackedCoordinateSequenceFactory(std::size_t dimension = 2);
+
+    CoordinateSequence* create() const override;
+
+    /// The given vector is copied and then deleted
+    CoordinateSequence* create(std::vector<Coordinate>* coords, std::size_t dims = 0) const override;
+
+    CoordinateSequence* create(std::size_t size, std::size_t dimension = 0) const override;
+
+    CoordinateSequence* create(const CoordinateSequence& coordSeq) const override;
+
+    std::size_t
+    getDimension() const
+    {
+        return dimension;
+    }
+
+    /** \brief
+     * Returns the singleton instance creating sequences of the
+     * given dimension (2 or 3)
+     */
+    static const CoordinateSequenceFactory* instance(std::size_t dimension = 2);
+
+private:
+
+    std::size_t dimension;
+};
+
+} // namespace geos::geom
+} // namespace geos
+
+#endif // ndef GEOS_GEOM_PACKEDCOORDINATESEQUENCEFACTORY_H
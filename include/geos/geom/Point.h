@@ -160,7 +160,7 @@ protected:
 
     Point(const Point& p);
 
-    Envelope::Ptr computeEnvelopeInternal() const override;
+    Envelope computeEnvelopeInternal() const override;
 
     int compareToSameClass(const Geometry* p) const override;
 
@@ -176,7 +176,7 @@ protected:
 
     std::vector<Geometry*>* holes;  //Actually vector<LinearRing *>
 
-    Envelope::Ptr computeEnvelopeInternal() const override;
+    Envelope computeEnvelopeInternal() const override;
 
     int
     getSortIndex() const override
@@ -26,6 +26,8 @@
 #include <geos/geom/Coordinate.h>
 //#include <geos/geom/Location.h>
 
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -33,6 +35,12 @@ namespace geos {
 namespace geom {
 class Geometry;
 class Coordinate;
+class CoordinateSequence;
+}
+namespace operation {
+namespace distance {
+class IndexedFacetDistance;
+}
 }
 }
 
@@ -60,6 +68,8 @@ class BasicPreparedGeometry: public PreparedGeometry {
 private:
     const geom::Geometry* baseGeom;
     Coordinate::ConstVect representativePts;
+    mutable std::unique_ptr<operation::distance::IndexedFacetDistance> indexedDistance;
+    mutable std::once_flag indexedDistanceFlag;
 
 protected:
     /**
@@ -86,6 +96,25 @@ protected:
      */
     bool envelopeCovers(const geom::Geometry* g) const;
 
+    /**
+     * Gets the index of the facets of this geometry, building it
+     * on first use.
+     */
+    operation::distance::IndexedFacetDistance* getIndexedFacetDistance() const;
+
+    /**
+     * Tests whether a geometry whose facets are apart from the ones of
+     * this geometry is still at distance 0, which is when one of them
+     * lies inside an area of the other. The indexed facet distance
+     * only compares the facets, so its results must be checked
+     * with this.
+     *
+     * @param g a Geometry whose facets do not meet the ones of
+     *        this geometry
+     * @return true if the geometries are at distance 0
+     */
+    bool isInsideArea(const geom::Geometry* g) const;
+
 public:
     BasicPreparedGeometry(const Geometry* geom);
 
@@ -172,6 +201,32 @@ public:
      */
     bool within(const geom::Geometry* g) const override;
 
+    /**
+     * Default implementation, which only short-circuits
+     * geometries with disjoint envelopes.
+     */
+    bool relate(const geom::Geometry* g,
+                const std::string& pattern) const override;
+
+    /**
+     * Standard implementation for all geometries, testing whether
+     * the geometries intersect before searching the facet index.
+     */
+    double distance(const geom::Geometry* g) const override;
+
+    /**
+     * Standard implementation for all geometries.
+     */
+    std::unique_ptr<geom::CoordinateSequence> nearestPoints(
+        const geom::Geometry* g) const override;
+
+    /**
+     * Standard implementation for all geometries, rejecting
+     * geometries whose envelopes are too far apart first.
+     */
+    bool isWithinDistance(const geom::Geometry* g,
+                          double dist) const override;
+
     std::string toString();
 
 };
@@ -21,10 +21,14 @@
 
 #include <geos/export.h>
 
+#include <memory>
+#include <string>
+
 // Forward declarations
 namespace geos {
 namespace geom {
 class Geometry;
+class CoordinateSequence;
 }
 }
 
@@ -192,6 +196,60 @@ public:
      * @see Geometry#within(Geometry)
      */
     virtual bool within(const geom::Geometry* geom) const = 0;
+
+    /**
+     * Tests whether the {@link IntersectionMatrix} of the base
+     * {@link Geometry} and a given geometry matches a pattern.
+     *
+     * @param geom the Geometry to test
+     * @param pattern the pattern to match, as in IntersectionMatrix::matches
+     * @return true if the matrix matches the pattern
+     *
+     * @see Geometry#relate(Geometry, std::string)
+     */
+    virtual bool relate(const geom::Geometry* geom,
+                        const std::string& pattern) const = 0;
+
+    /**
+     * Computes the distance between the base {@link Geometry} and a
+     * given geometry, using an index of the facets of the base
+     * geometry built on first use.
+     *
+     * @param geom the Geometry to compute the distance to
+     * @return the distance between the geometries, 0 if either is empty
+     *
+     * @see Geometry#distance(Geometry)
+     */
+    virtual double distance(const geom::Geometry* geom) const = 0;
+
+    /**
+     * Computes the nearest points of the base {@link Geometry} and
+     * a given geometry, using an index of the facets of the base
+     * geometry built on first use.
+     *
+     * @param geom the Geometry to compute the nearest points to
+     * @return the nearest point of the base geometry, then of geom,
+     *         or null if either geometry is empty
+     *
+     * @see operation::distance::DistanceOp#nearestPoints
+     */
+    virtual std::unique_ptr<geom::CoordinateSequence> nearestPoints(
+        const geom::Geometry* geom) const = 0;
+
+    /**
+     * Tests whether the base {@link Geometry} is within a given
+     * distance of a given geometry, stopping at the first pair of
+     * facets found within the distance.
+     *
+     * @param geom the Geometry to test
+     * @param dist the distance to test
+     * @return true if the geometries are within the distance,
+     *         false if either is empty
+     *
+     * @see Geometry#isWithinDistance(Geometry, double)
+     */
+    virtual bool isWithinDistance(const geom::Geometry* geom,
+                                  double dist) const = 0;
 };
 
 
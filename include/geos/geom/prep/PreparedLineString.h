@@ -23,6 +23,8 @@
 #include <geos/geom/prep/BasicPreparedGeometry.h> // for inheritance
 #include <geos/noding/SegmentString.h>
 
+#include <mutex>
+
 namespace geos {
 namespace noding {
 class FastSegmentSetIntersectionFinder;
@@ -37,6 +39,10 @@ namespace prep { // geos::geom::prep
  * \brief
  * A prepared version of {@link LinearRing}, {@link LineString} or {@link MultiLineString} geometries.
  *
+ * The segment index is built on first use, under a std::call_once, so
+ * that a single PreparedLineString can be queried concurrently from
+ * several threads.
+ *
  * @author mbdavis
  *
  */
@@ -44,6 +50,7 @@ class PreparedLineString : public BasicPreparedGeometry {
 private:
     noding::FastSegmentSetIntersectionFinder* segIntFinder;
     mutable noding::SegmentString::ConstVect segStrings;
+    std::once_flag segIntFinderFlag;
 
 protected:
 public:
@@ -23,6 +23,8 @@
 #include <geos/geom/prep/BasicPreparedGeometry.h> // for inheritance
 #include <geos/noding/SegmentString.h>
 
+#include <mutex>
+
 namespace geos {
 namespace noding {
 class FastSegmentSetIntersectionFinder;
@@ -42,6 +44,10 @@ namespace prep { // geos::geom::prep
  * \brief
  * A prepared version of {@link Polygon} or {@link MultiPolygon} geometries.
  *
+ * The indexes are built on first use, under a std::call_once, so that
+ * a single PreparedPolygon can be queried concurrently from several
+ * threads.
+ *
  * @author mbdavis
  *
  */
@@ -51,6 +57,8 @@ private:
     mutable noding::FastSegmentSetIntersectionFinder* segIntFinder;
     mutable algorithm::locate::PointOnGeometryLocator* ptOnGeomLoc;
     mutable noding::SegmentString::ConstVect segStrings;
+    mutable std::once_flag segIntFinderFlag;
+    mutable std::once_flag ptOnGeomLocFlag;
 
 protected:
 public:
@@ -64,6 +72,10 @@ public:
     bool containsProperly(const geom::Geometry* g) const override;
     bool covers(const geom::Geometry* g) const override;
     bool intersects(const geom::Geometry* g) const override;
+    bool touches(const geom::Geometry* g) const override;
+    bool crosses(const geom::Geometry* g) const override;
+    bool overlaps(const geom::Geometry* g) const override;
+    bool relate(const geom::Geometry* g, const std::string& pattern) const override;
 
 };
 
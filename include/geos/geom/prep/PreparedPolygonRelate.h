@@ -0,0 +1,178 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_PREP_PREPAREDPOLYGONRELATE_H
+#define GEOS_GEOM_PREP_PREPAREDPOLYGONRELATE_H
+
+#include <geos/geom/prep/PreparedPolygonPredicate.h> // inherited
+
+#include <string>
+
+namespace geos {
+namespace geom {
+class Geometry;
+
+namespace prep {
+class PreparedPolygon;
+}
+}
+}
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+
+/**
+ * \brief
+ * Computes the <tt>touches</tt>, <tt>crosses</tt> and <tt>overlaps</tt>
+ * spatial relationship predicates, and matches relate patterns,
+ * for {@link PreparedPolygon}s relative to all other {@link Geometry} classes.
+ *
+ * The vertices of the test geometry are located with the indexed point
+ * locator of the prepared polygon, and its segments are intersected
+ * with the indexed segments of the polygon boundary. When these do not
+ * decide the predicate (e.g. when two polygons only touch), the full
+ * relate computation is used.
+ *
+ * The prepared polygon is assumed to be valid.
+ */
+class PreparedPolygonRelate : public PreparedPolygonPredicate {
+private:
+
+    enum VertexSearch {
+        UNTIL_INTERIOR,
+        UNTIL_INTERIOR_AND_EXTERIOR,
+        ALL_VERTICES
+    };
+
+    bool hasInteriorVertex;
+    bool hasBoundaryVertex;
+    bool hasExteriorVertex;
+
+    bool hasSegmentIntersection;
+    bool hasProperIntersection;
+
+    /**
+     * Locates the vertices of the test geometry in the polygon,
+     * setting the has*Vertex flags.
+     */
+    void locateTestVertices(const geom::Geometry* geom, VertexSearch search);
+
+    /**
+     * Intersects the segments of the test geometry with the boundary
+     * of the polygon, stopping at the first proper intersection.
+     */
+    void findSegmentIntersections(const geom::Geometry* geom);
+
+    /**
+     * Whether a proper intersection with the boundary of the polygon
+     * shows that the test geometry goes into its interior. Rings which
+     * touch each other inside a segment (a hole touching the shell, or
+     * two touching parts) make the boundary meet the exterior on both
+     * sides there, so this is only assumed for a single polygon
+     * without holes.
+     */
+    bool isProperIntersectionDecisive() const;
+
+    /// Whether the test geometry meets the boundary of the polygon
+    bool
+    isBoundaryMet() const
+    {
+        return hasSegmentIntersection || hasBoundaryVertex;
+    }
+
+public:
+
+    static bool
+    touches(const PreparedPolygon* const prep, const geom::Geometry* geom)
+    {
+        PreparedPolygonRelate polyRelate(prep);
+        return polyRelate.touches(geom);
+    }
+
+    static bool
+    crosses(const PreparedPolygon* const prep, const geom::Geometry* geom)
+    {
+        PreparedPolygonRelate polyRelate(prep);
+        return polyRelate.crosses(geom);
+    }
+
+    static bool
+    overlaps(const PreparedPolygon* const prep, const geom::Geometry* geom)
+    {
+        PreparedPolygonRelate polyRelate(prep);
+        return polyRelate.overlaps(geom);
+    }
+
+    static bool
+    relate(const PreparedPolygon* const prep, const geom::Geometry* geom,
+           const std::string& pattern)
+    {
+        PreparedPolygonRelate polyRelate(prep);
+        return polyRelate.relate(geom, pattern);
+    }
+
+    /**
+     * Creates an instance of this operation.
+     *
+     * @param prep the PreparedPolygon to evaluate
+     */
+    PreparedPolygonRelate(const PreparedPolygon* const prep)
+        :	PreparedPolygonPredicate(prep),
+          hasInteriorVertex(false),
+          hasBoundaryVertex(false),
+          hasExteriorVertex(false),
+          hasSegmentIntersection(false),
+          hasProperIntersection(false)
+    { }
+
+    /**
+     * Tests whether this PreparedPolygon touches a given geometry.
+     *
+     * @param geom the test geometry
+     * @return true if the polygon touches the test geometry
+     */
+    bool touches(const geom::Geometry* geom);
+
+    /**
+     * Tests whether this PreparedPolygon crosses a given geometry.
+     *
+     * @param geom the test geometry
+     * @return true if the polygon crosses the test geometry
+     */
+    bool crosses(const geom::Geometry* geom);
+
+    /**
+     * Tests whether this PreparedPolygon overlaps a given geometry.
+     *
+     * @param geom the test geometry
+     * @return true if the polygon overlaps the test geometry
+     */
+    bool overlaps(const geom::Geometry* geom);
+
+    /**
+     * Tests whether the IntersectionMatrix of this PreparedPolygon
+     * and a given geometry matches a pattern.
+     *
+     * @param geom the test geometry
+     * @param pattern the pattern, as in IntersectionMatrix::matches
+     * @return true if the matrix matches the pattern
+     */
+    bool relate(const geom::Geometry* geom, const std::string& pattern);
+
+};
+
+} // geos::geom::prep
+} // geos::geom
+} // geos
+
+#endif // GEOS_GEOM_PREP_PREPAREDPOLYGONRELATE_H
@@ -24,7 +24,6 @@
 
 #include <geos/export.h>
 #include <vector>
-#include <set>
 #include <string>
 
 #include <geos/geomgraph/EdgeIntersection.h> // for EdgeIntersectionLessThen
@@ -58,15 +57,24 @@ namespace geomgraph { // geos.geomgraph
  */
 class GEOS_DLL EdgeIntersectionList {
 public:
-    typedef std::set<EdgeIntersection*, EdgeIntersectionLessThen> container;
+    typedef std::vector<EdgeIntersection> container;
     typedef container::iterator iterator;
     typedef container::const_iterator const_iterator;
 
 private:
+    /// The intersections, in insertion order until prepare() sorts them
     container nodeMap;
 
+    /// Whether nodeMap is sorted and free of duplicates
+    bool sorted;
+
+    /// Throws util::IllegalStateException if the list is not prepared
+    void checkPrepared() const;
+
 public:
 
+    friend std::ostream& operator<< (std::ostream&, const EdgeIntersectionList&);
+
     Edge* edge;
     EdgeIntersectionList(Edge* edge);
     ~EdgeIntersectionList();
@@ -74,29 +82,52 @@ public:
     /*
      * Adds an intersection into the list, if it isn't already there.
      * The input segmentIndex and dist are expected to be normalized.
-     * @return the EdgeIntersection found or added
      */
-    EdgeIntersection* add(const geom::Coordinate& coord,
-                          size_t segmentIndex, double dist);
+    void add(const geom::Coordinate& coord,
+             size_t segmentIndex, double dist);
+
+    /**
+     * Sorts the intersections along the edge and removes the
+     * duplicates, keeping the first one added.
+     *
+     * Adding an intersection is a mere append, so that the sort is
+     * only paid for once, before the intersections are read. The
+     * non-const accessors call it, as does the splitting of the edge.
+     * The const ones only read, so that a list can be read from
+     * several threads, and throw util::IllegalStateException if it
+     * is not prepared.
+     */
+    void prepare();
+
+    /// Whether the intersections are sorted and free of duplicates
+    bool
+    isPrepared() const
+    {
+        return sorted;
+    }
 
     iterator
     begin()
     {
+        prepare();
         return nodeMap.begin();
     }
     iterator
     end()
     {
+        prepare();
         return nodeMap.end();
     }
     const_iterator
     begin() const
     {
+        checkPrepared();
         return nodeMap.begin();
     }
     const_iterator
     end() const
     {
+        checkPrepared();
         return nodeMap.end();
     }
 
@@ -118,7 +149,7 @@ public:
      */
     void addSplitEdges(std::vector<Edge*>* edgeList);
 
-    Edge* createSplitEdge(EdgeIntersection* ei0, EdgeIntersection* ei1);
+    Edge* createSplitEdge(const EdgeIntersection& ei0, const EdgeIntersection& ei1);
     std::string print() const;
 
 };
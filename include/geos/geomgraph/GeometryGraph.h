@@ -112,6 +112,9 @@ private:
 
     geom::Coordinate invalidPoint;
 
+    /// See setNumThreads
+    std::size_t numThreads;
+
     /// Allocates a new EdgeSetIntersector. Remember to delete it!
     index::EdgeSetIntersector* createEdgeSetIntersector();
 
@@ -167,6 +170,25 @@ public:
         const algorithm::BoundaryNodeRule& boundaryNodeRule,
         int boundaryCount);
 
+    /**
+     * Sets the maximum number of threads used by computeSelfNodes and
+     * computeEdgeIntersections of this graph, including the calling one.
+     * Defaults to 1.
+     *
+     * The interruption callback (see util::Interrupt) is only run on
+     * the calling thread.
+     *
+     * @param n the maximum number of threads, 0 meaning
+     *          std::thread::hardware_concurrency()
+     */
+    void setNumThreads(std::size_t n);
+
+    std::size_t
+    getNumThreads() const
+    {
+        return numThreads;
+    }
+
     GeometryGraph();
 
     GeometryGraph(int newArgIndex, const geom::Geometry* newParentGeom);
@@ -243,6 +265,10 @@ public:
             algorithm::LineIntersector* li, bool includeProper,
             const geom::Envelope* env = nullptr);
 
+    index::SegmentIntersector* computeEdgeIntersections(GeometryGraph* g,
+            algorithm::LineIntersector* li, bool includeProper,
+            bool isDoneIfProperInt, const geom::Envelope* env = nullptr);
+
     std::vector<Edge*>* getEdges();
 
     bool hasTooFewPoints();
@@ -29,6 +29,8 @@ namespace geomgraph { // geos::geomgraph
 INLINE void
 GeometryGraph::getBoundaryNodes(std::vector<Node*>& bdyNodes)
 {
+    // Geometries may have been added since the graph was built
+    nodes->prepare();
     nodes->getBoundaryNodes(argIndex, bdyNodes);
 }
 
@@ -22,11 +22,13 @@
 #define GEOS_GEOMGRAPH_NODEMAP_H
 
 #include <geos/export.h>
-#include <map>
+#include <utility>
 #include <vector>
 #include <string>
+#include <cassert>
 
 #include <geos/geom/Coordinate.h> // for CoordinateLessThen
+#include <geos/geom/CoordinateHashMap.h> // for composition
 #include <geos/geomgraph/Node.h> // for testInvariant
 
 #include <geos/inline.h>
@@ -48,10 +50,25 @@ class NodeFactory;
 namespace geos {
 namespace geomgraph { // geos.geomgraph
 
+/** \brief
+ * A map of Node, indexed by the coordinate of the node.
+ *
+ * Nodes are looked up through a hash of their coordinate, and
+ * iterated in the order of their coordinate (see
+ * {@link geom::CoordinateLessThen}), which the graph algorithms rely
+ * on to give the same results whatever the input.
+ *
+ * The nodes added are sorted by prepare(), which the non-const
+ * iterators call, and which graphs call once they are built. The
+ * const accessors only read, and require the map to be prepared.
+ *
+ * Nodes must not be added while iterating over the map.
+ */
 class GEOS_DLL NodeMap {
 public:
 
-    typedef std::map<geom::Coordinate*, Node*, geom::CoordinateLessThen> container;
+    /// The nodes keyed by their coordinate, in coordinate order
+    typedef std::vector< std::pair<geom::Coordinate*, Node*> > container;
 
     typedef container::iterator iterator;
 
@@ -59,8 +76,6 @@ public:
 
     typedef std::pair<geom::Coordinate*, Node*> pair;
 
-    container nodeMap;
-
     const NodeFactory& nodeFact;
 
     /// \brief
@@ -78,30 +93,53 @@ public:
 
     Node* find(const geom::Coordinate& coord) const;
 
+    /**
+     * Sorts the nodes added since the last call into the iteration
+     * order.
+     */
+    void prepare();
+
+    /// Whether all the nodes added are in the iteration order
+    bool
+    isPrepared() const
+    {
+        return nSorted == nodeMap.size();
+    }
+
     const_iterator
     begin() const
     {
+        assert(isPrepared());
         return nodeMap.begin();
     }
 
     const_iterator
     end() const
     {
+        assert(isPrepared());
         return nodeMap.end();
     }
 
     iterator
     begin()
     {
+        prepare();
         return nodeMap.begin();
     }
 
     iterator
     end()
     {
+        prepare();
         return nodeMap.end();
     }
 
+    std::size_t
+    size() const
+    {
+        return nodeIndex.size();
+    }
+
     void getBoundaryNodes(int geomIndex,
                           std::vector<Node*>& bdyNodes) const;
 
@@ -125,6 +163,13 @@ public:
 
 private:
 
+    geom::CoordinateHashMap<Node*> nodeIndex;
+
+    /// The nodes, the first nSorted of them sorted by coordinate
+    container nodeMap;
+
+    std::size_t nSorted;
+
     // Declare type as noncopyable
     NodeMap(const NodeMap& other) = delete;
     NodeMap& operator=(const NodeMap& rhs) = delete;
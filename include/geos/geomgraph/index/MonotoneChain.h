@@ -61,6 +61,14 @@ public:
     {
         mce->computeIntersectsForChain(chainIndex, *(mc->mce), mc->chainIndex, *si);
     }
+
+    /// See MonotoneChainEdge::visitChainSegmentPairs
+    template<typename SegmentVisitor>
+    void
+    visitSegmentPairs(const MonotoneChain* mc, SegmentVisitor& visitor) const
+    {
+        mce->visitChainSegmentPairs(chainIndex, *(mc->mce), mc->chainIndex, visitor);
+    }
 };
 
 
@@ -58,6 +58,27 @@ public:
                                    const MonotoneChainEdge& mce, size_t chainIndex1,
                                    SegmentIntersector& si);
 
+    /**
+     * Calls <code>visitor(e0, segIndex0, e1, segIndex1)</code> for the
+     * pairs of segments of two chains which
+     * computeIntersectsForChain would pass to a SegmentIntersector.
+     *
+     * Only reads the edges, so different chains may be visited from
+     * different threads.
+     */
+    template<typename SegmentVisitor>
+    void
+    visitChainSegmentPairs(size_t chainIndex0,
+                           const MonotoneChainEdge& mce, size_t chainIndex1,
+                           SegmentVisitor& visitor) const
+    {
+        visitSegmentPairs(startIndex[chainIndex0],
+                          startIndex[chainIndex0 + 1], mce,
+                          mce.startIndex[chainIndex1],
+                          mce.startIndex[chainIndex1 + 1],
+                          visitor);
+    }
+
 protected:
     Edge* e;
     const geom::CoordinateSequence* pts; // cache a reference to the coord array, for efficiency
@@ -66,12 +87,49 @@ protected:
     std::vector<size_t> startIndex;
     // these envelopes are created once and reused
 private:
-    void computeIntersectsForChain(size_t start0, size_t end0,
-                                   const MonotoneChainEdge& mce,
-                                   size_t start1, size_t end1,
-                                   SegmentIntersector& ei);
+    template<typename SegmentVisitor>
+    void
+    visitSegmentPairs(size_t start0, size_t end0,
+                      const MonotoneChainEdge& mce,
+                      size_t start1, size_t end1,
+                      SegmentVisitor& visitor) const
+    {
+        // terminating condition for the recursion
+        if(end0 - start0 == 1 && end1 - start1 == 1) {
+            visitor(e, start0, mce.e, start1);
+            return;
+        }
+
+        if(!overlaps(start0, end0, mce, start1, end1)) {
+            return;
+        }
+        // the chains overlap, so split each in half and iterate
+        // (binary search)
+        size_t mid0 = (start0 + end0) / 2;
+        size_t mid1 = (start1 + end1) / 2;
+
+        // Assert: mid != start or end
+        // (since we checked above for end - start <= 1)
+        // check terminating conditions before recursing
+        if(start0 < mid0) {
+            if(start1 < mid1)
+                visitSegmentPairs(start0, mid0, mce,
+                                  start1, mid1, visitor);
+            if(mid1 < end1)
+                visitSegmentPairs(start0, mid0, mce,
+                                  mid1, end1, visitor);
+        }
+        if(mid0 < end0) {
+            if(start1 < mid1)
+                visitSegmentPairs(mid0, end0, mce,
+                                  start1, mid1, visitor);
+            if(mid1 < end1)
+                visitSegmentPairs(mid0, end0, mce,
+                                  mid1, end1, visitor);
+        }
+    }
 
-    bool overlaps(size_t start0, size_t end0, const MonotoneChainEdge& mce, size_t start1, size_t end1);
+    bool overlaps(size_t start0, size_t end0, const MonotoneChainEdge& mce, size_t start1, size_t end1) const;
 
 };
 
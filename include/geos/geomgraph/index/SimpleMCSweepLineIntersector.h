@@ -17,6 +17,7 @@
 #define GEOS_GEOMGRAPH_INDEX_SIMPLEMCSWEEPLINEINTERSECTOR_H
 
 #include <geos/export.h>
+#include <cstddef>
 #include <vector>
 
 #include <geos/geomgraph/index/EdgeSetIntersector.h> // for inheritance
@@ -50,6 +51,13 @@ namespace index { // geos::geomgraph::index
  * drastically improves the average-case time.
  * The use of MonotoneChains as the items in the index
  * seems to offer an improvement in performance over a sweep-line alone.
+ *
+ * The sweep can be shared between several threads
+ * (see {@link setNumThreads}). The threads find the intersecting pairs
+ * of segments of consecutive runs of insert events, and the pairs are
+ * then passed to the SegmentIntersector on the calling thread, in the
+ * order of a single-threaded sweep, so the result does not depend on
+ * the number of threads.
  */
 class GEOS_DLL SimpleMCSweepLineIntersector: public EdgeSetIntersector {
 
@@ -66,6 +74,16 @@ public:
                               std::vector<Edge*>* edges1,
                               SegmentIntersector* si) override;
 
+    /**
+     * Sets the maximum number of threads used to find the intersections,
+     * including the calling one. Defaults to 1. Small edge sets are
+     * always processed on the calling thread.
+     *
+     * @param n the maximum number of threads, 0 meaning
+     *          std::thread::hardware_concurrency()
+     */
+    void setNumThreads(std::size_t n);
+
 protected:
 
     std::vector<SweepLineEvent*> events;
@@ -73,6 +91,8 @@ protected:
     // statistics information
     int nOverlaps;
 
+    std::size_t numThreads;
+
 private:
     void add(std::vector<Edge*>* edges);
 
@@ -84,6 +104,8 @@ private:
 
     void computeIntersections(SegmentIntersector* si);
 
+    void computeIntersectionsParallel(SegmentIntersector* si);
+
     void processOverlaps(size_t start, size_t end,
                          SweepLineEvent* ev0,
                          SegmentIntersector* si);
@@ -55,7 +55,6 @@ private:
     const IntervalRTreeNode* root = nullptr;
     int level = 0;
 
-    void init();
     void buildLevel(IntervalRTreeNode::ConstVect& src, IntervalRTreeNode::ConstVect& dest);
     const IntervalRTreeNode* buildTree();
 
@@ -79,6 +78,14 @@ public:
      */
     void insert(double min, double max, void* item);
 
+    /**
+     * Builds the index from the inserted items, if not already done.
+     *
+     * The first query builds the index as well. Building it beforehand
+     * leaves queries read-only, so that they can be run concurrently.
+     */
+    void init();
+
     /**
      * Search for intervals in the index which intersect the given closed interval
      * and apply the visitor to them.
@@ -91,6 +91,15 @@ public:
      */
     double getDistance() const;
 
+    /**
+     * Computes an upper bound of the distance between any item of
+     * the first member and any item of the second one, from the
+     * envelope covering both members.
+     *
+     * @return the maximum distance between the bounds of the pair
+     */
+    double maximumDistance() const;
+
     /**
      * Tests if both elements of the pair are leaf nodes
      *
@@ -104,6 +113,14 @@ public:
 
     void expandToQueue(BoundablePairQueue&, double minDistance);
     void expand(const Boundable* bndComposite, const Boundable* bndOther, BoundablePairQueue& priQ, double minDistance);
+
+    /**
+     * Pushes the pairs of the children of bndComposite with bndOther,
+     * keeping the members in the order of this pair: when isFlipped,
+     * bndComposite is the second member.
+     */
+    void expand(const Boundable* bndComposite, const Boundable* bndOther, bool isFlipped,
+                BoundablePairQueue& priQ, double minDistance);
 };
 }
 }
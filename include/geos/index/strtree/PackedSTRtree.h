@@ -0,0 +1,215 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_INDEX_STRTREE_PACKEDSTRTREE_H
+#define GEOS_INDEX_STRTREE_PACKEDSTRTREE_H
+
+#include <geos/export.h>
+#include <geos/index/SpatialIndex.h> // for inheritance
+#include <geos/geom/Envelope.h> // for inlines
+
+#include <algorithm> // for inlines
+#include <vector>
+#include <cassert> // for inlines
+#include <cstddef>
+#include <cstdint>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace index { // geos::index
+namespace strtree { // geos::index::strtree
+
+/**
+ * \brief
+ * A query-only R-tree created using the Sort-Tile-Recursive (STR) algorithm,
+ * stored as flat arrays.
+ *
+ * This answers the same queries as {@link STRtree}, but is laid out for
+ * large, build-once indexes:
+ *
+ * - the items are sorted in STR order in a single pass, and the tree
+ *   is packed bottom-up from that order;
+ * - the envelopes of all the nodes are stored contiguously, level by
+ *   level, with the leaves first. The children of a node are a run of
+ *   consecutive entries of the level below, found by arithmetic rather
+ *   than through pointers;
+ * - no object is allocated per node or per item.
+ *
+ * This takes about 44 bytes per item with the default node capacity.
+ *
+ * Once built (explicitly, or on the first call to a non-const #query),
+ * items may not be added or removed, and the const queries may be run
+ * concurrently from several threads.
+ */
+class GEOS_DLL PackedSTRtree: public SpatialIndex {
+
+public:
+
+    /**
+     * Constructs a PackedSTRtree with the given maximum number of child
+     * nodes that a node may have
+     */
+    PackedSTRtree(std::size_t nodeCapacity = 10);
+
+    ~PackedSTRtree() override = default;
+
+    /**
+     * Adds an item to the tree, to be indexed when the tree is built.
+     * Items with a null envelope are ignored.
+     */
+    void insert(const geom::Envelope* itemEnv, void* item) override;
+
+    /**
+     * Adds an item given by an index, e.g. its position in a vector
+     * of the caller, to be indexed when the tree is built.
+     *
+     * The index is stored in place of an item pointer, and given back
+     * by #queryIndex. This saves callers which keep their items in a
+     * vector from inserting pointers to the vector elements and finding
+     * their position back by subtraction. Items inserted by index must
+     * only be queried by index.
+     */
+    void
+    insertIndex(const geom::Envelope* itemEnv, std::size_t itemIndex)
+    {
+        insert(itemEnv, reinterpret_cast<void*>(static_cast<std::uintptr_t>(itemIndex)));
+    }
+
+    /**
+     * Sorts the items and builds the tree nodes.
+     * Does nothing if the tree is already built.
+     */
+    void build();
+
+    bool
+    isBuilt() const
+    {
+        return built;
+    }
+
+    /// Returns the number of items in the tree
+    std::size_t
+    size() const
+    {
+        return items.size();
+    }
+
+    std::size_t
+    getNodeCapacity() const
+    {
+        return nodeCapacity;
+    }
+
+    /// Builds the tree if needed, and queries it
+    void query(const geom::Envelope* searchEnv, std::vector<void*>& matches) override;
+
+    /// Builds the tree if needed, and queries it
+    void query(const geom::Envelope* searchEnv, ItemVisitor& visitor) override;
+
+    /**
+     * Calls <code>visitor(item)</code> for each item whose envelope
+     * intersects <code>searchEnv</code>.
+     *
+     * The tree must have been built.
+     */
+    template<typename Visitor>
+    void
+    query(const geom::Envelope& searchEnv, Visitor&& visitor) const
+    {
+        assert(built);
+        if(items.empty() || ! nodeBounds.back().intersects(searchEnv)) {
+            return;
+        }
+        queryNode(searchEnv, levelOffsets.size() - 2, nodeBounds.size() - 1, visitor);
+    }
+
+    /**
+     * Calls <code>visitor(itemIndex)</code> for each item inserted
+     * by #insertIndex whose envelope intersects <code>searchEnv</code>.
+     *
+     * The tree must have been built.
+     */
+    template<typename Visitor>
+    void
+    queryIndex(const geom::Envelope& searchEnv, Visitor&& visitor) const
+    {
+        query(searchEnv, [&visitor](void* item) {
+            visitor(static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(item)));
+        });
+    }
+
+    /**
+     * Removing items is not supported.
+     *
+     * @throws util::UnsupportedOperationException
+     */
+    bool remove(const geom::Envelope* itemEnv, void* item) override;
+
+private:
+
+    std::size_t nodeCapacity;
+
+    bool built;
+
+    /// Envelopes of the items (in STR order once built), then of the
+    /// nodes of each upper level; the root is last
+    std::vector<geom::Envelope> nodeBounds;
+
+    /// The items, in the same order as their envelopes
+    std::vector<void*> items;
+
+    /// Start of each level in nodeBounds, followed by nodeBounds.size()
+    std::vector<std::size_t> levelOffsets;
+
+    void sortItems();
+
+    template<typename Visitor>
+    void
+    queryNode(const geom::Envelope& searchEnv, std::size_t level,
+              std::size_t node, Visitor& visitor) const
+    {
+        std::size_t childLevelStart = levelOffsets[level - 1];
+        std::size_t childLevelEnd = levelOffsets[level];
+        std::size_t begin = childLevelStart
+                            + (node - childLevelEnd) * nodeCapacity;
+        std::size_t end = std::min(begin + nodeCapacity, childLevelEnd);
+
+        if(level == 1) {
+            for(std::size_t i = begin; i < end; i++) {
+                if(nodeBounds[i].intersects(searchEnv)) {
+                    visitor(items[i]);
+                }
+            }
+            return;
+        }
+
+        for(std::size_t i = begin; i < end; i++) {
+            if(nodeBounds[i].intersects(searchEnv)) {
+                queryNode(searchEnv, level - 1, i, visitor);
+            }
+        }
+    }
+};
+
+} // namespace geos::index::strtree
+} // namespace geos::index
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_INDEX_STRTREE_PACKEDSTRTREE_H
@@ -155,6 +155,36 @@ public:
     std::pair<const void*, const void*> nearestNeighbour(BoundablePair* initBndPair, double maxDistance);
     std::pair<const void*, const void*> nearestNeighbour(STRtree* tree, ItemDistance* itemDist);
 
+    /**
+     * Tests whether some item of this tree and some item of another
+     * tree are within a given distance of each other.
+     *
+     * The pairs of nodes are searched in order of distance, and the
+     * search stops at the first pair of items within the distance,
+     * at the first pair of nodes whose bounds are further apart, or at
+     * the first pair of nodes whose bounds are entirely within it.
+     *
+     * @param tree the other tree
+     * @param itemDist the distance between the items of the trees
+     * @param maxDistance the distance to test
+     * @return true if two items are within the distance
+     */
+    bool isWithinDistance(STRtree* tree, ItemDistance* itemDist, double maxDistance);
+    bool isWithinDistance(BoundablePair* initBndPair, double maxDistance);
+
+    /**
+     * Tests whether some item of this tree is within a given distance
+     * of an item which is not in it.
+     *
+     * @param env the envelope of the item
+     * @param item the item
+     * @param itemDist the distance between the items of the tree and the item
+     * @param maxDistance the distance to test
+     * @return true if an item of the tree is within the distance
+     */
+    bool isWithinDistance(const geom::Envelope* env, const void* item, ItemDistance* itemDist,
+                          double maxDistance);
+
     bool
     remove(const geom::Envelope* itemEnv, void* item) override
     {
@@ -26,7 +26,8 @@
 //#include <geos/io/ByteOrderValues.h>
 #include <geos/inline.h>
 
-#include <iosfwd> // ostream, istream (if we remove inlines)
+#include <cstddef>
+#include <iosfwd> // istream
 
 namespace geos {
 namespace io {
@@ -34,9 +35,13 @@ namespace io {
 /*
  * \class ByteOrderDataInStream io.h geos.h
  *
- * Allows reading an stream of primitive datatypes from an underlying
- * istream, with the representation being in either common byte ordering.
+ * Allows reading a stream of primitive datatypes from an underlying
+ * istream or byte buffer, with the representation being in either
+ * common byte ordering.
  *
+ * An istream is read incrementally, so that it is left right after
+ * the last value read. A buffer is not copied and must outlive the
+ * reads.
  */
 class GEOS_DLL ByteOrderDataInStream {
 
@@ -44,6 +49,8 @@ public:
 
     ByteOrderDataInStream(std::istream* s = nullptr);
 
+    ByteOrderDataInStream(const unsigned char* buf, std::size_t size);
+
     ~ByteOrderDataInStream();
 
     /**
@@ -52,6 +59,8 @@ public:
      */
     void setInStream(std::istream* s);
 
+    void setInStream(const unsigned char* buf, std::size_t size);
+
     void setOrder(int order);
 
     unsigned char readByte(); // throws ParseException
@@ -62,15 +71,40 @@ public:
 
     double readDouble(); // throws ParseException
 
+    /**
+     * Reads <code>n</code> consecutive doubles into <code>out</code>,
+     * converting them from the stream byte order in a single pass.
+     * Throws ParseException if fewer than <code>n</code> doubles remain.
+     */
+    void readDoubles(double* out, std::size_t n); // throws ParseException
+
+    /// Whether the number of bytes not read yet is known, i.e. a buffer is read
+    bool hasSize() const;
+
+    /// Number of bytes not read yet, when hasSize()
+    std::size_t size() const;
+
 private:
     int byteOrder;
+
+    // true when byteOrder differs from the machine byte order
+    bool swapBytes;
+
+    // read when not null, instead of the buffer
     std::istream* stream;
 
-    // buffers to hold primitive datatypes
-    unsigned char buf[8];
+    const unsigned char* buf;
+    const unsigned char* end;
+
+    // holds the primitive datatypes read from the stream
+    unsigned char streamBuf[8];
+
+    /// Reads n bytes, at most 8 from a stream
+    const unsigned char* readBytes(std::size_t n); // throws ParseException
 
 };
 
+
 } // namespace io
 } // namespace geos
 
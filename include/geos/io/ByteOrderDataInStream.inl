@@ -25,7 +25,9 @@
 #include <geos/io/ByteOrderValues.h>
 #include <geos/util/Machine.h> // for getMachineByteOrder
 
-#include <iostream> // ostream, istream 
+#include <algorithm> // for reverse
+#include <cstring>
+#include <istream>
 
 namespace geos {
 namespace io {
@@ -34,7 +36,21 @@ INLINE
 ByteOrderDataInStream::ByteOrderDataInStream(std::istream* s)
     :
     byteOrder(getMachineByteOrder()),
-    stream(s)
+    swapBytes(false),
+    stream(s),
+    buf(nullptr),
+    end(nullptr)
+{
+}
+
+INLINE
+ByteOrderDataInStream::ByteOrderDataInStream(const unsigned char* buff, std::size_t buffsz)
+    :
+    byteOrder(getMachineByteOrder()),
+    swapBytes(false),
+    stream(nullptr),
+    buf(buff),
+    end(buff + buffsz)
 {
 }
 
@@ -47,52 +63,103 @@ INLINE void
 ByteOrderDataInStream::setInStream(std::istream* s)
 {
     stream = s;
+    buf = nullptr;
+    end = nullptr;
+}
+
+INLINE void
+ByteOrderDataInStream::setInStream(const unsigned char* buff, std::size_t buffsz)
+{
+    stream = nullptr;
+    buf = buff;
+    end = buff + buffsz;
 }
 
 INLINE void
 ByteOrderDataInStream::setOrder(int order)
 {
     byteOrder = order;
+    swapBytes = (order != getMachineByteOrder());
 }
 
-INLINE unsigned char
-ByteOrderDataInStream::readByte() // throws ParseException
+INLINE bool
+ByteOrderDataInStream::hasSize() const
+{
+    return stream == nullptr;
+}
+
+INLINE std::size_t
+ByteOrderDataInStream::size() const
 {
-    stream->read(reinterpret_cast<char*>(buf), 1);
-    if(stream->eof()) {
+    return static_cast<std::size_t>(end - buf);
+}
+
+INLINE const unsigned char*
+ByteOrderDataInStream::readBytes(std::size_t n)
+{
+    if(stream) {
+        stream->read(reinterpret_cast<char*>(streamBuf), static_cast<std::streamsize>(n));
+        if(stream->eof()) {
+            throw  ParseException("Unexpected EOF parsing WKB");
+        }
+        return streamBuf;
+    }
+
+    if(size() < n) {
         throw  ParseException("Unexpected EOF parsing WKB");
     }
-    return buf[0];
+    const unsigned char* ret = buf;
+    buf += n;
+    return ret;
+}
+
+INLINE unsigned char
+ByteOrderDataInStream::readByte() // throws ParseException
+{
+    return *readBytes(1);
 }
 
 INLINE int
 ByteOrderDataInStream::readInt()
 {
-    stream->read(reinterpret_cast<char*>(buf), 4);
-    if(stream->eof()) {
-        throw  ParseException("Unexpected EOF parsing WKB");
-    }
-    return ByteOrderValues::getInt(buf, byteOrder);
+    return ByteOrderValues::getInt(readBytes(4), byteOrder);
 }
 
 INLINE long
 ByteOrderDataInStream::readLong()
 {
-    stream->read(reinterpret_cast<char*>(buf), 8);
-    if(stream->eof()) {
-        throw  ParseException("Unexpected EOF parsing WKB");
-    }
-    return static_cast<long>(ByteOrderValues::getLong(buf, byteOrder));
+    return static_cast<long>(ByteOrderValues::getLong(readBytes(8), byteOrder));
 }
 
 INLINE double
 ByteOrderDataInStream::readDouble()
 {
-    stream->read(reinterpret_cast<char*>(buf), 8);
-    if(stream->eof()) {
-        throw  ParseException("Unexpected EOF parsing WKB");
+    return ByteOrderValues::getDouble(readBytes(8), byteOrder);
+}
+
+INLINE void
+ByteOrderDataInStream::readDoubles(double* out, std::size_t n)
+{
+    if(stream) {
+        stream->read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(n * 8));
+        if(stream->eof()) {
+            throw  ParseException("Unexpected EOF parsing WKB");
+        }
+    }
+    else {
+        if(size() / 8 < n) {
+            throw  ParseException("Unexpected EOF parsing WKB");
+        }
+        std::memcpy(out, buf, n * 8);
+        buf += n * 8;
+    }
+
+    if(swapBytes) {
+        unsigned char* p = reinterpret_cast<unsigned char*>(out);
+        for(std::size_t i = 0; i < n; ++i, p += 8) {
+            std::reverse(p, p + 8);
+        }
     }
-    return ByteOrderValues::getDouble(buf, byteOrder);
 }
 
 } // namespace io
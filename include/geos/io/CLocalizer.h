@@ -33,6 +33,11 @@ namespace io {
 
 /**
  * \class CLocalizer io.h geos.h
+ *
+ * Sets the process-wide numeric locale to "C" for its lifetime.
+ *
+ * This is not thread-safe, and no longer needed by the WKT reader and
+ * writer, which use NumberConversion instead.
  */
 class GEOS_DLL CLocalizer {
 public:
@@ -0,0 +1,99 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: ORIGINAL WORK
+ *
+ **********************************************************************/
+
+#ifndef GEOS_IO_NUMBERCONVERSION_H
+#define GEOS_IO_NUMBERCONVERSION_H
+
+#include <geos/export.h>
+
+#include <cstddef>
+
+namespace geos {
+namespace io {
+
+/**
+ * \class NumberConversion
+ *
+ * \brief
+ * Conversions between doubles and their text representation which
+ * always use '.' as the decimal separator, whatever the current locale.
+ *
+ * None of these functions touch the global locale, so unlike
+ * CLocalizer they are safe to use concurrently from many threads.
+ * The formatting functions write into a caller-supplied buffer and
+ * never allocate memory, nor does parsing, but for numbers written
+ * with more than BUFFER_SIZE characters.
+ */
+class GEOS_DLL NumberConversion {
+public:
+
+    /**
+     * \brief
+     * A buffer size large enough for any number written with
+     * {@link writeFixed} or {@link writeGeneral}.
+     */
+    static const std::size_t BUFFER_SIZE = 400;
+
+    /// Larger precisions are reduced to this one
+    static const int MAX_PRECISION = 60;
+
+    /**
+     * \brief
+     * Writes the number as by printf("%.*f"), with
+     * <code>precision</code> digits after the decimal point.
+     *
+     * @return the number of characters written, not counting the
+     *         terminating null character. If the buffer is too small
+     *         for the result, it is truncated and the return value
+     *         is the size it would have had.
+     */
+    static std::size_t writeFixed(double d, int precision,
+                                  char* buf, std::size_t size);
+
+    /**
+     * \brief
+     * Writes the number as by printf("%.*g"), with
+     * <code>precision</code> significant digits and no trailing zeros.
+     *
+     * @return as for {@link writeFixed}
+     */
+    static std::size_t writeGeneral(double d, int precision,
+                                    char* buf, std::size_t size);
+
+    /**
+     * \brief
+     * Parses a number in the form
+     * <code>[+-]digits[.digits][(e|E)[+-]digits]</code>, or one of
+     * <code>[+-]inf</code>, <code>[+-]infinity</code> and
+     * <code>[+-]nan</code> (ignoring case).
+     *
+     * Leading and trailing blanks are not accepted.
+     * Results are correctly rounded; numbers out of the range of a
+     * double are read as infinities or zeros.
+     *
+     * @param str the characters to parse, not necessarily
+     *        null-terminated
+     * @param len the number of characters to parse
+     * @param result set to the parsed number on success
+     * @return false if <code>str</code> is not a number as a whole
+     */
+    static bool parseDouble(const char* str, std::size_t len, double& result);
+};
+
+} // namespace io
+} // namespace geos
+
+#endif // GEOS_IO_NUMBERCONVERSION_H
@@ -48,6 +48,9 @@ public:
     double getNVal();
     std::string getSVal();
 private:
+    int classifyToken(std::string::const_iterator tokStart,
+                      std::string::const_iterator tokEnd);
+
     const std::string& str;
     std::string stok;
     double ntok;
@@ -88,6 +88,9 @@ public:
     /**
      * \brief Reads a Geometry from an istream.
      *
+     * The stream is read incrementally, and left right after the
+     * geometry, so that consecutive geometries can be read from it.
+     *
      * @param is the stream to read from
      * @return the Geometry read
      * @throws IOException
@@ -96,6 +99,18 @@ public:
     geom::Geometry* read(std::istream& is);
     // throws IOException, ParseException
 
+    /**
+     * \brief
+     * Reads a Geometry directly from a WKB buffer, without copying it.
+     *
+     * @param buf the WKB bytes
+     * @param size the number of bytes available in <code>buf</code>
+     * @return the Geometry read
+     * @throws ParseException
+     */
+    geom::Geometry* read(const unsigned char* buf, std::size_t size);
+    // throws ParseException
+
     /**
      * \brief Reads a Geometry from an istream in hex format.
      *
@@ -155,6 +170,9 @@ private:
 
     geom::CoordinateSequence* readCoordinateSequence(int); // throws IOException
 
+    /// Reads a count of elements taking at least minElementSize bytes each
+    int readCount(std::size_t minElementSize); // throws ParseException
+
     void readCoordinate(); // throws IOException
 
     // Declare type as noncopyable
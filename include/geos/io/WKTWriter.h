@@ -221,6 +221,9 @@ protected:
 
     std::string writeNumber(double d);
 
+    /// Writes the number straight into the Writer, without allocating
+    void writeNumber(double d, Writer* writer);
+
     void appendLineStringText(
         const geom::LineString* lineString,
         int level, bool doIndent, Writer* writer);
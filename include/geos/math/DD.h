@@ -0,0 +1,258 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2001-2002 Vivid Solutions Inc.
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: math/DD.java (JTS-1.14)
+ *
+ **********************************************************************/
+
+#ifndef GEOS_MATH_DD_H
+#define GEOS_MATH_DD_H
+
+#include <cmath>
+
+namespace geos {
+namespace math { // geos::math
+
+/**
+ * \brief
+ * Implements extended-precision floating-point numbers
+ * which maintain 106 bits (approximately 30 decimal digits) of precision.
+ *
+ * A DoubleDouble uses a representation containing two double-precision
+ * values. A number x is represented as a pair of doubles, x.hi and x.lo,
+ * such that the number represented by x is x.hi + x.lo, where
+ *
+ *    |x.lo| <= 0.5*ulp(x.hi)
+ *
+ * and ulp(y) means "unit in the last place of y".
+ * The basic arithmetic operations are implemented using
+ * convenient properties of IEEE-754 floating-point arithmetic
+ * (error-free transformations due to Dekker and Knuth).
+ *
+ * The class is header-only and allocation-free so that the robust
+ * predicates in CGAlgorithmsDD can be fully inlined into their callers.
+ *
+ * This code must be compiled without contraction of floating-point
+ * expressions into fused multiply-add instructions, since the
+ * error-free transformations rely on every operation being rounded.
+ */
+class DD {
+
+private:
+
+    /**
+     * The value to split a double-precision value on during multiplication
+     * (2^27 + 1).
+     */
+    static constexpr double SPLIT = 134217729.0;
+
+    double hi;
+    double lo;
+
+    /// Returns (a + b) and its rounding error, assuming |a| >= |b|
+    static DD
+    quickTwoSum(double a, double b)
+    {
+        double s = a + b;
+        double e = b - (s - a);
+        return DD(s, e);
+    }
+
+public:
+
+    DD(double p_hi, double p_lo) : hi(p_hi), lo(p_lo) {}
+
+    DD(double x) : hi(x), lo(0.0) {}
+
+    DD() : hi(0.0), lo(0.0) {}
+
+    /// The high-order component of the value
+    double getHi() const { return hi; }
+
+    /// The low-order component of the value
+    double getLo() const { return lo; }
+
+    /// Converts this value to the nearest double-precision number.
+    double doubleValue() const { return hi + lo; }
+
+    bool isNaN() const { return std::isnan(hi); }
+
+    bool isZero() const { return hi == 0.0 && lo == 0.0; }
+
+    bool isNegative() const { return hi < 0.0 || (hi == 0.0 && lo < 0.0); }
+
+    bool isPositive() const { return hi > 0.0 || (hi == 0.0 && lo > 0.0); }
+
+    /**
+     * Returns an integer indicating the sign of this value.
+     *
+     * @return 1 if this value is > 0
+     * @return 0 if this value is = 0
+     * @return -1 if this value is < 0
+     */
+    int
+    signum() const
+    {
+        if(hi > 0) {
+            return 1;
+        }
+        if(hi < 0) {
+            return -1;
+        }
+        if(lo > 0) {
+            return 1;
+        }
+        if(lo < 0) {
+            return -1;
+        }
+        return 0;
+    }
+
+    /**
+     * Computes the exact sum of two doubles, as a DD.
+     */
+    static DD
+    twoSum(double a, double b)
+    {
+        double s = a + b;
+        double bb = s - a;
+        double e = (a - (s - bb)) + (b - bb);
+        return DD(s, e);
+    }
+
+    /**
+     * Computes the exact product of two doubles, as a DD.
+     */
+    static DD
+    twoProd(double a, double b)
+    {
+        double p = a * b;
+        double c = SPLIT * a;
+        double ahi = c - (c - a);
+        double alo = a - ahi;
+        c = SPLIT * b;
+        double bhi = c - (c - b);
+        double blo = b - bhi;
+        double e = ((ahi * bhi - p) + ahi * blo + alo * bhi) + alo * blo;
+        return DD(p, e);
+    }
+
+    DD&
+    selfAdd(const DD& y)
+    {
+        double S = hi + y.hi;
+        double T = lo + y.lo;
+        double e = S - hi;
+        double f = T - lo;
+        double s = S - e;
+        double t = T - f;
+        s = (y.hi - e) + (hi - s);
+        t = (y.lo - f) + (lo - t);
+        e = s + T;
+        double H = S + e;
+        double h = e + (S - H);
+        e = t + h;
+        DD z = quickTwoSum(H, e);
+        hi = z.hi;
+        lo = z.lo;
+        return *this;
+    }
+
+    DD&
+    selfSubtract(const DD& y)
+    {
+        return selfAdd(DD(-y.hi, -y.lo));
+    }
+
+    DD&
+    selfMultiply(const DD& y)
+    {
+        DD p = twoProd(hi, y.hi);
+        double c = p.lo + (hi * y.lo + lo * y.hi);
+        DD z = quickTwoSum(p.hi, c);
+        hi = z.hi;
+        lo = z.lo;
+        return *this;
+    }
+
+    DD&
+    selfDivide(const DD& y)
+    {
+        double C = hi / y.hi;
+        DD u = twoProd(C, y.hi);
+        double c = ((((hi - u.hi) - u.lo) + lo) - C * y.lo) / y.hi;
+        DD z = quickTwoSum(C, c);
+        hi = z.hi;
+        lo = z.lo;
+        return *this;
+    }
+
+    DD& operator+=(const DD& y) { return selfAdd(y); }
+    DD& operator-=(const DD& y) { return selfSubtract(y); }
+    DD& operator*=(const DD& y) { return selfMultiply(y); }
+    DD& operator/=(const DD& y) { return selfDivide(y); }
+
+    DD operator-() const { return DD(-hi, -lo); }
+
+    friend DD operator+(DD x, const DD& y) { return x.selfAdd(y); }
+    friend DD operator-(DD x, const DD& y) { return x.selfSubtract(y); }
+    friend DD operator*(DD x, const DD& y) { return x.selfMultiply(y); }
+    friend DD operator/(DD x, const DD& y) { return x.selfDivide(y); }
+
+    friend bool
+    operator<(const DD& x, const DD& y)
+    {
+        return (x.hi < y.hi) || (x.hi == y.hi && x.lo < y.lo);
+    }
+
+    friend bool
+    operator>(const DD& x, const DD& y)
+    {
+        return (x.hi > y.hi) || (x.hi == y.hi && x.lo > y.lo);
+    }
+
+    friend bool
+    operator==(const DD& x, const DD& y)
+    {
+        return x.hi == y.hi && x.lo == y.lo;
+    }
+
+    friend bool
+    operator!=(const DD& x, const DD& y)
+    {
+        return !(x == y);
+    }
+
+    /**
+     * Computes the sign of the determinant of the 2x2 matrix
+     * with the given entries, using extended-precision arithmetic.
+     *
+     * This is the same precision used by JTS for its robust
+     * orientation predicate.
+     *
+     * @return -1, 0 or 1 according to the sign of x1*y2 - y1*x2
+     */
+    static int
+    signOfDet2x2(const DD& x1, const DD& y1, const DD& x2, const DD& y2)
+    {
+        DD det = x1 * y2 - y1 * x2;
+        return det.signum();
+    }
+
+};
+
+} // namespace geos::math
+} // namespace geos
+
+#endif // GEOS_MATH_DD_H
@@ -22,6 +22,7 @@
 
 #include <geos/noding/SegmentSetMutualIntersector.h> // inherited
 #include <geos/index/chain/MonotoneChainOverlapAction.h> // inherited
+#include <geos/index/strtree/STRtree.h> // for composition
 
 namespace geos {
 namespace index {
@@ -30,9 +31,6 @@ class SpatialIndex;
 namespace chain {
 class MonotoneChain;
 }
-namespace strtree {
-//class STRtree;
-}
 }
 namespace noding {
 class SegmentString;
@@ -64,11 +62,27 @@ public:
         return index;
     }
 
+    /**
+     * Indexes the base segments. The index is built right away,
+     * so this must be called only once.
+     */
     void setBaseSegments(SegmentString::ConstVect* segStrings) override;
 
     // NOTE: re-populates the MonotoneChain vector with newly created chains
     void process(SegmentString::ConstVect* segStrings) override;
 
+    /**
+     * \brief
+     * Computes the intersections of the given segment strings with the
+     * base segments, reporting them to <code>segInt</code>.
+     *
+     * Unlike {@link process(SegmentString::ConstVect*)}, this keeps no
+     * state in this object, so it may be called concurrently from
+     * several threads with different SegmentIntersectors.
+     */
+    void process(SegmentString::ConstVect* segStrings,
+                 SegmentIntersector* segInt) const;
+
     class SegmentOverlapAction : public index::chain::MonotoneChainOverlapAction {
     private:
         SegmentIntersector& si;
@@ -103,7 +117,7 @@ private:
      * envelope (range) queries efficiently (such as a {@link Quadtree}
      * or {@link STRtree}.
      */
-    index::SpatialIndex* index;
+    index::strtree::STRtree* index;
     int indexCounter;
     int processCounter;
     // statistics
@@ -116,9 +130,11 @@ private:
 
     void addToIndex(SegmentString* segStr);
 
-    void intersectChains();
+    int intersectChains(const MonoChains& queryChains,
+                        SegmentIntersector& si) const;
 
-    void addToMonoChains(SegmentString* segStr);
+    static void addToMonoChains(SegmentString* segStr, MonoChains& chains,
+                                int& counter);
 
 };
 
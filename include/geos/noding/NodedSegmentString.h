@@ -108,14 +108,13 @@ public:
 
     /**
      * Adds an intersection node for a given point and segment to this segment string.
-     * If an intersection already exists for this exact location, the existing
-     * node will be returned.
+     * If an intersection already exists for this exact location, it is
+     * kept and the new one is dropped.
      *
      * @param intPt the location of the intersection
      * @param segmentIndex the index of the segment containing the intersection
-     * @return the intersection node for the point
      */
-    SegmentNode*
+    void
     addIntersectionNode(geom::Coordinate* intPt, std::size_t segmentIndex)
     {
         std::size_t normalizedSegmentIndex = segmentIndex;
@@ -134,8 +133,7 @@ public:
         }
 
         // Add the intersection point to edge intersection list.
-        SegmentNode* ei = getNodeList().add(*intPt, normalizedSegmentIndex);
-        return ei;
+        getNodeList().add(*intPt, normalizedSegmentIndex);
     }
 
     SegmentNodeList& getNodeList();
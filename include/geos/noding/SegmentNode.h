@@ -44,16 +44,10 @@ namespace noding { // geos.noding
 ///
 class GEOS_DLL SegmentNode {
 private:
-    const NodedSegmentString& segString;
-
     int segmentOctant;
 
     bool isInteriorVar;
 
-    // Declare type as noncopyable
-    SegmentNode(const SegmentNode& other) = delete;
-    SegmentNode& operator=(const SegmentNode& rhs) = delete;
-
 public:
     friend std::ostream& operator<< (std::ostream& os, const SegmentNode& n);
 
@@ -101,7 +95,7 @@ public:
      * @return 1 this EdgeIntersection is located after the
      *           argument location
      */
-    int compareTo(const SegmentNode& other);
+    int compareTo(const SegmentNode& other) const;
 
     //string print() const;
 };
@@ -110,7 +104,7 @@ std::ostream& operator<< (std::ostream& os, const SegmentNode& n);
 
 struct GEOS_DLL  SegmentNodeLT {
     bool
-    operator()(SegmentNode* s1, SegmentNode* s2) const
+    operator()(const SegmentNode* s1, const SegmentNode* s2) const
     {
         return s1->compareTo(*s2) < 0;
     }
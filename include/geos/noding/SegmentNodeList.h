@@ -26,7 +26,6 @@
 #include <cassert>
 #include <iostream>
 #include <vector>
-#include <set>
 
 #include <geos/noding/SegmentNode.h> // for composition
 
@@ -55,7 +54,11 @@ namespace noding { // geos::noding
  */
 class GEOS_DLL SegmentNodeList {
 private:
-    std::set<SegmentNode*, SegmentNodeLT> nodeMap;
+    /// The nodes, in insertion order until prepare() sorts them
+    std::vector<SegmentNode> nodeMap;
+
+    /// Whether nodeMap is sorted and free of duplicates
+    bool sorted;
 
     // the parent edge
     const NodedSegmentString& edge;
@@ -76,7 +79,7 @@ private:
      *
      * ownership of return value is transferred
      */
-    SegmentString* createSplitEdge(SegmentNode* ei0, SegmentNode* ei1);
+    SegmentString* createSplitEdge(const SegmentNode& ei0, const SegmentNode& ei1);
 
     /**
      * Adds nodes for any collapsed edge pairs.
@@ -105,9 +108,12 @@ private:
     void findCollapsesFromInsertedNodes(
         std::vector<std::size_t>& collapsedVertexIndexes);
 
-    bool findCollapseIndex(SegmentNode& ei0, SegmentNode& ei1,
+    bool findCollapseIndex(const SegmentNode& ei0, const SegmentNode& ei1,
                            size_t& collapsedVertexIndex);
 
+    /// Throws util::IllegalStateException if the nodes are not prepared
+    void checkPrepared() const;
+
     // Declare type as noncopyable
     SegmentNodeList(const SegmentNodeList& other) = delete;
     SegmentNodeList& operator=(const SegmentNodeList& rhs) = delete;
@@ -116,13 +122,13 @@ public:
 
     friend std::ostream& operator<< (std::ostream& os, const SegmentNodeList& l);
 
-    typedef std::set<SegmentNode*, SegmentNodeLT> container;
+    typedef std::vector<SegmentNode> container;
     typedef container::iterator iterator;
     typedef container::const_iterator const_iterator;
 
-    SegmentNodeList(const NodedSegmentString* newEdge): edge(*newEdge) {}
+    SegmentNodeList(const NodedSegmentString* newEdge): sorted(true), edge(*newEdge) {}
 
-    SegmentNodeList(const NodedSegmentString& newEdge): edge(newEdge) {}
+    SegmentNodeList(const NodedSegmentString& newEdge): sorted(true), edge(newEdge) {}
 
     const NodedSegmentString&
     getEdge() const
@@ -138,18 +144,15 @@ public:
      * Adds an intersection into the list, if it isn't already there.
      * The input segmentIndex is expected to be normalized.
      *
-     * @return the SegmentIntersection found or added. It will be
-     *	   destroyed at SegmentNodeList destruction time.
-     *
      * @param intPt the intersection Coordinate, will be copied
      * @param segmentIndex
      */
-    SegmentNode* add(const geom::Coordinate& intPt, std::size_t segmentIndex);
+    void add(const geom::Coordinate& intPt, std::size_t segmentIndex);
 
-    SegmentNode*
+    void
     add(const geom::Coordinate* intPt, std::size_t segmentIndex)
     {
-        return add(*intPt, segmentIndex);
+        add(*intPt, segmentIndex);
     }
 
     /*
@@ -157,37 +160,69 @@ public:
      */
     //replaces iterator()
     // TODO: obsolete this function
-    std::set<SegmentNode*, SegmentNodeLT>*
+    container*
     getNodes()
     {
+        prepare();
         return &nodeMap;
     }
 
+    /**
+     * Sorts the nodes along the edge and removes the duplicates,
+     * keeping the first one added.
+     *
+     * Adding a node is a mere append, so that the sort is only
+     * paid for once, before the nodes are read. The non-const
+     * accessors call it, as does the noding of the edge into
+     * substrings. The const ones only read, so that a list can be
+     * read from several threads, and throw util::IllegalStateException
+     * if it is not prepared.
+     */
+    void prepare();
+
+    /// Whether the nodes are sorted and free of duplicates
+    bool
+    isPrepared() const
+    {
+        return sorted;
+    }
+
     /// Return the number of nodes in this list
     size_t
+    size()
+    {
+        prepare();
+        return nodeMap.size();
+    }
+    size_t
     size() const
     {
+        checkPrepared();
         return nodeMap.size();
     }
 
     container::iterator
     begin()
     {
+        prepare();
         return nodeMap.begin();
     }
     container::const_iterator
     begin() const
     {
+        checkPrepared();
         return nodeMap.begin();
     }
     container::iterator
     end()
     {
+        prepare();
         return nodeMap.end();
     }
     container::const_iterator
     end() const
     {
+        checkPrepared();
         return nodeMap.end();
     }
 
@@ -86,7 +86,7 @@ private:
      *  1 0
      *  2 3
      */
-    std::vector<geom::Coordinate> corner;
+    geom::Coordinate corner[4];
 
     /// Owned by this class, constructed on demand
     mutable std::unique_ptr<geom::Envelope> safeEnv;
@@ -0,0 +1,116 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_NODING_SNAPROUND_SNAPROUNDINGNODER_H
+#define GEOS_NODING_SNAPROUND_SNAPROUNDINGNODER_H
+
+#include <geos/export.h>
+
+#include <geos/noding/Noder.h> // for inheritance
+
+#include <cstddef>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class PrecisionModel;
+}
+namespace noding {
+class SegmentString;
+}
+}
+
+namespace geos {
+namespace noding { // geos::noding
+namespace snapround { // geos::noding::snapround
+
+/** \brief
+ * Uses Snap Rounding to compute a rounded, fully noded arrangement
+ * from a set of {@link NodedSegmentString}s, for large inputs.
+ *
+ * Computes the same noding as {@link MCIndexSnapRounder}, but
+ * works the other way round: all the hot pixels (the interior
+ * intersections and the vertices of the segment strings) are gathered
+ * first, with the pixels shared by several points merged through a
+ * hash of their grid cell, and indexed once. Each monotone chain then
+ * looks up the hot pixels it may cross, so that a segment string only
+ * receives the nodes computed for its own chains.
+ *
+ * Both the search for interior intersections and the snapping work
+ * on chunks of chains and segment strings which can be shared between
+ * several threads (see {@link setNumThreads}); the nodes computed are
+ * the same whatever the number of threads.
+ *
+ * The precision model must be fixed, and the input vertices should be
+ * rounded to it.
+ */
+class GEOS_DLL SnapRoundingNoder: public Noder {
+
+public:
+
+    /**
+     * @param pm the fixed precision model to round to.
+     *        Ownership left to caller, must outlive this noder.
+     */
+    SnapRoundingNoder(const geom::PrecisionModel& pm);
+
+    ~SnapRoundingNoder() override;
+
+    /**
+     * Sets the maximum number of threads used by {@link computeNodes},
+     * including the calling one. Defaults to 1.
+     *
+     * @param n the maximum number of threads, 0 meaning
+     *          std::thread::hardware_concurrency()
+     */
+    void setNumThreads(std::size_t n);
+
+    /**
+     * @param segStrings the segment strings to node.
+     *        NOTE: they *must* be instances of NodedSegmentString, or
+     *        an assertion will fail.
+     */
+    void computeNodes(std::vector<SegmentString*>* segStrings) override;
+
+    std::vector<SegmentString*>* getNodedSubstrings() const override;
+
+private:
+
+    /// externally owned
+    const geom::PrecisionModel& pm;
+
+    double scaleFactor;
+
+    std::size_t numThreads;
+
+    std::vector<SegmentString*>* nodedSegStrings;
+
+    // Declare type as noncopyable
+    SnapRoundingNoder(const SnapRoundingNoder& other) = delete;
+    SnapRoundingNoder& operator=(const SnapRoundingNoder& rhs) = delete;
+};
+
+} // namespace geos::noding::snapround
+} // namespace geos::noding
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_NODING_SNAPROUND_SNAPROUNDINGNODER_H
@@ -23,6 +23,7 @@
 #include <geos/export.h>
 #include <geos/algorithm/LineIntersector.h> // for composition
 
+#include <cstddef>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -66,6 +67,16 @@ public:
 
     const geom::Geometry* getArgGeometry(unsigned int i) const;
 
+    /**
+     * Sets the maximum number of threads used to intersect the edges
+     * of the argument graphs, including the calling one. Defaults to 1.
+     *
+     * @param n the maximum number of threads, 0 meaning
+     *          std::thread::hardware_concurrency()
+     * @see geomgraph::GeometryGraph::setNumThreads
+     */
+    void setNumThreads(std::size_t n);
+
 protected:
 
     algorithm::LineIntersector li;
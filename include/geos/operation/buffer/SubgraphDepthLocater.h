@@ -21,6 +21,8 @@
 
 #include <geos/export.h>
 
+#include <cstddef>
+#include <memory>
 #include <vector>
 
 #include <geos/geom/LineSegment.h> // for composition
@@ -33,6 +35,11 @@ class Coordinate;
 namespace geomgraph {
 class DirectedEdge;
 }
+namespace index {
+namespace intervalrtree {
+class SortedPackedIntervalRTree;
+}
+}
 namespace operation {
 namespace buffer {
 class BufferSubgraph;
@@ -55,26 +62,62 @@ namespace buffer { // geos.operation.buffer
  * The input subgraphs are assumed to have had depths
  * already calculated for their edges.
  *
+ * A locater can either scan a set of subgraphs, or index the segments
+ * of all the subgraphs of a buffer once, by their y extent, and find
+ * those crossing the stabbing line of each query in logarithmic time.
  */
 class GEOS_DLL SubgraphDepthLocater {
 
 public:
 
-    SubgraphDepthLocater(std::vector<BufferSubgraph*>* newSubgraphs)
-        :
-        subgraphs(newSubgraphs)
-    {}
+    /// Creates a locater scanning the given subgraphs
+    SubgraphDepthLocater(std::vector<BufferSubgraph*>* newSubgraphs);
 
-    ~SubgraphDepthLocater() {}
+    /**
+     * Creates a locater indexing the segments of the given subgraphs,
+     * to be queried with getDepth(const geom::Coordinate&, std::size_t).
+     *
+     * @param allSubgraphs the subgraphs, in the order their depths are
+     *        computed. They must stay alive as long as this locater.
+     */
+    SubgraphDepthLocater(const std::vector<BufferSubgraph*>& allSubgraphs);
+
+    ~SubgraphDepthLocater();
 
     int getDepth(const geom::Coordinate& p);
 
+    /**
+     * Computes the depth of a point among the first subgraphs given
+     * to the indexing constructor, which must have had their depths
+     * calculated.
+     *
+     * @param p the point to locate
+     * @param numSubgraphs the number of subgraphs to consider
+     */
+    int getDepth(const geom::Coordinate& p, std::size_t numSubgraphs);
+
 private:
 
+    /// A non-horizontal segment of a forward DirectedEdge
+    struct IndexedSegment {
+        geomgraph::DirectedEdge* dirEdge;
+        std::size_t segIndex;
+        std::size_t subgraphIndex;
+    };
+
     std::vector<BufferSubgraph*>* subgraphs;
 
     geom::LineSegment seg;
 
+    /// The indexed segments, in the order a scan would find them
+    std::vector<IndexedSegment> segments;
+
+    std::unique_ptr<index::intervalrtree::SortedPackedIntervalRTree> segmentIndex;
+
+    const std::vector<BufferSubgraph*>* indexedSubgraphs;
+
+    int getDepth(std::vector<DepthSegment*>& stabbedSegments);
+
     /**
      * Finds all non-horizontal segments intersecting the stabbing line.
      * The stabbing line is the ray to the right of stabbingRayLeftPt.
@@ -112,6 +155,19 @@ private:
                              geomgraph::DirectedEdge* dirEdge,
                              std::vector<DepthSegment*>& stabbedSegments);
 
+    /**
+     * Adds segment segIndex of dirEdge to stabbedSegments
+     * if it intersects the stabbing line.
+     */
+    void findStabbedSegment(const geom::Coordinate& stabbingRayLeftPt,
+                            geomgraph::DirectedEdge* dirEdge,
+                            std::size_t segIndex,
+                            std::vector<DepthSegment*>& stabbedSegments);
+
+    // Declare type as noncopyable
+    SubgraphDepthLocater(const SubgraphDepthLocater& other) = delete;
+    SubgraphDepthLocater& operator=(const SubgraphDepthLocater& rhs) = delete;
+
 };
 
 
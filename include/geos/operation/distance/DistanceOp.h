@@ -25,6 +25,7 @@
 #include <geos/algorithm/PointLocator.h> // for composition
 
 #include <array>
+#include <cstddef>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -67,13 +68,20 @@ namespace distance { // geos::operation::distance
  * the coordinate computed is a close
  * approximation to the exact point.
  *
- * The algorithms used are straightforward O(n^2)
- * comparisons.  This worst-case performance could be improved on
- * by using Voronoi techniques or spatial indexes.
+ * The facets of small geometries are compared with straightforward
+ * O(n^2) loops. When the product of the numbers of points of the
+ * geometries exceeds INDEXED_FACET_THRESHOLD, their facets are
+ * compared through the STR-trees of IndexedFacetDistance instead.
  *
  */
 class GEOS_DLL DistanceOp {
 public:
+    /**
+     * Product of the numbers of points of the two geometries above
+     * which their facets are compared through spatial indexes.
+     */
+    static const std::size_t INDEXED_FACET_THRESHOLD = 2500;
+
     /**
      * \brief
      * Compute the distance between the nearest points of two geometries.
@@ -96,10 +104,16 @@ public:
      * Test whether two geometries lie within a given distance of
      * each other.
      *
+     * Geometries whose envelopes are further apart are rejected first.
+     * Above INDEXED_FACET_THRESHOLD, the search through the facet
+     * indexes stops at the first pair of facets within the distance,
+     * without looking for the nearest one.
+     *
      * @param g0 a {@link Geometry}
      * @param g1 another {@link Geometry}
      * @param distance the distance to test
-     * @return true if g0.distance(g1) <= distance
+     * @return true if g0.distance(g1) <= distance,
+     *         false if either geometry is empty
      */
     static bool isWithinDistance(const geom::Geometry& g0,
                                  const geom::Geometry& g1,
@@ -229,6 +243,11 @@ private:
 
     void computeMinDistance();
 
+    /**
+     * Finds a vertex of either geometry inside an area of the other
+     * one, setting the distance to 0. Such geometries are at distance
+     * 0 though their facets may not meet.
+     */
     void computeContainmentDistance();
 
     void computeInside(std::vector<GeometryLocation*>* locs,
@@ -245,6 +264,19 @@ private:
      */
     void computeFacetDistance();
 
+    /**
+     * Computes distance between facets of input geometries
+     * using the nearest pair of their indexed facet sequences.
+     */
+    void computeFacetDistanceIndexed();
+
+    /**
+     * Tests whether the geometries are within terminateDistance,
+     * computing the nearest points only when the facets are not
+     * indexed.
+     */
+    bool isWithinTerminateDistance();
+
     void computeMinDistanceLines(
         const std::vector<const geom::LineString*>& lines0,
         const std::vector<const geom::LineString*>& lines1,
@@ -22,12 +22,16 @@
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Envelope.h>
 #include <geos/geom/Coordinate.h>
+#include <geos/operation/distance/GeometryLocation.h>
+
+#include <vector>
 
 namespace geos {
 namespace operation {
 namespace distance {
 class FacetSequence {
 private:
+    const geom::Geometry* geom;
     const geom::CoordinateSequence* pts;
     const size_t start;
     const size_t end;
@@ -37,9 +41,14 @@ private:
      * */
     geom::Envelope env;
 
-    double computeLineLineDistance(const FacetSequence& facetSeq) const;
+    double computeLineLineDistance(const FacetSequence& facetSeq,
+                                   std::vector<GeometryLocation>* locs) const;
+
+    double computePointLineDistance(const geom::Coordinate& pt, const FacetSequence& facetSeq,
+                                    std::vector<GeometryLocation>* locs) const;
 
-    double computePointLineDistance(const geom::Coordinate& pt, const FacetSequence& facetSeq) const;
+    double computeDistance(const FacetSequence& facetSeq,
+                           std::vector<GeometryLocation>* locs) const;
 
     void computeEnvelope();
 
@@ -54,7 +63,28 @@ public:
 
     double distance(const FacetSequence& facetSeq) const;
 
+    /**
+     * Computes the locations of the nearest points of this sequence
+     * and another one.
+     *
+     * The component of the locations is the geometry the sequences
+     * were built from, and their segment index is relative to its
+     * coordinates.
+     *
+     * @param facetSeq the other sequence
+     * @return the location on this sequence, then on the other one
+     */
+    std::vector<GeometryLocation> nearestLocations(const FacetSequence& facetSeq) const;
+
     FacetSequence(const geom::CoordinateSequence* pts, size_t start, size_t end);
+
+    /**
+     * Creates a sequence of a section of the coordinates of a
+     * LineString or Point, which is reported as the component
+     * of its nearest locations.
+     */
+    FacetSequence(const geom::Geometry* geom, const geom::CoordinateSequence* pts,
+                  size_t start, size_t end);
 };
 
 }
@@ -20,23 +20,128 @@
 #define GEOS_INDEXEDFACETDISTANCE_H
 
 #include <geos/operation/distance/FacetSequenceTreeBuilder.h>
+#include <geos/operation/distance/GeometryLocation.h>
+
+#include <memory>
+#include <vector>
 
 namespace geos {
 namespace operation {
 namespace distance {
+
+/** \brief
+ * Computes the distance and nearest points between the linework of
+ * geometries, using the STR-trees of their facet sequences.
+ *
+ * The tree of the geometry given to the constructor is cached, so
+ * that it can be compared with many others. The nearest pair of
+ * sequences is found by a branch-and-bound search over both trees,
+ * which skips the pairs of nodes whose envelopes are further apart
+ * than the nearest pair found so far.
+ *
+ * Only the facets (line segments and points) are compared: the
+ * distance to a point inside a polygon is its distance to the
+ * polygon boundary.
+ */
 class GEOS_DLL IndexedFacetDistance {
 public:
+    /**
+     * @param g the geometry to index, which must outlive this object
+     */
     IndexedFacetDistance(const geom::Geometry* g) :
+        baseGeometry(g),
         cachedTree(FacetSequenceTreeBuilder::build(g))
     {}
 
     static double distance(const geom::Geometry* g1, const geom::Geometry* g2);
 
+    /**
+     * Computes the nearest points of the facets of two geometries.
+     *
+     * @param g1 a geometry
+     * @param g2 another geometry
+     * @return the nearest point of g1, then of g2, or null if
+     *         either geometry has no facets
+     */
+    static std::unique_ptr<geom::CoordinateSequence> nearestPoints(
+        const geom::Geometry* g1, const geom::Geometry* g2);
+
     double getDistance(const geom::Geometry* g) const;
 
+    /**
+     * Computes the locations of the nearest points of the facets of
+     * the cached geometry and of another geometry.
+     *
+     * @param g the geometry to compare with
+     * @return the location on the cached geometry, then on g, or
+     *         an empty vector if either geometry has no facets
+     */
+    std::vector<GeometryLocation> nearestLocations(const geom::Geometry* g) const;
+
+    /**
+     * Computes the locations of the nearest points of the facets of
+     * the cached geometry and of another geometry, and the distance
+     * between those facets as getDistance gives it.
+     *
+     * @param g the geometry to compare with
+     * @param distance set to the distance, if the locations are found
+     * @return the location on the cached geometry, then on g, or
+     *         an empty vector if either geometry has no facets
+     */
+    std::vector<GeometryLocation> nearestLocations(const geom::Geometry* g, double& distance) const;
+
+    /**
+     * Computes the nearest points of the facets of the cached geometry
+     * and of another geometry.
+     *
+     * @param g the geometry to compare with
+     * @return the nearest point of the cached geometry, then of g, or
+     *         null if either geometry has no facets
+     */
+    std::unique_ptr<geom::CoordinateSequence> nearestPoints(const geom::Geometry* g) const;
+
+    /**
+     * Tests whether the facets of the cached geometry and of another
+     * geometry are within a given distance of each other.
+     *
+     * Geometries whose envelopes are further apart are rejected
+     * before their facets are indexed. The search stops at the first
+     * pair of facet sequences within the distance, or as soon as the
+     * remaining ones are all too far.
+     *
+     * @param g the geometry to compare with
+     * @param maxDistance the distance to test
+     * @return true if the facets are within the distance, false if
+     *         either geometry has no facets
+     */
+    bool isWithinDistance(const geom::Geometry* g, double maxDistance) const;
+
+    /**
+     * Computes the nearest point of the facets of the cached geometry
+     * to a point.
+     *
+     * @param pt the point to compare with
+     * @return the nearest point, or a null coordinate if the cached
+     *         geometry has no facets
+     */
+    geom::Coordinate nearestPoint(const geom::Coordinate& pt) const;
+
+    /**
+     * Tests whether the facets of the cached geometry are within a
+     * given distance of a point.
+     *
+     * @param pt the point to compare with
+     * @param maxDistance the distance to test
+     * @return true if the facets are within the distance, false if
+     *         the cached geometry has no facets
+     */
+    bool isWithinDistance(const geom::Coordinate& pt, double maxDistance) const;
+
     ~IndexedFacetDistance();
 
 private:
+    const geom::Geometry* baseGeometry;
+
     std::unique_ptr<geos::index::strtree::STRtree> cachedTree;
 
 };
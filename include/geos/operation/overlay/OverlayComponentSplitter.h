@@ -0,0 +1,142 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OP_OVERLAY_OVERLAYCOMPONENTSPLITTER_H
+#define GEOS_OP_OVERLAY_OVERLAYCOMPONENTSPLITTER_H
+
+#include <geos/export.h>
+#include <geos/operation/overlay/OverlayOp.h> // for OpCode
+
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace overlay { // geos::operation::overlay
+
+/** \brief
+ * Splits the components of two polygonal overlay operands into the
+ * ones which may interact with the rest of the operands, and the ones
+ * which cannot, so that only the former go through the overlay graph.
+ *
+ * A component is left out of the overlay, or disjoint, if its envelope
+ * meets no component of the other operand. Such a component is never
+ * part of an intersection, nor of a difference if it belongs to the
+ * second operand, and is then dropped as it is. Otherwise it is part
+ * of the result, and is only copied there if the overlay would output
+ * it unchanged: its envelope must meet no other component of its own
+ * operand, which the overlay would dissolve with it, and its
+ * coordinates must already be precise in the PrecisionModel of the
+ * first operand. Components are not validated: as with the other
+ * overlay operations, the operands are expected to be valid. A copied
+ * component has its shell clockwise and its holes counter-clockwise,
+ * as the overlay builds them.
+ *
+ * The envelopes of the components of one operand are indexed in an
+ * STR-tree and queried with those of the other, and the components
+ * of an operand are only indexed against each other when some of
+ * them may be copied.
+ *
+ * Only Polygon and MultiPolygon operands are split, as the components
+ * of other geometries may interact with each other in the overlay
+ * (e.g. crossing lines are noded). Components of the other kinds
+ * of geometries are all reported as interacting.
+ */
+class GEOS_DLL OverlayComponentSplitter {
+
+public:
+
+    /** \brief
+     * Computes the overlay of two geometries, only overlaying the
+     * components of each which may interact with the rest.
+     *
+     * Gives the same result as OverlayOp::overlayOp, up to the order
+     * of the polygons. The overlay goes through geom::BinaryOp; if it
+     * fails on the interacting components, the whole operands are
+     * overlaid instead.
+     *
+     * @param g0 the first operand
+     * @param g1 the second operand
+     * @param opCode the overlay operation
+     * @return the result of the overlay
+     */
+    static std::unique_ptr<geom::Geometry> overlay(const geom::Geometry* g0,
+            const geom::Geometry* g1, OverlayOp::OpCode opCode);
+
+    /**
+     * @param g0 the first operand, kept by reference
+     * @param g1 the second operand, kept by reference
+     * @param opCode the overlay operation
+     */
+    OverlayComponentSplitter(const geom::Geometry& g0,
+                             const geom::Geometry& g1,
+                             OverlayOp::OpCode opCode);
+
+    /// Whether some non-empty component is left out of the overlay
+    bool hasDisjointComponents() const;
+
+    /** \brief
+     * Gets the components of an operand which go through the overlay.
+     *
+     * @param geomIndex 0 for the first operand, 1 for the second
+     * @return a copy of the interacting components, empty if none
+     */
+    std::unique_ptr<geom::Geometry> getInteracting(int geomIndex) const;
+
+    /** \brief
+     * Adds the disjoint components which belong to the result of the
+     * operation to the overlay of the interacting components.
+     *
+     * @param interactingResult the overlay of the interacting
+     *        components, or null if there are none
+     * @return the result of the overlay of the operands, an empty
+     *         geometry of the type OverlayOp gives if there is none
+     */
+    std::unique_ptr<geom::Geometry> combine(
+        std::unique_ptr<geom::Geometry> interactingResult) const;
+
+private:
+
+    const geom::Geometry* operands[2];
+
+    OverlayOp::OpCode opCode;
+
+    /// Whether the disjoint components of an operand are in the result
+    bool isKept(int geomIndex) const;
+
+    /// Whether each component of each operand goes through the overlay
+    std::vector<bool> interacting[2];
+
+    void addDisjoint(int geomIndex, std::vector<geom::Geometry*>& parts) const;
+};
+
+} // namespace geos::operation::overlay
+} // namespace geos::operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_OP_OVERLAY_OVERLAYCOMPONENTSPLITTER_H
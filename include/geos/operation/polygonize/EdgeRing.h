@@ -139,6 +139,15 @@ public:
      */
     void add(const planargraph::DirectedEdge* de);
 
+    /** \brief
+     * Gets the DirectedEdges forming this ring, in ring order.
+     */
+    const std::vector<const planargraph::DirectedEdge*>&
+    getEdges() const
+    {
+        return deList;
+    }
+
     /** \brief
      * Tests whether this ring is a hole.
      *
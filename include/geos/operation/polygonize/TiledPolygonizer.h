@@ -0,0 +1,142 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OP_POLYGONIZE_TILEDPOLYGONIZER_H
+#define GEOS_OP_POLYGONIZE_TILEDPOLYGONIZER_H
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h> // for composition
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class LineString;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace polygonize { // geos::operation::polygonize
+
+/** \brief
+ * Polygonizes correctly noded linework tile by tile, so that the
+ * polygonization graph never holds more than the edges of a few tiles.
+ *
+ * Gives the same polygons as {@link Polygonizer}, streamed to a
+ * callback instead of collected.
+ *
+ * The extent of the linework is cut into square tiles. Each tile is
+ * polygonized on its own, from the edges whose envelope intersects it,
+ * and keeps the polygons whose shell lies strictly inside the tile:
+ * every node of such a shell has all its edges in the tile, so the
+ * shell and its holes are the ones the whole graph would give.
+ *
+ * The polygons which cross or touch a tile boundary are stitched
+ * together at the end, by polygonizing the edges which were not used
+ * on both sides by the polygons already found.
+ *
+ * Tiles can be polygonized on several threads (see
+ * {@link setNumThreads}); the polygons are handed to the callback on
+ * the calling thread, in the same order whatever the number of threads.
+ *
+ * The input geometries are not copied, and must outlive the
+ * TiledPolygonizer. Unlike {@link Polygonizer}, dangles, cut edges
+ * and invalid rings are not reported.
+ */
+class GEOS_DLL TiledPolygonizer {
+
+public:
+
+    /// Receives each polygon found, with its ownership
+    typedef std::function<void(std::unique_ptr<geom::Polygon>)> PolygonSink;
+
+    /**
+     * @param tileSize the width and height of the tiles,
+     *        in coordinate units. Must be positive.
+     */
+    TiledPolygonizer(double tileSize);
+
+    ~TiledPolygonizer();
+
+    /**
+     * Sets the maximum number of threads used by {@link polygonize},
+     * including the calling one. Defaults to 1.
+     *
+     * @param n the maximum number of threads, 0 meaning
+     *          std::thread::hardware_concurrency()
+     */
+    void setNumThreads(std::size_t n);
+
+    /** \brief
+     * Adds the linework of a geometry to be polygonized.
+     *
+     * May be called multiple times. Any dimension of Geometry may be
+     * added; the constituent linework will be extracted and used.
+     *
+     * @param g a Geometry with linework to be polygonized.
+     *        Ownership left to caller, must outlive this object.
+     */
+    void add(const geom::Geometry* g);
+
+    /** \brief
+     * Polygonizes the linework added so far.
+     *
+     * @param sink called with each polygon formed, as soon as the
+     *        tiles it depends on are done
+     */
+    void polygonize(const PolygonSink& sink);
+
+private:
+
+    double tileSize;
+
+    std::size_t numThreads;
+
+    std::vector<const geom::LineString*> lines;
+
+    geom::Envelope extent;
+
+    std::size_t nTilesX;
+
+    std::size_t nTilesY;
+
+    geom::Envelope getTileEnvelope(std::size_t ix, std::size_t iy) const;
+
+    /// Whether the envelope is in the interior of a single tile
+    bool isInsideTile(const geom::Envelope& env) const;
+
+    // Declare type as noncopyable
+    TiledPolygonizer(const TiledPolygonizer& other) = delete;
+    TiledPolygonizer& operator=(const TiledPolygonizer& rhs) = delete;
+};
+
+} // namespace geos::operation::polygonize
+} // namespace geos::operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_OP_POLYGONIZE_TILEDPOLYGONIZER_H
@@ -0,0 +1,134 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OP_PREDICATE_SPATIALJOIN_H
+#define GEOS_OP_PREDICATE_SPATIALJOIN_H
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace predicate { // geos::operation::predicate
+
+/** \brief
+ * Finds the pairs of geometries of two collections which satisfy
+ * a spatial predicate.
+ *
+ * The right-hand geometries are indexed in a
+ * {@link index::strtree::PackedSTRtree}. Each left-hand geometry is
+ * prepared once (see {@link geom::prep::PreparedGeometryFactory}) and
+ * tested against the right-hand geometries whose envelope it
+ * intersects. The left-hand geometries can be shared between several
+ * threads (see {@link setNumThreads}); the result is the same whatever
+ * the number of threads.
+ *
+ * The geometries must not be modified, nor used from other threads,
+ * during the join.
+ */
+class GEOS_DLL SpatialJoin {
+
+public:
+
+    /// The predicates that a pair (left, right) can be tested for
+    enum Predicate {
+        /// left intersects right
+        INTERSECTS,
+        /// left contains right
+        CONTAINS,
+        /// left covers right
+        COVERS,
+        /// left is within the given distance of right
+        WITHIN_DISTANCE
+    };
+
+    typedef std::pair<std::size_t, std::size_t> IndexPair;
+
+    /**
+     * \brief
+     * Creates a join of two collections of geometries.
+     *
+     * Null and empty geometries never satisfy the predicates.
+     *
+     * @param left the geometries to be prepared
+     * @param right the geometries to be indexed
+     *
+     * Ownership of the vectors and of the geometries is left to the caller.
+     */
+    SpatialJoin(const std::vector<const geom::Geometry*>& left,
+                const std::vector<const geom::Geometry*>& right);
+
+    /**
+     * Sets the maximum number of threads used by {@link join},
+     * including the calling one. Defaults to 1.
+     *
+     * @param n the maximum number of threads, 0 meaning
+     *          std::thread::hardware_concurrency()
+     */
+    void setNumThreads(std::size_t n);
+
+    /**
+     * \brief
+     * Computes the pairs of geometries satisfying a predicate.
+     *
+     * @param pred the predicate to test
+     * @param distance the distance for {@link WITHIN_DISTANCE}, ignored
+     *        by the other predicates
+     * @return the pairs (i, j) for which <code>pred(left[i], right[j])</code>
+     *         holds, sorted by i, then by j
+     */
+    std::vector<IndexPair> join(Predicate pred, double distance = 0.0) const;
+
+    /// Convenience function, see {@link join}
+    static std::vector<IndexPair> join(
+        const std::vector<const geom::Geometry*>& left,
+        const std::vector<const geom::Geometry*>& right,
+        Predicate pred, double distance = 0.0,
+        std::size_t numThreads = 1);
+
+private:
+
+    const std::vector<const geom::Geometry*>& left;
+
+    const std::vector<const geom::Geometry*>& right;
+
+    std::size_t numThreads;
+
+    // Declare type as noncopyable
+    SpatialJoin(const SpatialJoin& other) = delete;
+    SpatialJoin& operator=(const SpatialJoin& rhs) = delete;
+};
+
+} // namespace geos::operation::predicate
+} // namespace geos::operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_OP_PREDICATE_SPATIALJOIN_H
@@ -30,6 +30,7 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -78,8 +79,30 @@ public:
     ~RelateComputer();
 
     geom::IntersectionMatrix* computeIM();
+
+    /** \brief
+     * Tells whether the IntersectionMatrix matches any of the given
+     * patterns, computing only as much of it as needed.
+     *
+     * The entries of the matrix only grow while it is computed, and
+     * are bounded by the dimensions of the geometries; the computation
+     * stops as soon as these bounds decide the match (e.g. the first
+     * proper intersection of two areas tells that their interiors
+     * intersect).
+     *
+     * @param patterns the patterns, as in IntersectionMatrix::matches
+     * @return true if the matrix matches one of the patterns
+     */
+    bool matches(const std::vector<std::string>& patterns);
+
 private:
 
+    enum PatternMatch {
+        MATCH_UNKNOWN,
+        MATCH_FALSE,
+        MATCH_TRUE
+    };
+
     algorithm::LineIntersector li;
 
     algorithm::PointLocator ptLocator;
@@ -94,6 +117,9 @@ private:
 
     std::vector<geomgraph::Edge*> isolatedEdges;
 
+    /// the patterns to match, or null if the whole matrix is wanted
+    const std::vector<std::string>* patterns;
+
     /// the intersection point found (if any)
     geom::Coordinate invalidPoint;
 
@@ -103,6 +129,19 @@ private:
         geomgraph::index::SegmentIntersector* intersector,
         geom::IntersectionMatrix* imX);
 
+    void computeProperIntersectionIM(bool hasProper,
+                                     bool hasProperInterior,
+                                     geom::IntersectionMatrix* imX);
+
+    /**
+     * Tells whether the patterns match whatever the entries still to
+     * be computed, taking imX as a lower bound of the matrix.
+     */
+    PatternMatch matchPatterns(const geom::IntersectionMatrix& imX) const;
+
+    /// Whether the patterns to match are decided by the matrix computed so far
+    bool isMatchDecided() const;
+
     void copyNodesAndLabels(int argIndex);
     void computeIntersectionNodes(int argIndex);
     void labelIntersectionNodes(int argIndex);
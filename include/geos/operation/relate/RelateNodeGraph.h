@@ -73,8 +73,7 @@ public:
 
     virtual ~RelateNodeGraph();
 
-    std::map<geom::Coordinate*, geomgraph::Node*,
-        geom::CoordinateLessThen>& getNodeMap();
+    geomgraph::NodeMap& getNodeMap();
 
     void build(geomgraph::GeometryGraph* geomGraph);
 
@@ -24,6 +24,9 @@
 #include <geos/operation/GeometryGraphOperation.h> // for inheritance
 #include <geos/operation/relate/RelateComputer.h> // for composition
 
+#include <string>
+#include <vector>
+
 // Forward declarations
 namespace geos {
 namespace algorithm {
@@ -90,6 +93,27 @@ public:
         const geom::Geometry* b,
         const algorithm::BoundaryNodeRule& boundaryNodeRule);
 
+    /** \brief
+     * Tells whether the geom::IntersectionMatrix for the spatial
+     * relationship between two geom::Geometry objects matches any
+     * of the given patterns, using the default (OGC SFS) Boundary
+     * Node Rule.
+     *
+     * Only computes as much of the matrix as is needed to decide;
+     * see RelateComputer::matches.
+     *
+     * @param a a Geometry to test. Ownership left to caller.
+     * @param b a Geometry to test. Ownership left to caller.
+     * @param patterns the patterns, as in
+     *        geom::IntersectionMatrix::matches
+     *
+     * @return true if the matrix matches one of the patterns
+     */
+    static bool matches(
+        const geom::Geometry* a,
+        const geom::Geometry* b,
+        const std::vector<std::string>& patterns);
+
     /** \brief
      * Creates a new Relate operation, using the default (OGC SFS)
      * Boundary Node Rule.
@@ -124,6 +148,18 @@ public:
      */
     geom::IntersectionMatrix* getIntersectionMatrix();
 
+    /** \brief
+     * Tells whether the geom::IntersectionMatrix for the spatial
+     * relationship between the input geometries matches any of the
+     * given patterns.
+     *
+     * @param patterns the patterns, as in
+     *        geom::IntersectionMatrix::matches
+     *
+     * @return true if the matrix matches one of the patterns
+     */
+    bool matches(const std::vector<std::string>& patterns);
+
 private:
 
     RelateComputer relateComp;
@@ -25,6 +25,9 @@
 
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <future>
 #include <memory>
 
 #include "GeometryListHolder.h"
@@ -67,12 +70,23 @@ namespace geounion {  // geos::operation::geounion
  * The best case for buffer(0) is the trivial case
  * where there is <i>no</i> overlap between the input geometries.
  * However, this case is likely rare in practice.
+ *
+ * The subtrees of the cascade are independent of each other, so they
+ * can optionally be unioned on several threads
+ * (see {@link setNumThreads}).
+ * The tree is the same whatever the number of threads, and so is
+ * the result.
  */
 class GEOS_DLL CascadedPolygonUnion {
 private:
     std::vector<geom::Polygon*>* inputPolys;
     geom::GeometryFactory const* geomFactory;
 
+    std::size_t numThreads;
+
+    /// Number of threads which can still be started, see forkUnion()
+    std::atomic<std::size_t> spareThreads;
+
     /**
      * The effectiveness of the index is somewhat sensitive
      * to the node capacity.
@@ -110,6 +124,19 @@ public:
      */
     static geom::Geometry* Union(std::vector<geom::Polygon*>* polys);
 
+    /**
+     * Computes the union of
+     * a collection of {@link Polygonal} {@link Geometry}s,
+     * using up to <code>numThreads</code> threads.
+     *
+     * @param polys a collection of {@link Polygonal} {@link Geometry}s.
+     *        ownership of elements _and_ vector are left to caller.
+     * @param numThreads the maximum number of threads to use,
+     *        including the calling one
+     */
+    static geom::Geometry* Union(std::vector<geom::Polygon*>* polys,
+                                 std::size_t numThreads);
+
     /**
      * Computes the union of a set of {@link Polygonal} {@link Geometry}s.
      *
@@ -147,9 +174,24 @@ public:
      */
     CascadedPolygonUnion(std::vector<geom::Polygon*>* polys)
         : inputPolys(polys),
-          geomFactory(nullptr)
+          geomFactory(nullptr),
+          numThreads(1),
+          spareThreads(0)
     {}
 
+    /**
+     * Sets the maximum number of threads used by {@link Union()},
+     * including the calling one. Defaults to 1, which does all the
+     * work on the calling thread.
+     *
+     * The input geometries must not be accessed by other threads
+     * while the union is computed.
+     *
+     * @param n the maximum number of threads, 0 meaning
+     *          std::thread::hardware_concurrency()
+     */
+    void setNumThreads(std::size_t n);
+
     /**
      * Computes the union of the input geometries.
      *
@@ -161,6 +203,17 @@ public:
 private:
     geom::Geometry* unionTree(index::strtree::ItemsList* geomTree);
 
+    /**
+     * Runs <code>unionFn</code> on a new thread, if the thread budget
+     * allows it.
+     *
+     * @return the future result of unionFn, or an invalid future if
+     *         no spare thread is left or none could be started, in
+     *         which case the caller does the work itself
+     */
+    std::future<std::unique_ptr<geom::Geometry>> forkUnion(
+        std::function<geom::Geometry*()> unionFn);
+
     /**
      * Unions a list of geometries
      * by treating the list as a flattened binary tree,
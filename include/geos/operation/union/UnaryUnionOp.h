@@ -112,7 +112,8 @@ public:
     template <class T>
     UnaryUnionOp(const T& geoms, geom::GeometryFactory& geomFactIn)
         :
-        geomFact(&geomFactIn)
+        geomFact(&geomFactIn),
+        numThreads(1)
     {
         extractGeoms(geoms);
     }
@@ -120,14 +121,16 @@ public:
     template <class T>
     UnaryUnionOp(const T& geoms)
         :
-        geomFact(nullptr)
+        geomFact(nullptr),
+        numThreads(1)
     {
         extractGeoms(geoms);
     }
 
     UnaryUnionOp(const geom::Geometry& geom)
         :
-        geomFact(geom.getFactory())
+        geomFact(geom.getFactory()),
+        numThreads(1)
     {
         extract(geom);
     }
@@ -144,6 +147,21 @@ public:
      */
     std::unique_ptr<geom::Geometry> Union();
 
+    /**
+     * Sets the maximum number of threads used to union the polygonal
+     * components, including the calling one.
+     * Defaults to 1. The result is the same whatever the number of threads.
+     *
+     * @param n the maximum number of threads, 0 meaning
+     *          std::thread::hardware_concurrency()
+     * @see CascadedPolygonUnion::setNumThreads
+     */
+    void
+    setNumThreads(std::size_t n)
+    {
+        numThreads = n;
+    }
+
 private:
 
     template <typename T>
@@ -217,6 +235,8 @@ private:
 
     const geom::GeometryFactory* geomFact;
 
+    std::size_t numThreads;
+
     std::unique_ptr<geom::Geometry> empty;
 };
 
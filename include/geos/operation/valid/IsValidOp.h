@@ -25,6 +25,8 @@
 
 #include <geos/operation/valid/TopologyValidationError.h> // for inlined destructor
 
+#include <cstddef>
+
 // Forward declarations
 namespace geos {
 namespace util {
@@ -145,6 +147,10 @@ private:
      * This routine relies on the fact that while polygon shells
      * may touch at one or more vertices, they cannot touch at
      * ALL vertices.
+     *
+     * A shell can only be nested in a polygon whose envelope it
+     * intersects, so the polygons are indexed by envelope and only
+     * those pairs are compared.
      */
     void checkShellsNotNested(const geom::MultiPolygon* mp,
                               geomgraph::GeometryGraph* graph);
@@ -191,6 +197,9 @@ private:
 
     bool isSelfTouchingRingFormingHoleValid;
 
+    /// See setNumThreads
+    std::size_t numThreads;
+
 public:
     /**
      * Find a point from the list of testCoords
@@ -226,7 +235,8 @@ public:
         parentGeometry(geom),
         isChecked(false),
         validErr(nullptr),
-        isSelfTouchingRingFormingHoleValid(false)
+        isSelfTouchingRingFormingHoleValid(false),
+        numThreads(1)
     {}
 
     /// TODO: validErr can't be a pointer!
@@ -272,6 +282,21 @@ public:
         isSelfTouchingRingFormingHoleValid = p_isValid;
     }
 
+    /**
+     * Sets the maximum number of threads used to find the
+     * self-intersections of the geometry, including the calling one.
+     * Defaults to 1.
+     *
+     * @param n the maximum number of threads, 0 meaning
+     *          std::thread::hardware_concurrency()
+     * @see geomgraph::GeometryGraph::setNumThreads
+     */
+    void
+    setNumThreads(std::size_t n)
+    {
+        numThreads = n;
+    }
+
 };
 
 } // namespace geos.operation.valid
@@ -18,8 +18,10 @@
 
 #include <geos/export.h>
 #include <geos/geom/Coordinate.h> // for use in container
+#include <geos/geom/CoordinateHashMap.h> // for composition
 
-#include <map>
+#include <cstddef>
+#include <utility>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -44,12 +46,28 @@ namespace planargraph { // geos.planargraph
  * \brief
  * A map of Node, indexed by the coordinate of the node.
  *
+ * Nodes are looked up through a hash of their coordinate, and
+ * iterated in the order of their coordinate (see
+ * {@link geom::CoordinateLessThen}).
+ * Nodes must not be added or removed while iterating over the map.
  */
 class GEOS_DLL NodeMap {
 public:
-    typedef std::map<geom::Coordinate, Node*, geom::CoordinateLessThen> container;
+    /// The nodes keyed by their coordinate, in coordinate order
+    typedef std::vector< std::pair<geom::Coordinate, Node*> > container;
 private:
-    container nodeMap;
+    geom::CoordinateHashMap<Node*> nodeIndex;
+
+    /// The nodes, the first nSorted of them sorted by coordinate
+    mutable container nodeMap;
+
+    mutable std::size_t nSorted;
+
+    /// Whether nodeMap still holds nodes removed since the last iteration
+    mutable bool stale;
+
+    /// Brings nodeMap up to date with the nodes added or removed
+    void prepare() const;
 public:
     /**
      * \brief Constructs a NodeMap without any Nodes.
@@ -62,9 +80,9 @@ public:
 
     /**
      * \brief
-     * Adds a node to the std::map, replacing any that is already
+     * Adds a node to the map, unless there is already one
      * at that location.
-     * @return the added node
+     * @return the given node
      */
     Node* add(Node* n);
 
@@ -91,31 +109,41 @@ public:
     container::iterator
     iterator()
     {
-        return nodeMap.begin();
+        return begin();
     }
 
     container::iterator
     begin()
     {
+        prepare();
         return nodeMap.begin();
     }
     container::const_iterator
     begin() const
     {
+        prepare();
         return nodeMap.begin();
     }
 
     container::iterator
     end()
     {
+        prepare();
         return nodeMap.end();
     }
     container::const_iterator
     end() const
     {
+        prepare();
         return nodeMap.end();
     }
 
+    std::size_t
+    size() const
+    {
+        return nodeIndex.size();
+    }
+
     /**
      * \brief
      * Returns the Nodes in this NodeMap, sorted in ascending order
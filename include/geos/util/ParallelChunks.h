@@ -0,0 +1,122 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_UTIL_PARALLELCHUNKS_H
+#define GEOS_UTIL_PARALLELCHUNKS_H
+
+#include <geos/util/Interrupt.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace geos {
+namespace util { // geos::util
+
+/** \brief
+ * Normalizes a number of threads given to a setNumThreads method:
+ * 0 means std::thread::hardware_concurrency(), and there is always
+ * at least the calling thread.
+ */
+inline std::size_t
+normalizeThreadCount(std::size_t n)
+{
+    if(n == 0) {
+        n = std::thread::hardware_concurrency();
+    }
+    return std::max<std::size_t>(n, 1);
+}
+
+/** \brief
+ * Runs <code>processChunk(chunk, worker)</code> for chunks 0 to
+ * nChunks - 1 on up to numThreads threads, the calling one included.
+ *
+ * Each thread works on its own copy of <code>protoWorker</code>, and
+ * takes the next chunk not yet taken until none is left, so chunks
+ * are started in increasing order but may end in any order.
+ *
+ * Only the calling thread runs the interruption callback (see
+ * Interrupt); the other threads stop at their next chunk when an
+ * interruption is requested, which is then raised on the calling
+ * thread.
+ *
+ * The first exception thrown by processChunk, or by the construction of
+ * a thread, keeps the remaining chunks from being started, and is
+ * rethrown on the calling thread once all the threads started have
+ * been joined.
+ */
+template<typename Worker, typename ChunkFn>
+void
+runChunks(std::size_t nChunks, std::size_t numThreads,
+          const Worker& protoWorker, ChunkFn processChunk)
+{
+    std::atomic<std::size_t> nextChunk(0);
+    std::size_t nThreads = std::max<std::size_t>(1,
+                           std::min(numThreads, nChunks));
+    std::vector<std::exception_ptr> errors(nThreads);
+
+    auto runWorker = [&](std::size_t w) {
+        try {
+            Worker worker(protoWorker);
+            for(std::size_t chunk = nextChunk++; chunk < nChunks; chunk = nextChunk++) {
+                if(w == 0) {
+                    GEOS_CHECK_FOR_INTERRUPTS();
+                }
+                else if(Interrupt::check()) {
+                    break;
+                }
+                processChunk(chunk, worker);
+            }
+        }
+        catch(...) {
+            errors[w] = std::current_exception();
+            // let the other threads run out of work
+            nextChunk = nChunks;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    try {
+        threads.reserve(nThreads - 1);
+        for(std::size_t w = 1; w < nThreads; w++) {
+            threads.emplace_back(runWorker, w);
+        }
+    }
+    catch(...) {
+        // the threads already started reference this frame
+        nextChunk = nChunks;
+        for(auto& t : threads) {
+            t.join();
+        }
+        throw;
+    }
+
+    runWorker(0);
+    for(auto& t : threads) {
+        t.join();
+    }
+    for(auto& err : errors) {
+        if(err) {
+            std::rethrow_exception(err);
+        }
+    }
+    // a thread may have stopped on an interruption request
+    GEOS_CHECK_FOR_INTERRUPTS();
+}
+
+} // namespace geos::util
+} // namespace geos
+
+#endif // GEOS_UTIL_PARALLELCHUNKS_H
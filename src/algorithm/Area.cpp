@@ -20,10 +20,31 @@
 #include <vector>
 
 #include <geos/algorithm/Area.h>
+#include <geos/geom/PackedCoordinateSequence.h>
 
 namespace geos {
 namespace algorithm { // geos.algorithm
 
+namespace {
+
+// Shoelace formula over n points packed D ordinates apart
+template<std::size_t D>
+double
+ofPackedRingSigned(const double* p, std::size_t n)
+{
+    double x0 = p[0];
+    double sum = 0.0;
+    for(std::size_t i = 1; i < n - 1; i++) {
+        double x = p[i * D] - x0;
+        double y1 = p[(i + 1) * D + 1];
+        double y2 = p[(i - 1) * D + 1];
+        sum += x * (y2 - y1);
+    }
+    return sum / 2.0;
+}
+
+}
+
 /* public static */
 double
 Area::ofRing(const std::vector<geom::Coordinate>& ring)
@@ -70,6 +91,15 @@ Area::ofRingSigned(const geom::CoordinateSequence* ring)
     if(n < 3) {
         return 0.0;
     }
+
+    const geom::PackedCoordinateSequence* packed =
+        dynamic_cast<const geom::PackedCoordinateSequence*>(ring);
+    if(packed) {
+        if(packed->getDimension() == 2) {
+            return ofPackedRingSigned<2>(packed->data(), n);
+        }
+        return ofPackedRingSigned<3>(packed->data(), n);
+    }
     /**
     * Based on the Shoelace formula.
     * http://en.wikipedia.org/wiki/Shoelace_formula
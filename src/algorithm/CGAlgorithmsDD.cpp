@@ -22,6 +22,19 @@
 #include <geos/util/IllegalArgumentException.h>
 #include <sstream>
 
+// The extended-precision engine is private to this file, so that the
+// installed headers do not depend on GEOS_USE_TTMATH
+#ifdef GEOS_USE_TTMATH
+// Multi-precision fallback, kept for validating the DoubleDouble engine.
+// Usage: ttmath::Big<exponent, mantissa>
+#include <geos/algorithm/ttmath/ttmath.h>
+typedef ttmath::Big<TTMATH_BITS(32), TTMATH_BITS(128)> DD;
+#else
+// DoubleDouble arithmetic, as used by JTS
+#include <geos/math/DD.h>
+typedef geos::math::DD DD;
+#endif
+
 using namespace geos::geom;
 using namespace geos::algorithm;
 
@@ -33,6 +46,8 @@ namespace {
  */
 double constexpr DP_SAFE_EPSILON =  1e-15;
 
+#ifdef GEOS_USE_TTMATH
+
 inline int
 OrientationDD(DD const& dd)
 {
@@ -48,10 +63,50 @@ OrientationDD(DD const& dd)
     return CGAlgorithmsDD::STRAIGHT;
 }
 
-// inline std::string ToStringDD(DD const& dd)
-// {
-//     return dd.ToString();
-// }
+inline double
+ToDoubleDD(DD const& dd)
+{
+    return dd.ToDouble();
+}
+
+inline DD
+DifferenceDD(double a, double b)
+{
+    return DD(a) + DD(-b);
+}
+
+#else
+
+inline int
+OrientationDD(DD const& dd)
+{
+    return dd.signum();
+}
+
+inline double
+ToDoubleDD(DD const& dd)
+{
+    return dd.doubleValue();
+}
+
+// The difference of two doubles is exactly representable as a DD
+inline DD
+DifferenceDD(double a, double b)
+{
+    return DD::twoSum(a, -b);
+}
+
+#endif
+
+int
+SignOfDet2x2DD(const DD& x1, const DD& y1, const DD& x2, const DD& y2)
+{
+    DD mx1y2(x1 * y2);
+    DD my1x2(y1 * x2);
+    DD d = mx1y2 - my1x2;
+    return OrientationDD(d);
+}
+
 }
 
 namespace geos {
@@ -74,10 +129,10 @@ CGAlgorithmsDD::orientationIndex(const Coordinate& p1,
     }
 
     // normalize coordinates
-    DD dx1 = DD(p2.x) + DD(-p1.x);
-    DD dy1 = DD(p2.y) + DD(-p1.y);
-    DD dx2 = DD(q.x) + DD(-p2.x);
-    DD dy2 = DD(q.y) + DD(-p2.y);
+    DD dx1 = DifferenceDD(p2.x, p1.x);
+    DD dy1 = DifferenceDD(p2.y, p1.y);
+    DD dx2 = DifferenceDD(q.x, p2.x);
+    DD dy2 = DifferenceDD(q.y, p2.y);
 
     // sign of determinant - inlined for performance
     DD mx1y2(dx1 * dy2);
@@ -86,15 +141,6 @@ CGAlgorithmsDD::orientationIndex(const Coordinate& p1,
     return OrientationDD(d);
 }
 
-int
-CGAlgorithmsDD::signOfDet2x2(DD& x1, DD& y1, DD& x2, DD& y2)
-{
-    DD mx1y2(x1 * y2);
-    DD my1x2(y1 * x2);
-    DD d = mx1y2 - my1x2;
-    return OrientationDD(d);
-}
-
 int
 CGAlgorithmsDD::signOfDet2x2(double dx1, double dy1, double dx2, double dy2)
 {
@@ -106,7 +152,7 @@ CGAlgorithmsDD::signOfDet2x2(double dx1, double dy1, double dx2, double dy2)
     DD y1(dy1);
     DD x2(dx2);
     DD y2(dy2);
-    return CGAlgorithmsDD::signOfDet2x2(x1, y1, x2, y2);
+    return SignOfDet2x2DD(x1, y1, x2, y2);
 }
 
 int
@@ -188,8 +234,8 @@ CGAlgorithmsDD::intersection(const Coordinate& p1, const Coordinate& p2,
     DD fracQ = numy / denom;
     DD y = q1y + (q2y - q1y) * fracQ;
 
-    rv.x = x.ToDouble();
-    rv.y = y.ToDouble();
+    rv.x = ToDoubleDD(x);
+    rv.y = ToDoubleDD(y);
 }
 
 
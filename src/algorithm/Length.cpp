@@ -20,10 +20,29 @@
 #include <vector>
 
 #include <geos/algorithm/Length.h>
+#include <geos/geom/PackedCoordinateSequence.h>
 
 namespace geos {
 namespace algorithm { // geos.algorithm
 
+namespace {
+
+// Length of n points packed D ordinates apart, free of virtual calls
+template<std::size_t D>
+double
+ofPackedLine(const double* p, std::size_t n)
+{
+    double len = 0.0;
+    for(std::size_t i = 1; i < n; i++) {
+        double dx = p[i * D] - p[(i - 1) * D];
+        double dy = p[i * D + 1] - p[(i - 1) * D + 1];
+        len += std::sqrt(dx * dx + dy * dy);
+    }
+    return len;
+}
+
+}
+
 /* public static */
 double
 Length::ofLine(const geom::CoordinateSequence* pts)
@@ -34,6 +53,15 @@ Length::ofLine(const geom::CoordinateSequence* pts)
         return 0.0;
     }
 
+    const geom::PackedCoordinateSequence* packed =
+        dynamic_cast<const geom::PackedCoordinateSequence*>(pts);
+    if(packed) {
+        if(packed->getDimension() == 2) {
+            return ofPackedLine<2>(packed->data(), n);
+        }
+        return ofPackedLine<3>(packed->data(), n);
+    }
+
     double len = 0.0;
 
     const geom::Coordinate& p = pts->getAt(0);
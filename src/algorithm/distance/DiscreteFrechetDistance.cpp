@@ -24,9 +24,10 @@
 
 #include <typeinfo>
 #include <cassert>
+#include <cmath>
+#include <memory>
 #include <vector>
 #include <algorithm>
-#include <iostream>
 using namespace geos::geom;
 
 namespace geos {
@@ -53,6 +54,28 @@ DiscreteFrechetDistance::distance(const geom::Geometry& g0,
     return dist.distance();
 }
 
+/* static public */
+bool
+DiscreteFrechetDistance::isWithinDistance(const geom::Geometry& g0,
+        const geom::Geometry& g1,
+        double maxDistance)
+{
+    DiscreteFrechetDistance dist(g0, g1);
+    return dist.isWithinDistance(maxDistance);
+}
+
+/* static public */
+bool
+DiscreteFrechetDistance::isWithinDistance(const geom::Geometry& g0,
+        const geom::Geometry& g1,
+        double maxDistance,
+        double densifyFrac)
+{
+    DiscreteFrechetDistance dist(g0, g1);
+    dist.setDensifyFraction(densifyFrac);
+    return dist.isWithinDistance(maxDistance);
+}
+
 /* private */
 
 geom::Coordinate
@@ -81,66 +104,145 @@ DiscreteFrechetDistance::getSegementAt(const CoordinateSequence& seq, size_t ind
     }
 }
 
-PointPairDistance&
-DiscreteFrechetDistance::getFrecheDistance(std::vector< std::vector<PointPairDistance> >& ca, size_t i, size_t j,
-        const CoordinateSequence& p, const CoordinateSequence& q)
+std::size_t
+DiscreteFrechetDistance::getNumDiscretePoints(const CoordinateSequence& seq) const
 {
-    PointPairDistance p_ptDist;
-    if(! ca[i][j].getIsNull()) {
-        return ca[i][j];
+    if(densifyFrac > 0) {
+        size_t numSubSegs =  std::size_t(util::round(1.0 / densifyFrac));
+        return numSubSegs * (seq.size() - 1) + 1;
+    }
+    return seq.size();
+}
+
+bool
+DiscreteFrechetDistance::compute(
+    const geom::Geometry& discreteGeom,
+    const geom::Geometry& geom,
+    double maxDistance)
+{
+    if(discreteGeom.isEmpty() || geom.isEmpty()) {
+        throw util::IllegalArgumentException(
+            "DiscreteFrechetDistance called with empty inputs.");
+    }
+
+    std::unique_ptr<CoordinateSequence> lp(discreteGeom.getCoordinates());
+    std::unique_ptr<CoordinateSequence> lq(geom.getCoordinates());
+    size_t pSize = getNumDiscretePoints(*lp);
+    size_t qSize = getNumDiscretePoints(*lq);
+
+    // The whole path couples the first points, then the last ones
+    if(getSegementAt(*lp, 0).distance(getSegementAt(*lq, 0)) > maxDistance
+            || getSegementAt(*lp, pSize - 1).distance(getSegementAt(*lq, qSize - 1)) > maxDistance) {
+        return false;
     }
-    p_ptDist.initialize(getSegementAt(p, i), getSegementAt(q, j));
-    if(i == 0 && j == 0) {
-        ca[i][j] = ptDist;
+
+    // The rows go along the longer sequence, and the columns along
+    // the shorter one, whose points are computed once
+    bool isTransposed = qSize > pSize;
+    const CoordinateSequence& rowSeq = isTransposed ? *lq : *lp;
+    const CoordinateSequence& colSeq = isTransposed ? *lp : *lq;
+    size_t numRows = std::max(pSize, qSize);
+    size_t numCols = std::min(pSize, qSize);
+
+    std::vector<Coordinate> colPts(numCols);
+    for(size_t j = 0; j < numCols; j++) {
+        colPts[j] = getSegementAt(colSeq, j);
     }
-    else if(i > 0 && j == 0) {
-        PointPairDistance nextDist = getFrecheDistance(ca, i - 1, 0, p, q);
-        ca[i][j] = (nextDist.getDistance() > p_ptDist.getDistance()) ? nextDist : p_ptDist;
+
+    // The band is centered on the diagonal of the coupling matrix
+    double bandWidth = static_cast<double>(numCols);
+    double slope = 0.0;
+    if(bandFrac > 0) {
+        bandWidth = bandFrac * static_cast<double>(numCols - 1);
     }
-    else if(i == 0 && j > 0) {
-        PointPairDistance nextDist = getFrecheDistance(ca, 0, j - 1, p, q);
-        ca[i][j] = (nextDist.getDistance() > p_ptDist.getDistance()) ? nextDist : p_ptDist;
+    if(numRows > 1) {
+        slope = static_cast<double>(numCols - 1) / static_cast<double>(numRows - 1);
     }
-    else {
-        PointPairDistance d1 = getFrecheDistance(ca, i - 1, j, p, q),
-                          d2 = getFrecheDistance(ca, i - 1, j - 1, p, q),
-                          d3 = getFrecheDistance(ca, i, j - 1, p, q);
-        PointPairDistance& minDist = (d1.getDistance() < d2.getDistance()) ? d1 : d2;
-        if(d3.getDistance() < minDist.getDistance()) {
-            minDist = d3;
+
+    // Each cell holds the distance of the best coupling of the prefixes
+    // ending at its points, and the row and column of the points which
+    // are furthest apart in it
+    struct Coupling {
+        double distance;
+        size_t row;
+        size_t col;
+    };
+    std::vector<Coupling> prevRow(numCols), row(numCols);
+    size_t prevLo = 0, prevHi = 0;
+
+    for(size_t i = 0; i < numRows; i++) {
+        const Coordinate rowPt = getSegementAt(rowSeq, i);
+
+        double diag = static_cast<double>(i) * slope;
+        size_t lo = static_cast<size_t>(std::max(0.0, std::floor(diag - bandWidth)));
+        size_t hi = std::min(numCols - 1, static_cast<size_t>(std::ceil(diag + bandWidth)));
+
+        bool isRowWithin = false;
+        for(size_t j = lo; j <= hi; j++) {
+            // Same choice of predecessor as the recursive computation:
+            // (i - 1, j), then (i - 1, j - 1), then (i, j - 1)
+            const Coupling* minPred = nullptr;
+            if(i > 0 && j >= prevLo && j <= prevHi) {
+                minPred = &prevRow[j];
+            }
+            if(i > 0 && j > prevLo && j - 1 <= prevHi
+                    && (!minPred || !(minPred->distance < prevRow[j - 1].distance))) {
+                minPred = &prevRow[j - 1];
+            }
+            if(j > lo && (!minPred || row[j - 1].distance < minPred->distance)) {
+                minPred = &row[j - 1];
+            }
+
+            Coupling& cell = row[j];
+            if(i > 0 || j > 0) {
+                // out of the band, or past the threshold
+                if(!minPred || minPred->distance > maxDistance) {
+                    cell.distance = DoubleInfinity;
+                    continue;
+                }
+            }
+
+            double dist = rowPt.distance(colPts[j]);
+            if(minPred && minPred->distance > dist) {
+                cell = *minPred;
+            }
+            else {
+                cell.distance = dist;
+                cell.row = i;
+                cell.col = j;
+            }
+            if(cell.distance > maxDistance) {
+                cell.distance = DoubleInfinity;
+            }
+            else {
+                isRowWithin = true;
+            }
+        }
+
+        // Each coupling goes through each row
+        if(!isRowWithin) {
+            return false;
         }
-        ca[i][j] = (minDist.getDistance() > p_ptDist.getDistance()) ? minDist : p_ptDist;
+
+        std::swap(row, prevRow);
+        prevLo = lo;
+        prevHi = hi;
     }
 
-    return ca[i][j];
-}
+    const Coupling& last = prevRow[numCols - 1];
+    if(last.distance > maxDistance) {
+        return false;
+    }
 
-void
-DiscreteFrechetDistance::compute(
-    const geom::Geometry& discreteGeom,
-    const geom::Geometry& geom)
-{
-    const CoordinateSequence* lp = discreteGeom.getCoordinates();
-    const CoordinateSequence* lq = geom.getCoordinates();
-    size_t pSize, qSize;
-    if(densifyFrac > 0) {
-        size_t numSubSegs =  std::size_t(util::round(1.0 / densifyFrac));
-        pSize = numSubSegs * (lp->size() - 1) + 1;
-        qSize = numSubSegs * (lq->size() - 1) + 1;
+    const Coordinate rowPt = getSegementAt(rowSeq, last.row);
+    const Coordinate& colPt = colPts[last.col];
+    if(isTransposed) {
+        ptDist.initialize(colPt, rowPt);
     }
     else {
-        pSize = lp->size();
-        qSize = lq->size();
-    }
-    std::vector< std::vector<PointPairDistance> > ca(pSize, std::vector<PointPairDistance>(qSize));
-    for(size_t i = 0; i < pSize; i++) {
-        for(size_t j = 0; j < qSize; j++) {
-            ca[i][j].initialize();
-        }
+        ptDist.initialize(rowPt, colPt);
     }
-    ptDist = getFrecheDistance(ca, pSize - 1, qSize - 1, *lp, *lq);
-    delete lp;
-    delete lq;
+    return true;
 }
 
 } // namespace geos.algorithm.distance
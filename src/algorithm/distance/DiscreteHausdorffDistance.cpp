@@ -18,16 +18,163 @@
 
 #include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
 
 #include <typeinfo>
 #include <cassert>
+#include <limits>
 
 using namespace geos::geom;
+using geos::operation::distance::IndexedFacetDistance;
 
 namespace geos {
 namespace algorithm { // geos.algorithm
 namespace distance { // geos.algorithm.distance
 
+namespace {
+
+/*
+ * Finds the discrete point of a geometry furthest from the indexed
+ * facets of another one, or tests whether all of them are within a
+ * given distance of it.
+ *
+ * The distance of a point to the facets is at most the distance of
+ * the previous point plus the distance between the two points, and
+ * the points which this bound keeps within the current maximum are
+ * skipped. The others are first tested against the index with the
+ * current maximum, which is cheaper than finding their nearest facet.
+ */
+class IndexedMaxPointDistanceFilter : public CoordinateSequenceFilter {
+public:
+    IndexedMaxPointDistanceFilter(const IndexedFacetDistance& p_facetDist,
+                                  std::size_t p_numSubSegs)
+        :
+        facetDist(p_facetDist),
+        numSubSegs(p_numSubSegs),
+        hasPrevPt(false),
+        prevDistBound(0.0),
+        isThresholdTest(false),
+        threshold(0.0),
+        isThresholdExceeded(false)
+    {}
+
+    /// Only tests the points against the distance, stopping at the first further one
+    void
+    setThreshold(double maxDistance)
+    {
+        isThresholdTest = true;
+        threshold = maxDistance;
+    }
+
+    void
+    filter_ro(const CoordinateSequence& seq, std::size_t index) override
+    {
+        const Coordinate& p1 = seq.getAt(index);
+
+        // the points densifying the segment ending at this vertex
+        if(index > 0 && numSubSegs > 1) {
+            const Coordinate& p0 = seq.getAt(index - 1);
+            double delx = (p1.x - p0.x) / static_cast<double>(numSubSegs);
+            double dely = (p1.y - p0.y) / static_cast<double>(numSubSegs);
+            for(std::size_t i = 1; i < numSubSegs && !isDone(); ++i) {
+                double x = p0.x + static_cast<double>(i) * delx;
+                double y = p0.y + static_cast<double>(i) * dely;
+                add(Coordinate(x, y));
+            }
+        }
+
+        if(!isDone()) {
+            add(p1);
+        }
+    }
+
+    bool
+    isGeometryChanged() const override
+    {
+        return false;
+    }
+
+    bool
+    isDone() const override
+    {
+        return isThresholdExceeded;
+    }
+
+    const PointPairDistance&
+    getMaxPointDistance() const
+    {
+        return maxPtDist;
+    }
+
+    bool
+    isWithinThreshold() const
+    {
+        return !isThresholdExceeded;
+    }
+
+private:
+    const IndexedFacetDistance& facetDist;
+    std::size_t numSubSegs;
+
+    PointPairDistance maxPtDist;
+    PointPairDistance minPtDist;
+
+    Coordinate prevPt;
+    bool hasPrevPt;
+    // upper bound of the distance of prevPt to the facets
+    double prevDistBound;
+
+    bool isThresholdTest;
+    double threshold;
+    bool isThresholdExceeded;
+
+    void
+    add(const Coordinate& pt)
+    {
+        double distBound = std::numeric_limits<double>::infinity();
+        if(hasPrevPt) {
+            distBound = prevDistBound + prevPt.distance(pt);
+        }
+        prevPt = pt;
+        hasPrevPt = true;
+
+        if(isThresholdTest) {
+            if(distBound > threshold) {
+                if(!facetDist.isWithinDistance(pt, threshold)) {
+                    isThresholdExceeded = true;
+                    return;
+                }
+                distBound = threshold;
+            }
+            prevDistBound = distBound;
+            return;
+        }
+
+        if(!maxPtDist.getIsNull()) {
+            double maxDist = maxPtDist.getDistance();
+            if(distBound <= maxDist) {
+                prevDistBound = distBound;
+                return;
+            }
+            if(facetDist.isWithinDistance(pt, maxDist)) {
+                prevDistBound = maxDist;
+                return;
+            }
+        }
+
+        minPtDist.initialize(facetDist.nearestPoint(pt), pt);
+        maxPtDist.setMaximum(minPtDist);
+        prevDistBound = minPtDist.getDistance();
+    }
+
+    // Declare type as noncopyable
+    IndexedMaxPointDistanceFilter(const IndexedMaxPointDistanceFilter& other) = delete;
+    IndexedMaxPointDistanceFilter& operator=(const IndexedMaxPointDistanceFilter& rhs) = delete;
+};
+
+} // anonymous namespace
+
 void
 DiscreteHausdorffDistance::MaxDensifiedByFractionDistanceFilter::filter_ro(
     const geom::CoordinateSequence& seq, size_t index)
@@ -76,6 +223,86 @@ DiscreteHausdorffDistance::distance(const geom::Geometry& g0,
     return dist.distance();
 }
 
+/* static public */
+bool
+DiscreteHausdorffDistance::isWithinDistance(const geom::Geometry& g0,
+        const geom::Geometry& g1,
+        double maxDistance)
+{
+    DiscreteHausdorffDistance dist(g0, g1);
+    return dist.isWithinDistance(maxDistance);
+}
+
+/* static public */
+bool
+DiscreteHausdorffDistance::isWithinDistance(const geom::Geometry& g0,
+        const geom::Geometry& g1,
+        double maxDistance,
+        double densifyFrac)
+{
+    DiscreteHausdorffDistance dist(g0, g1);
+    dist.setDensifyFraction(densifyFrac);
+    return dist.isWithinDistance(maxDistance);
+}
+
+/* public */
+bool
+DiscreteHausdorffDistance::isWithinDistance(double maxDistance)
+{
+    if(!isIndexed(g0, g1)) {
+        return distance() <= maxDistance;
+    }
+
+    // the discrete points of each geometry lie in its envelope
+    Envelope env0(*g0.getEnvelopeInternal());
+    env0.expandBy(maxDistance);
+    Envelope env1(*g1.getEnvelopeInternal());
+    env1.expandBy(maxDistance);
+    if(!env1.covers(g0.getEnvelopeInternal()) || !env0.covers(g1.getEnvelopeInternal())) {
+        return false;
+    }
+
+    return isOrientedWithinDistance(g0, g1, maxDistance)
+           && isOrientedWithinDistance(g1, g0, maxDistance);
+}
+
+/* private */
+std::size_t
+DiscreteHausdorffDistance::getNumSubSegments() const
+{
+    if(densifyFrac > 0) {
+        return std::size_t(util::round(1.0 / densifyFrac));
+    }
+    return 1;
+}
+
+/* private */
+bool
+DiscreteHausdorffDistance::isIndexed(const geom::Geometry& discreteGeom,
+                                     const geom::Geometry& geom) const
+{
+    // the index only knows the facets of non-empty geometries
+    if(discreteGeom.isEmpty() || geom.isEmpty()) {
+        return false;
+    }
+    return discreteGeom.getNumPoints() * getNumSubSegments() * geom.getNumPoints()
+           > INDEXED_THRESHOLD;
+}
+
+/* private */
+bool
+DiscreteHausdorffDistance::isOrientedWithinDistance(
+    const geom::Geometry& discreteGeom,
+    const geom::Geometry& geom,
+    double maxDistance) const
+{
+    IndexedFacetDistance facetDist(&geom);
+    IndexedMaxPointDistanceFilter distFilter(facetDist, getNumSubSegments());
+    distFilter.setThreshold(maxDistance);
+    discreteGeom.apply_ro(distFilter);
+    return distFilter.isWithinThreshold();
+}
+
 /* private */
 void
 DiscreteHausdorffDistance::computeOrientedDistance(
@@ -83,6 +310,14 @@ DiscreteHausdorffDistance::computeOrientedDistance(
     const geom::Geometry& geom,
     PointPairDistance& p_ptDist)
 {
+    if(isIndexed(discreteGeom, geom)) {
+        IndexedFacetDistance facetDist(&geom);
+        IndexedMaxPointDistanceFilter distFilter(facetDist, getNumSubSegments());
+        discreteGeom.apply_ro(distFilter);
+        p_ptDist.setMaximum(distFilter.getMaxPointDistance());
+        return;
+    }
+
     MaxPointDistanceFilter distFilter(geom);
     discreteGeom.apply_ro(&distFilter);
     p_ptDist.setMaximum(distFilter.getMaxPointDistance());
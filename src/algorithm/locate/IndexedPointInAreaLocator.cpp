@@ -58,6 +58,10 @@ IndexedPointInAreaLocator::IntervalIndexedGeometry::init(const geom::Geometry& g
             std::max(seg.p0.y, seg.p1.y),
             &seg);
     }
+
+    // build now rather than on the first query, so that locate()
+    // may be called concurrently
+    index.init();
 }
 
 void
@@ -18,7 +18,6 @@
  *
  **********************************************************************/
 
-#include <geos/geom/BinaryOp.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/PrecisionModel.h>
@@ -46,6 +45,7 @@
 #include <geos/operation/relate/RelateOp.h>
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/operation/overlay/OverlayOp.h>
+#include <geos/operation/overlay/OverlayComponentSplitter.h>
 #include <geos/operation/union/UnaryUnionOp.h>
 #include <geos/operation/overlay/snap/SnapIfNeededOverlayOp.h>
 #include <geos/operation/buffer/BufferOp.h>
@@ -57,6 +57,7 @@
 
 #include <algorithm>
 #include <string>
+#include <thread>
 #include <typeinfo>
 #include <vector>
 #include <cassert>
@@ -108,7 +109,7 @@ Geometry::GeometryChangedFilter Geometry::geometryChangedFilter;
 
 Geometry::Geometry(const GeometryFactory* newFactory)
     :
-    envelope(nullptr),
+    envelopeState(ENVELOPE_NONE),
     _factory(newFactory),
     _userData(nullptr)
 {
@@ -121,12 +122,15 @@ Geometry::Geometry(const GeometryFactory* newFactory)
 
 Geometry::Geometry(const Geometry& geom)
     :
+    envelopeState(ENVELOPE_NONE),
     SRID(geom.getSRID()),
     _factory(geom._factory),
     _userData(nullptr)
 {
-    if(geom.envelope.get()) {
-        envelope.reset(new Envelope(*(geom.envelope)));
+    // geom may be computing its envelope on another thread
+    if(geom.envelopeState.load(std::memory_order_acquire) == ENVELOPE_COMPUTED) {
+        envelope = geom.envelope;
+        envelopeState.store(ENVELOPE_COMPUTED, std::memory_order_relaxed);
     }
     //factory=geom.factory;
     //envelope(new Envelope(*(geom.envelope.get())));
@@ -174,20 +178,7 @@ Geometry::hasNullElements(const vector<Geometry*>* lrs)
 bool
 Geometry::isWithinDistance(const Geometry* geom, double cDistance) const
 {
-    const Envelope* env0 = getEnvelopeInternal();
-    const Envelope* env1 = geom->getEnvelopeInternal();
-    double envDist = env0->distance(env1);
-    //delete env0;
-    //delete env1;
-    if(envDist > cDistance) {
-        return false;
-    }
-    // NOTE: this could be implemented more efficiently
-    double geomDist = distance(geom);
-    if(geomDist > cDistance) {
-        return false;
-    }
-    return true;
+    return DistanceOp::isWithinDistance(*this, *geom, cDistance);
 }
 
 /*public*/
@@ -266,8 +257,7 @@ Geometry::geometryChanged()
 void
 Geometry::geometryChangedAction()
 {
-    //delete envelope;
-    envelope.reset(nullptr);
+    envelopeState.store(ENVELOPE_NONE);
 }
 
 bool
@@ -285,10 +275,27 @@ Geometry::getEnvelope() const
 const Envelope*
 Geometry::getEnvelopeInternal() const
 {
-    if(!envelope.get()) {
-        envelope = computeEnvelopeInternal();
+    unsigned char state = envelopeState.load(std::memory_order_acquire);
+    while(state != ENVELOPE_COMPUTED) {
+        // The first thread to get here computes the envelope,
+        // the others wait for it to be published
+        if(state == ENVELOPE_NONE &&
+                envelopeState.compare_exchange_weak(state, ENVELOPE_COMPUTING,
+                        std::memory_order_acquire)) {
+            try {
+                envelope = computeEnvelopeInternal();
+            }
+            catch(...) {
+                envelopeState.store(ENVELOPE_NONE);
+                throw;
+            }
+            envelopeState.store(ENVELOPE_COMPUTED, std::memory_order_release);
+            break;
+        }
+        std::this_thread::yield();
+        state = envelopeState.load(std::memory_order_acquire);
     }
-    return envelope.get();
+    return &envelope;
 }
 
 bool
@@ -314,9 +321,18 @@ Geometry::touches(const Geometry* g) const
         return false;
     }
 #endif
-    unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->isTouches(getDimension(), g->getDimension());
-    return res;
+    // The patterns of IntersectionMatrix::isTouches, which never
+    // holds for two points
+    int dimA = getDimension();
+    int dimB = g->getDimension();
+    if(dimA < Dimension::P || dimB < Dimension::P
+            || (dimA == Dimension::P && dimB == Dimension::P)) {
+        return false;
+    }
+    static const vector<string> patterns {
+        "FT*******", "F**T*****", "F***T****"
+    };
+    return RelateOp::matches(this, g, patterns);
 }
 
 bool
@@ -403,9 +419,27 @@ Geometry::crosses(const Geometry* g) const
         return false;
     }
 #endif
-    unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->isCrosses(getDimension(), g->getDimension());
-    return res;
+    // The patterns of IntersectionMatrix::isCrosses
+    int dimA = getDimension();
+    int dimB = g->getDimension();
+    const char* pattern;
+    if((dimA == Dimension::P && dimB == Dimension::L) ||
+            (dimA == Dimension::P && dimB == Dimension::A) ||
+            (dimA == Dimension::L && dimB == Dimension::A)) {
+        pattern = "T*T******";
+    }
+    else if((dimA == Dimension::L && dimB == Dimension::P) ||
+            (dimA == Dimension::A && dimB == Dimension::P) ||
+            (dimA == Dimension::A && dimB == Dimension::L)) {
+        pattern = "T*****T**";
+    }
+    else if(dimA == Dimension::L && dimB == Dimension::L) {
+        pattern = "0********";
+    }
+    else {
+        return false;
+    }
+    return RelateOp::matches(this, g, vector<string>(1, pattern));
 }
 
 bool
@@ -460,17 +494,27 @@ Geometry::overlaps(const Geometry* g) const
         return false;
     }
 #endif
-    unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->isOverlaps(getDimension(), g->getDimension());
-    return res;
+    // The patterns of IntersectionMatrix::isOverlaps
+    int dimA = getDimension();
+    int dimB = g->getDimension();
+    const char* pattern;
+    if((dimA == Dimension::P && dimB == Dimension::P) ||
+            (dimA == Dimension::A && dimB == Dimension::A)) {
+        pattern = "T*T***T**";
+    }
+    else if(dimA == Dimension::L && dimB == Dimension::L) {
+        pattern = "1*T***T**";
+    }
+    else {
+        return false;
+    }
+    return RelateOp::matches(this, g, vector<string>(1, pattern));
 }
 
 bool
 Geometry::relate(const Geometry* g, const string& intersectionPattern) const
 {
-    unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->matches(intersectionPattern);
-    return res;
+    return RelateOp::matches(this, g, vector<string>(1, intersectionPattern));
 }
 
 bool
@@ -577,7 +621,7 @@ Geometry::intersection(const Geometry* other) const
     }
 #endif
 
-    return BinaryOp(this, other, overlayOp(OverlayOp::opINTERSECTION)).release();
+    return OverlayComponentSplitter::overlay(this, other, OverlayOp::opINTERSECTION).release();
 }
 
 Geometry*
@@ -633,7 +677,7 @@ Geometry::Union(const Geometry* other) const
     }
 #endif
 
-    return BinaryOp(this, other, overlayOp(OverlayOp::opUNION)).release();
+    return OverlayComponentSplitter::overlay(this, other, OverlayOp::opUNION).release();
 }
 
 /* public */
@@ -656,7 +700,7 @@ Geometry::difference(const Geometry* other) const
         return clone();
     }
 
-    return BinaryOp(this, other, overlayOp(OverlayOp::opDIFFERENCE)).release();
+    return OverlayComponentSplitter::overlay(this, other, OverlayOp::opDIFFERENCE).release();
 }
 
 Geometry*
@@ -704,7 +748,7 @@ Geometry::symDifference(const Geometry* other) const
         return _factory->buildGeometry(v);
     }
 
-    return BinaryOp(this, other, overlayOp(OverlayOp::opSYMDIFFERENCE)).release();
+    return OverlayComponentSplitter::overlay(this, other, OverlayOp::opSYMDIFFERENCE).release();
 }
 
 int
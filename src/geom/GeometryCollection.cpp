@@ -250,13 +250,13 @@ GeometryCollection::normalize()
     sort(geometries->begin(), geometries->end(), GeometryGreaterThen());
 }
 
-Envelope::Ptr
+Envelope
 GeometryCollection::computeEnvelopeInternal() const
 {
-    Envelope::Ptr p_envelope(new Envelope());
+    Envelope p_envelope;
     for(size_t i = 0; i < geometries->size(); i++) {
         const Envelope* env = (*geometries)[i]->getEnvelopeInternal();
-        p_envelope->expandToInclude(env);
+        p_envelope.expandToInclude(env);
     }
     return p_envelope;
 }
@@ -248,7 +248,7 @@ LineString::isCoordinate(Coordinate& pt) const
 }
 
 /*protected*/
-Envelope::Ptr
+Envelope
 LineString::computeEnvelopeInternal() const
 {
     if(isEmpty()) {
@@ -256,7 +256,7 @@ LineString::computeEnvelopeInternal() const
         // as it would indicate "unknown"
         // envelope. In this case we
         // *know* the envelope is EMPTY.
-        return Envelope::Ptr(new Envelope());
+        return Envelope();
     }
 
     assert(points.get());
@@ -274,10 +274,9 @@ LineString::computeEnvelopeInternal() const
         maxy = maxy > c1.y ? maxy : c1.y;
     }
 
-    // caller expects a newly allocated Envelope.
     // this function won't be called twice, unless
-    // cached Envelope is invalidated (set to NULL)
-    return Envelope::Ptr(new Envelope(minx, maxx, miny, maxy));
+    // cached Envelope is invalidated
+    return Envelope(minx, maxx, miny, maxy);
 }
 
 bool
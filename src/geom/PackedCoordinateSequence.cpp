@@ -0,0 +1,366 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2001-2002 Vivid Solutions Inc.
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: geom/impl/PackedCoordinateSequence.java (JTS-1.14)
+ *
+ **********************************************************************/
+
+#include <geos/geom/PackedCoordinateSequence.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateFilter.h>
+#include <geos/geom/Envelope.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace geos {
+namespace geom { // geos::geom
+
+namespace {
+
+std::size_t
+normalizeDimension(std::size_t dimension)
+{
+    return dimension == 2 ? 2 : 3;
+}
+
+}
+
+PackedCoordinateSequence::PackedCoordinateSequence(std::size_t n,
+        std::size_t dimension_in)
+    :
+    dimension(normalizeDimension(dimension_in)),
+    coordCache(nullptr)
+{
+    ordinates.assign(n * dimension, 0.0);
+}
+
+PackedCoordinateSequence::PackedCoordinateSequence(
+    std::vector<double>&& ordinates_in, std::size_t dimension_in)
+    :
+    ordinates(std::move(ordinates_in)),
+    dimension(normalizeDimension(dimension_in)),
+    coordCache(nullptr)
+{
+    if(ordinates.size() % dimension != 0) {
+        throw util::IllegalArgumentException(
+            "PackedCoordinateSequence: ordinate count is not a multiple of the dimension");
+    }
+}
+
+PackedCoordinateSequence::PackedCoordinateSequence(
+    const CoordinateSequence& seq, std::size_t dimension_in)
+    :
+    CoordinateSequence(seq),
+    dimension(normalizeDimension(dimension_in)),
+    coordCache(nullptr)
+{
+    std::size_t n = seq.size();
+    ordinates.reserve(n * dimension);
+    Coordinate c;
+    for(std::size_t i = 0; i < n; ++i) {
+        seq.getAt(i, c);
+        ordinates.push_back(c.x);
+        ordinates.push_back(c.y);
+        if(dimension == 3) {
+            ordinates.push_back(c.z);
+        }
+    }
+}
+
+PackedCoordinateSequence::PackedCoordinateSequence(
+    const PackedCoordinateSequence& seq)
+    :
+    CoordinateSequence(seq),
+    ordinates(seq.ordinates),
+    dimension(seq.dimension),
+    coordCache(nullptr)
+{
+}
+
+PackedCoordinateSequence::~PackedCoordinateSequence()
+{
+    invalidateCache();
+}
+
+CoordinateSequence*
+PackedCoordinateSequence::clone() const
+{
+    return new PackedCoordinateSequence(*this);
+}
+
+const std::vector<Coordinate>&
+PackedCoordinateSequence::getCoordinateCache() const
+{
+    std::vector<Coordinate>* cache = coordCache.load(std::memory_order_acquire);
+    if(cache) {
+        return *cache;
+    }
+
+    std::lock_guard<std::mutex> lock(coordCacheMutex);
+    cache = coordCache.load(std::memory_order_relaxed);
+    if(! cache) {
+        std::unique_ptr<std::vector<Coordinate>> coords(new std::vector<Coordinate>(size()));
+        for(std::size_t i = 0, n = coords->size(); i < n; ++i) {
+            getAt(i, (*coords)[i]);
+        }
+        cache = coords.release();
+        coordCache.store(cache, std::memory_order_release);
+    }
+    return *cache;
+}
+
+const Coordinate&
+PackedCoordinateSequence::getAt(std::size_t pos) const
+{
+    return getCoordinateCache()[pos];
+}
+
+void
+PackedCoordinateSequence::getAt(std::size_t pos, Coordinate& c) const
+{
+    const double* p = &ordinates[pos * dimension];
+    c.x = p[0];
+    c.y = p[1];
+    c.z = dimension == 3 ? p[2] : DoubleNotANumber;
+}
+
+std::size_t
+PackedCoordinateSequence::getSize() const
+{
+    return ordinates.size() / dimension;
+}
+
+const std::vector<Coordinate>*
+PackedCoordinateSequence::toVector() const
+{
+    return &getCoordinateCache();
+}
+
+void
+PackedCoordinateSequence::toVector(std::vector<Coordinate>& out) const
+{
+    std::size_t n = size();
+    out.reserve(out.size() + n);
+    Coordinate c;
+    for(std::size_t i = 0; i < n; ++i) {
+        getAt(i, c);
+        out.push_back(c);
+    }
+}
+
+bool
+PackedCoordinateSequence::isEmpty() const
+{
+    return ordinates.empty();
+}
+
+void
+PackedCoordinateSequence::add(const Coordinate& c)
+{
+    invalidateCache();
+    ordinates.push_back(c.x);
+    ordinates.push_back(c.y);
+    if(dimension == 3) {
+        ordinates.push_back(c.z);
+    }
+}
+
+void
+PackedCoordinateSequence::add(const Coordinate& c, bool allowRepeated)
+{
+    if(!allowRepeated && ! isEmpty()) {
+        std::size_t last = size() - 1;
+        if(getX(last) == c.x && getY(last) == c.y) {
+            return;
+        }
+    }
+    add(c);
+}
+
+void
+PackedCoordinateSequence::add(std::size_t i, const Coordinate& coord,
+                              bool allowRepeated)
+{
+    // don't add duplicate coordinates
+    if(! allowRepeated) {
+        std::size_t sz = size();
+        if(i > 0 && getX(i - 1) == coord.x && getY(i - 1) == coord.y) {
+            return;
+        }
+        if(i < sz && getX(i) == coord.x && getY(i) == coord.y) {
+            return;
+        }
+    }
+
+    invalidateCache();
+    double ords[3] = { coord.x, coord.y, coord.z };
+    ordinates.insert(ordinates.begin() + static_cast<std::ptrdiff_t>(i * dimension),
+                     ords, ords + dimension);
+}
+
+void
+PackedCoordinateSequence::setAt(const Coordinate& c, std::size_t pos)
+{
+    invalidateCache();
+    double* p = &ordinates[pos * dimension];
+    p[0] = c.x;
+    p[1] = c.y;
+    if(dimension == 3) {
+        p[2] = c.z;
+    }
+}
+
+void
+PackedCoordinateSequence::deleteAt(std::size_t pos)
+{
+    invalidateCache();
+    auto first = ordinates.begin() + static_cast<std::ptrdiff_t>(pos * dimension);
+    ordinates.erase(first, first + static_cast<std::ptrdiff_t>(dimension));
+}
+
+std::string
+PackedCoordinateSequence::toString() const
+{
+    std::string result("(");
+    Coordinate c;
+    for(std::size_t i = 0, n = size(); i < n; i++) {
+        if(i) {
+            result.append(", ");
+        }
+        getAt(i, c);
+        result.append(c.toString());
+    }
+    result.append(")");
+    return result;
+}
+
+void
+PackedCoordinateSequence::setPoints(const std::vector<Coordinate>& v)
+{
+    invalidateCache();
+    ordinates.clear();
+    ordinates.reserve(v.size() * dimension);
+    for(const Coordinate& c : v) {
+        add(c);
+    }
+}
+
+std::size_t
+PackedCoordinateSequence::getDimension() const
+{
+    return dimension;
+}
+
+double
+PackedCoordinateSequence::getOrdinate(std::size_t index,
+                                      std::size_t ordinateIndex) const
+{
+    if(ordinateIndex >= dimension) {
+        return DoubleNotANumber;
+    }
+    return ordinates[index * dimension + ordinateIndex];
+}
+
+void
+PackedCoordinateSequence::setOrdinate(std::size_t index,
+                                      std::size_t ordinateIndex, double value)
+{
+    if(ordinateIndex > CoordinateSequence::Z) {
+        std::stringstream ss;
+        ss << "Unknown ordinate index " << ordinateIndex;
+        throw util::IllegalArgumentException(ss.str());
+    }
+    // Z is dropped by two-dimensional sequences, as in setAt
+    if(ordinateIndex < dimension) {
+        invalidateCache();
+        ordinates[index * dimension + ordinateIndex] = value;
+    }
+}
+
+void
+PackedCoordinateSequence::expandEnvelope(Envelope& env) const
+{
+    std::size_t n = size();
+    if(n == 0) {
+        return;
+    }
+
+    const double* p = ordinates.data();
+    double minx = p[0];
+    double maxx = p[0];
+    double miny = p[1];
+    double maxy = p[1];
+    for(std::size_t i = 1; i < n; ++i) {
+        const double* q = p + i * dimension;
+        minx = std::min(minx, q[0]);
+        maxx = std::max(maxx, q[0]);
+        miny = std::min(miny, q[1]);
+        maxy = std::max(maxy, q[1]);
+    }
+    env.expandToInclude(minx, miny);
+    env.expandToInclude(maxx, maxy);
+}
+
+void
+PackedCoordinateSequence::apply_rw(const CoordinateFilter* filter)
+{
+    invalidateCache();
+    Coordinate c;
+    for(std::size_t i = 0, n = size(); i < n; ++i) {
+        getAt(i, c);
+        filter->filter_rw(&c);
+        setAt(c, i);
+    }
+}
+
+void
+PackedCoordinateSequence::apply_ro(CoordinateFilter* filter) const
+{
+    // filters may retain the Coordinate pointers they are given
+    for(const Coordinate& c : getCoordinateCache()) {
+        filter->filter_ro(&c);
+    }
+}
+
+CoordinateSequence&
+PackedCoordinateSequence::removeRepeatedPoints()
+{
+    std::size_t n = size();
+    if(n < 2) {
+        return *this;
+    }
+
+    invalidateCache();
+    double* p = ordinates.data();
+    std::size_t last = 0;
+    for(std::size_t i = 1; i < n; ++i) {
+        const double* q = p + i * dimension;
+        double* r = p + last * dimension;
+        if(q[0] == r[0] && q[1] == r[1]) {
+            continue;
+        }
+        ++last;
+        std::copy(q, q + dimension, p + last * dimension);
+    }
+    ordinates.resize((last + 1) * dimension);
+    return *this;
+}
+
+} // namespace geos::geom
+} // namespace geos
@@ -0,0 +1,78 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2001-2002 Vivid Solutions Inc.
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: geom/impl/PackedCoordinateSequenceFactory.java (JTS-1.14)
+ *
+ **********************************************************************/
+
+#include <geos/geom/PackedCoordinateSequenceFactory.h>
+#include <geos/geom/PackedCoordinateSequence.h>
+#include <geos/geom/Coordinate.h>
+
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace geom { // geos::geom
+
+static PackedCoordinateSequenceFactory packedXYCoordinateSequenceFactory(2);
+static PackedCoordinateSequenceFactory packedXYZCoordinateSequenceFactory(3);
+
+PackedCoordinateSequenceFactory::PackedCoordinateSequenceFactory(std::size_t dimension_in)
+    :
+    dimension(dimension_in == 2 ? 2 : 3)
+{
+}
+
+CoordinateSequence*
+PackedCoordinateSequenceFactory::create() const
+{
+    return new PackedCoordinateSequence(0, dimension);
+}
+
+CoordinateSequence*
+PackedCoordinateSequenceFactory::create(std::vector<Coordinate>* coords,
+                                        std::size_t dims) const
+{
+    std::unique_ptr<std::vector<Coordinate>> owned(coords);
+    PackedCoordinateSequence* seq = new PackedCoordinateSequence(0, dims ? dims : dimension);
+    if(owned) {
+        seq->setPoints(*owned);
+    }
+    return seq;
+}
+
+CoordinateSequence*
+PackedCoordinateSequenceFactory::create(std::size_t size, std::size_t dims) const
+{
+    return new PackedCoordinateSequence(size, dims ? dims : dimension);
+}
+
+CoordinateSequence*
+PackedCoordinateSequenceFactory::create(const CoordinateSequence& seq) const
+{
+    return new PackedCoordinateSequence(seq, dimension);
+}
+
+const CoordinateSequenceFactory*
+PackedCoordinateSequenceFactory::instance(std::size_t dims)
+{
+    if(dims == 2) {
+        return &packedXYCoordinateSequenceFactory;
+    }
+    return &packedXYZCoordinateSequenceFactory;
+}
+
+} // namespace geos::geom
+} // namespace geos
@@ -152,16 +152,16 @@ Point::getBoundary() const
     return getFactory()->createGeometryCollection(nullptr);
 }
 
-Envelope::Ptr
+Envelope
 Point::computeEnvelopeInternal() const
 {
     if(isEmpty()) {
-        return Envelope::Ptr(new Envelope());
+        return Envelope();
     }
 
-    return Envelope::Ptr(new Envelope(getCoordinate()->x,
-                                      getCoordinate()->x, getCoordinate()->y,
-                                      getCoordinate()->y));
+    return Envelope(getCoordinate()->x,
+                    getCoordinate()->x, getCoordinate()->y,
+                    getCoordinate()->y);
 }
 
 void
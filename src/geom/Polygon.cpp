@@ -230,10 +230,10 @@ Polygon::getBoundary() const
     return ret;
 }
 
-Envelope::Ptr
+Envelope
 Polygon::computeEnvelopeInternal() const
 {
-    return Envelope::Ptr(new Envelope(*(shell->getEnvelopeInternal())));
+    return *(shell->getEnvelopeInternal());
 }
 
 bool
@@ -19,13 +19,38 @@
 
 #include <geos/geom/prep/BasicPreparedGeometry.h>
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryComponentFilter.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/geom/Location.h>
 #include <geos/algorithm/PointLocator.h>
 #include <geos/geom/util/ComponentCoordinateExtracter.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/operation/distance/DistanceOp.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
 
 namespace geos {
 namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
 
+namespace {
+
+/*
+ * Envelopes are cached on first use. Computing those of all the
+ * components up front means concurrent predicates only ever read them.
+ */
+class EnvelopeCacheFilter : public geom::GeometryComponentFilter {
+public:
+    void
+    filter_ro(const geom::Geometry* g) override
+    {
+        g->getEnvelopeInternal();
+    }
+};
+
+}
+
 /*            *
  * protected: *
  *            */
@@ -35,6 +60,9 @@ BasicPreparedGeometry::setGeometry(const geom::Geometry* geom)
 {
     baseGeom = geom;
     geom::util::ComponentCoordinateExtracter::getCoordinates(*baseGeom, representativePts);
+
+    EnvelopeCacheFilter envFilter;
+    baseGeom->apply_ro(&envFilter);
 }
 
 bool
@@ -49,6 +77,23 @@ BasicPreparedGeometry::envelopeCovers(const geom::Geometry* g) const
     return baseGeom->getEnvelopeInternal()->covers(g->getEnvelopeInternal());
 }
 
+operation::distance::IndexedFacetDistance*
+BasicPreparedGeometry::getIndexedFacetDistance() const
+{
+    std::call_once(indexedDistanceFlag, [this]() {
+        indexedDistance.reset(new operation::distance::IndexedFacetDistance(baseGeom));
+    });
+    return indexedDistance.get();
+}
+
+bool
+BasicPreparedGeometry::isInsideArea(const geom::Geometry* g) const
+{
+    // with the facets apart, the geometries only intersect if one
+    // is inside the other
+    return intersects(g);
+}
+
 /*
  * public:
  */
@@ -144,6 +189,79 @@ BasicPreparedGeometry::within(const geom::Geometry* g) const
     return baseGeom->within(g);
 }
 
+bool
+BasicPreparedGeometry::relate(const geom::Geometry* g,
+                              const std::string& pattern) const
+{
+    if(envelopesIntersect(g)) {
+        return baseGeom->relate(g, pattern);
+    }
+
+    // The matrix of geometries with disjoint envelopes, as
+    // RelateComputer gives it
+    geom::IntersectionMatrix im;
+    im.set(geom::Location::EXTERIOR, geom::Location::EXTERIOR, 2);
+    if(!baseGeom->isEmpty()) {
+        im.set(geom::Location::INTERIOR, geom::Location::EXTERIOR, baseGeom->getDimension());
+        im.set(geom::Location::BOUNDARY, geom::Location::EXTERIOR, baseGeom->getBoundaryDimension());
+    }
+    if(!g->isEmpty()) {
+        im.set(geom::Location::EXTERIOR, geom::Location::INTERIOR, g->getDimension());
+        im.set(geom::Location::EXTERIOR, geom::Location::BOUNDARY, g->getBoundaryDimension());
+    }
+    return im.matches(pattern);
+}
+
+double
+BasicPreparedGeometry::distance(const geom::Geometry* g) const
+{
+    if(baseGeom->isEmpty() || g->isEmpty()) {
+        return 0.0;
+    }
+
+    double dist = getIndexedFacetDistance()->getDistance(g);
+    if(dist > 0.0 && isInsideArea(g)) {
+        return 0.0;
+    }
+    return dist;
+}
+
+std::unique_ptr<geom::CoordinateSequence>
+BasicPreparedGeometry::nearestPoints(const geom::Geometry* g) const
+{
+    if(baseGeom->isEmpty() || g->isEmpty()) {
+        return nullptr;
+    }
+
+    std::unique_ptr<geom::CoordinateSequence> pts = getIndexedFacetDistance()->nearestPoints(g);
+
+    // the nearest points are then a point of the inner geometry,
+    // which DistanceOp finds before the facets
+    if(!pts->getAt(0).equals2D(pts->getAt(1)) && isInsideArea(g)) {
+        return std::unique_ptr<geom::CoordinateSequence>(
+                   operation::distance::DistanceOp::nearestPoints(baseGeom, g));
+    }
+    return pts;
+}
+
+bool
+BasicPreparedGeometry::isWithinDistance(const geom::Geometry* g, double dist) const
+{
+    if(baseGeom->isEmpty() || g->isEmpty()) {
+        return false;
+    }
+
+    // short-circuit test
+    if(baseGeom->getEnvelopeInternal()->distance(g->getEnvelopeInternal()) > dist) {
+        return false;
+    }
+
+    if(getIndexedFacetDistance()->isWithinDistance(g, dist)) {
+        return true;
+    }
+    return isInsideArea(g);
+}
+
 std::string
 BasicPreparedGeometry::toString()
 {
@@ -22,6 +22,8 @@
 #include <geos/noding/SegmentStringUtil.h>
 #include <geos/noding/FastSegmentSetIntersectionFinder.h>
 
+#include <mutex>
+
 namespace geos {
 namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
@@ -42,10 +44,10 @@ PreparedLineString::~PreparedLineString()
 noding::FastSegmentSetIntersectionFinder*
 PreparedLineString::getIntersectionFinder()
 {
-    if(! segIntFinder) {
+    std::call_once(segIntFinderFlag, [this]() {
         noding::SegmentStringUtil::extractSegmentStrings(&getGeometry(), segStrings);
         segIntFinder = new noding::FastSegmentSetIntersectionFinder(&segStrings);
-    }
+    });
 
     return segIntFinder;
 }
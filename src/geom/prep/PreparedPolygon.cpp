@@ -23,6 +23,7 @@
 #include <geos/geom/prep/PreparedPolygonCovers.h>
 #include <geos/geom/prep/PreparedPolygonIntersects.h>
 #include <geos/geom/prep/PreparedPolygonPredicate.h>
+#include <geos/geom/prep/PreparedPolygonRelate.h>
 #include <geos/noding/FastSegmentSetIntersectionFinder.h>
 #include <geos/noding/SegmentStringUtil.h>
 #include <geos/operation/predicate/RectangleContains.h>
@@ -31,6 +32,7 @@
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 // std
 #include <cstddef>
+#include <mutex>
 
 namespace geos {
 namespace geom { // geos.geom
@@ -59,10 +61,10 @@ noding::FastSegmentSetIntersectionFinder*
 PreparedPolygon::
 getIntersectionFinder() const
 {
-    if(! segIntFinder) {
+    std::call_once(segIntFinderFlag, [this]() {
         noding::SegmentStringUtil::extractSegmentStrings(&getGeometry(), segStrings);
         segIntFinder = new noding::FastSegmentSetIntersectionFinder(&segStrings);
-    }
+    });
     return segIntFinder;
 }
 
@@ -70,9 +72,9 @@ algorithm::locate::PointOnGeometryLocator*
 PreparedPolygon::
 getPointLocator() const
 {
-    if(! ptOnGeomLoc) {
+    std::call_once(ptOnGeomLocFlag, [this]() {
         ptOnGeomLoc = new algorithm::locate::IndexedPointInAreaLocator(getGeometry());
-    }
+    });
 
     return ptOnGeomLoc;
 }
@@ -146,6 +148,54 @@ intersects(const geom::Geometry* g) const
     return PreparedPolygonIntersects::intersects(this, g);
 }
 
+bool
+PreparedPolygon::
+touches(const geom::Geometry* g) const
+{
+    // envelope test
+    if(!envelopesIntersect(g)) {
+        return false;
+    }
+
+    return PreparedPolygonRelate::touches(this, g);
+}
+
+bool
+PreparedPolygon::
+crosses(const geom::Geometry* g) const
+{
+    // envelope test
+    if(!envelopesIntersect(g)) {
+        return false;
+    }
+
+    return PreparedPolygonRelate::crosses(this, g);
+}
+
+bool
+PreparedPolygon::
+overlaps(const geom::Geometry* g) const
+{
+    // envelope test
+    if(!envelopesIntersect(g)) {
+        return false;
+    }
+
+    return PreparedPolygonRelate::overlaps(this, g);
+}
+
+bool
+PreparedPolygon::
+relate(const geom::Geometry* g, const std::string& pattern) const
+{
+    // the matrix of disjoint geometries needs no index
+    if(!envelopesIntersect(g)) {
+        return BasicPreparedGeometry::relate(g, pattern);
+    }
+
+    return PreparedPolygonRelate::relate(this, g, pattern);
+}
+
 } // namespace geos.geom.prep
 } // namespace geos.geom
 } // namespace geos
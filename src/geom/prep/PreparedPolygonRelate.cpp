@@ -0,0 +1,239 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+
+#include <geos/geom/prep/PreparedPolygonRelate.h>
+#include <geos/geom/prep/PreparedPolygon.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/geom/Lineal.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Polygonal.h>
+#include <geos/geom/Puntal.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/algorithm/locate/PointOnGeometryLocator.h>
+#include <geos/noding/FastSegmentSetIntersectionFinder.h>
+#include <geos/noding/SegmentIntersectionDetector.h>
+#include <geos/noding/SegmentString.h>
+#include <geos/noding/SegmentStringUtil.h>
+// std
+#include <cstddef>
+#include <memory>
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+//
+// private:
+//
+void
+PreparedPolygonRelate::locateTestVertices(const geom::Geometry* geom,
+        VertexSearch search)
+{
+    std::unique_ptr<geom::CoordinateSequence> pts(geom->getCoordinates());
+    algorithm::locate::PointOnGeometryLocator* locator = prepPoly->getPointLocator();
+
+    for(std::size_t i = 0, ni = pts->size(); i < ni; i++) {
+        const int loc = locator->locate(&pts->getAt(i));
+        if(loc == geom::Location::INTERIOR) {
+            hasInteriorVertex = true;
+        }
+        else if(loc == geom::Location::BOUNDARY) {
+            hasBoundaryVertex = true;
+        }
+        else {
+            hasExteriorVertex = true;
+        }
+
+        if(search == UNTIL_INTERIOR && hasInteriorVertex) {
+            return;
+        }
+        if(search == UNTIL_INTERIOR_AND_EXTERIOR && hasInteriorVertex && hasExteriorVertex) {
+            return;
+        }
+    }
+}
+
+void
+PreparedPolygonRelate::findSegmentIntersections(const geom::Geometry* geom)
+{
+    noding::SegmentString::ConstVect lineSegStr;
+    noding::SegmentStringUtil::extractSegmentStrings(geom, lineSegStr);
+
+    algorithm::LineIntersector li;
+    noding::SegmentIntersectionDetector intDetector(&li);
+    intDetector.setFindProper(true);
+    prepPoly->getIntersectionFinder()->intersects(&lineSegStr, &intDetector);
+
+    for(std::size_t i = 0, ni = lineSegStr.size(); i < ni; i++) {
+        delete lineSegStr[ i ];
+    }
+
+    hasSegmentIntersection = intDetector.hasIntersection();
+    hasProperIntersection = intDetector.hasProperIntersection();
+}
+
+bool
+PreparedPolygonRelate::isProperIntersectionDecisive() const
+{
+    const geom::Geometry& poly = prepPoly->getGeometry();
+    if(poly.getNumGeometries() != 1) {
+        return false;
+    }
+    const geom::Polygon* p = dynamic_cast<const geom::Polygon*>(poly.getGeometryN(0));
+    return p && p->getNumInteriorRing() == 0;
+}
+
+//
+// public:
+//
+bool
+PreparedPolygonRelate::touches(const geom::Geometry* geom)
+{
+    // Points touch the polygon if none is in its interior,
+    // and some is on its boundary
+    if(dynamic_cast<const geom::Puntal*>(geom)) {
+        locateTestVertices(geom, UNTIL_INTERIOR);
+        return !hasInteriorVertex && hasBoundaryVertex;
+    }
+    if(!dynamic_cast<const geom::Lineal*>(geom) && !dynamic_cast<const geom::Polygonal*>(geom)) {
+        return prepPoly->getGeometry().touches(geom);
+    }
+
+    // The interior of a line or polygon comes arbitrarily close to
+    // each of its vertices, so it intersects the polygon interior if
+    // any vertex does.
+    locateTestVertices(geom, UNTIL_INTERIOR);
+    if(hasInteriorVertex) {
+        return false;
+    }
+
+    // A proper intersection with the boundary of the polygon crosses
+    // it into the polygon interior, and the geometries cannot touch
+    // unless the test geometry meets the boundary.
+    findSegmentIntersections(geom);
+    if((hasProperIntersection && isProperIntersectionDecisive()) || !isBoundaryMet()) {
+        return false;
+    }
+
+    return prepPoly->getGeometry().touches(geom);
+}
+
+bool
+PreparedPolygonRelate::crosses(const geom::Geometry* geom)
+{
+    // see Geometry::crosses: an area never crosses an area
+    if(dynamic_cast<const geom::Polygonal*>(geom)) {
+        return false;
+    }
+    if(!dynamic_cast<const geom::Puntal*>(geom) && !dynamic_cast<const geom::Lineal*>(geom)) {
+        return prepPoly->getGeometry().crosses(geom);
+    }
+
+    // The interior of the test geometry must meet both the interior
+    // and the exterior of the polygon
+    locateTestVertices(geom, UNTIL_INTERIOR_AND_EXTERIOR);
+    if(hasInteriorVertex && hasExteriorVertex) {
+        return true;
+    }
+    if(dynamic_cast<const geom::Puntal*>(geom)) {
+        return false;
+    }
+
+    // A line crossing the boundary properly goes on both of its sides,
+    // and a line not meeting the boundary stays on one side
+    findSegmentIntersections(geom);
+    if(hasProperIntersection && isProperIntersectionDecisive()) {
+        return true;
+    }
+    if(!isBoundaryMet()) {
+        return false;
+    }
+
+    return prepPoly->getGeometry().crosses(geom);
+}
+
+bool
+PreparedPolygonRelate::overlaps(const geom::Geometry* geom)
+{
+    // see Geometry::overlaps: an area only overlaps an area
+    if(dynamic_cast<const geom::Puntal*>(geom) || dynamic_cast<const geom::Lineal*>(geom)) {
+        return false;
+    }
+    if(!dynamic_cast<const geom::Polygonal*>(geom)) {
+        return prepPoly->getGeometry().overlaps(geom);
+    }
+
+    // Crossing boundaries mean that each area has parts inside and
+    // outside the other one
+    findSegmentIntersections(geom);
+    if(hasProperIntersection && isProperIntersectionDecisive()) {
+        return true;
+    }
+
+    // The test area has parts inside and outside the polygon, which
+    // also has parts outside the test area if it is not within its
+    // envelope
+    locateTestVertices(geom, UNTIL_INTERIOR_AND_EXTERIOR);
+    if(hasInteriorVertex && hasExteriorVertex
+            && !geom->getEnvelopeInternal()->covers(prepPoly->getGeometry().getEnvelopeInternal())) {
+        return true;
+    }
+
+    return prepPoly->getGeometry().overlaps(geom);
+}
+
+bool
+PreparedPolygonRelate::relate(const geom::Geometry* geom, const std::string& pattern)
+{
+    // The matrix of a polygon and points only depends on where the
+    // points are
+    if(dynamic_cast<const geom::Puntal*>(geom) && !geom->isEmpty()) {
+        locateTestVertices(geom, ALL_VERTICES);
+        geom::IntersectionMatrix im;
+        im.set(geom::Location::INTERIOR, geom::Location::EXTERIOR, 2);
+        im.set(geom::Location::BOUNDARY, geom::Location::EXTERIOR, 1);
+        im.set(geom::Location::EXTERIOR, geom::Location::EXTERIOR, 2);
+        if(hasInteriorVertex) {
+            im.set(geom::Location::INTERIOR, geom::Location::INTERIOR, 0);
+        }
+        if(hasBoundaryVertex) {
+            im.set(geom::Location::BOUNDARY, geom::Location::INTERIOR, 0);
+        }
+        if(hasExteriorVertex) {
+            im.set(geom::Location::EXTERIOR, geom::Location::INTERIOR, 0);
+        }
+        return im.matches(pattern);
+    }
+
+    // When the boundaries of two areas cross, all entries of the
+    // matrix are at their highest, except the boundary/boundary one
+    // which is 0 or 1
+    if(dynamic_cast<const geom::Polygonal*>(geom)) {
+        findSegmentIntersections(geom);
+        if(hasProperIntersection && isProperIntersectionDecisive()) {
+            bool matchesPoint = geom::IntersectionMatrix::matches("212101212", pattern);
+            bool matchesLine = geom::IntersectionMatrix::matches("212111212", pattern);
+            if(matchesPoint == matchesLine) {
+                return matchesPoint;
+            }
+        }
+    }
+
+    return prepPoly->getGeometry().relate(geom, pattern);
+}
+
+} // geos::geom::prep
+} // geos::geom
+} // geos
@@ -25,12 +25,12 @@
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/CoordinateArraySequence.h> // shouldn't be using this
 #include <geos/geom/Coordinate.h>
+#include <geos/util/IllegalStateException.h>
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <vector>
-#include <set>
-#include <utility> // std::pair
 
 #ifndef GEOS_DEBUG
 #define GEOS_DEBUG 0
@@ -47,32 +47,46 @@ namespace geos {
 namespace geomgraph { // geos.geomgraph
 
 EdgeIntersectionList::EdgeIntersectionList(Edge* newEdge):
+    sorted(true),
     edge(newEdge)
 {
 }
 
 EdgeIntersectionList::~EdgeIntersectionList()
 {
-    for(EdgeIntersectionList::iterator it = nodeMap.begin(),
-            endIt = nodeMap.end();
-            it != endIt; ++it) {
-        delete *it;
-    }
 }
 
-EdgeIntersection*
+void
 EdgeIntersectionList::add(const Coordinate& coord,
                           size_t segmentIndex, double dist)
 {
-    EdgeIntersection* eiNew = new EdgeIntersection(coord, segmentIndex, dist);
+    nodeMap.emplace_back(coord, segmentIndex, dist);
+    sorted = false;
+}
 
-    pair<EdgeIntersectionList::iterator, bool> p = nodeMap.insert(eiNew);
-    if(p.second) {    // new EdgeIntersection inserted
-        return eiNew;
+/*public*/
+void
+EdgeIntersectionList::prepare()
+{
+    if(sorted) {
+        return;
     }
-    else {
-        delete eiNew;
-        return *(p.first);
+    sorted = true;
+
+    // a stable sort keeps the intersection added first among equal ones
+    std::stable_sort(nodeMap.begin(), nodeMap.end());
+    nodeMap.erase(std::unique(nodeMap.begin(), nodeMap.end(),
+    [](const EdgeIntersection& ei1, const EdgeIntersection& ei2) {
+        return !(ei1 < ei2) && !(ei2 < ei1);
+    }), nodeMap.end());
+}
+
+/*private*/
+void
+EdgeIntersectionList::checkPrepared() const
+{
+    if(!sorted) {
+        throw util::IllegalStateException("EdgeIntersectionList read before prepare()");
     }
 }
 
@@ -85,13 +99,8 @@ EdgeIntersectionList::isEmpty() const
 bool
 EdgeIntersectionList::isIntersection(const Coordinate& pt) const
 {
-    EdgeIntersectionList::const_iterator
-    it = nodeMap.begin(),
-    endIt = nodeMap.end();
-
-    for(; it != endIt; ++it) {
-        EdgeIntersection* ei = *it;
-        if(ei->coord == pt) {
+    for(const EdgeIntersection& ei : nodeMap) {
+        if(ei.coord == pt) {
             return true;
         }
     }
@@ -113,38 +122,38 @@ EdgeIntersectionList::addSplitEdges(vector<Edge*>* edgeList)
     // of the edge
     addEndpoints();
 
-    EdgeIntersectionList::iterator it = nodeMap.begin();
+    EdgeIntersectionList::iterator it = begin();
 
     // there should always be at least two entries in the list
-    EdgeIntersection* eiPrev = *it;
+    const EdgeIntersection* eiPrev = &*it;
     ++it;
 
     while(it != nodeMap.end()) {
-        EdgeIntersection* ei = *it;
-        Edge* newEdge = createSplitEdge(eiPrev, ei);
+        const EdgeIntersection& ei = *it;
+        Edge* newEdge = createSplitEdge(*eiPrev, ei);
         edgeList->push_back(newEdge);
-        eiPrev = ei;
+        eiPrev = &ei;
         it++;
     }
 }
 
 Edge*
-EdgeIntersectionList::createSplitEdge(EdgeIntersection* ei0,
-                                      EdgeIntersection* ei1)
+EdgeIntersectionList::createSplitEdge(const EdgeIntersection& ei0,
+                                      const EdgeIntersection& ei1)
 {
 #if GEOS_DEBUG
     cerr << "[" << this << "] EdgeIntersectionList::createSplitEdge()" << endl;
 #endif // GEOS_DEBUG
-    auto npts = ei1->segmentIndex - ei0->segmentIndex + 2;
+    auto npts = ei1.segmentIndex - ei0.segmentIndex + 2;
 
-    const Coordinate& lastSegStartPt = edge->pts->getAt(ei1->segmentIndex);
+    const Coordinate& lastSegStartPt = edge->pts->getAt(ei1.segmentIndex);
 
     // if the last intersection point is not equal to the its segment
     // start pt, add it to the points list as well.
     // (This check is needed because the distance metric is not totally
     // reliable!). The check for point equality is 2D only - Z values
     // are ignored
-    bool useIntPt1 = ei1->dist > 0.0 || !ei1->coord.equals2D(lastSegStartPt);
+    bool useIntPt1 = ei1.dist > 0.0 || !ei1.coord.equals2D(lastSegStartPt);
 
     if(!useIntPt1) {
         --npts;
@@ -157,10 +166,10 @@ EdgeIntersectionList::createSplitEdge(EdgeIntersection* ei0,
     vector<Coordinate>* vc = new vector<Coordinate>();
     vc->reserve(npts);
 
-    vc->push_back(ei0->coord);
-    for(auto i = ei0->segmentIndex + 1; i <= ei1->segmentIndex; ++i) {
-        if(! useIntPt1 && ei1->segmentIndex == i) {
-            vc->push_back(ei1->coord);
+    vc->push_back(ei0.coord);
+    for(auto i = ei0.segmentIndex + 1; i <= ei1.segmentIndex; ++i) {
+        if(! useIntPt1 && ei1.segmentIndex == i) {
+            vc->push_back(ei1.coord);
         }
         else {
             vc->push_back(edge->pts->getAt(i));
@@ -168,7 +177,7 @@ EdgeIntersectionList::createSplitEdge(EdgeIntersection* ei0,
     }
 
     if(useIntPt1) {
-        vc->push_back(ei1->coord);
+        vc->push_back(ei1.coord);
     }
 
     CoordinateSequence* pts = new CoordinateArraySequence(vc);
@@ -187,11 +196,10 @@ EdgeIntersectionList::print() const
 std::ostream&
 operator<< (std::ostream& os, const EdgeIntersectionList& e)
 {
+    // printed as they are, whether prepared or not
     os << "Intersections:" << std::endl;
-    EdgeIntersectionList::const_iterator it = e.begin(), endIt = e.end();
-    for(; it != endIt; ++it) {
-        EdgeIntersection* ei = *it;
-        os << *ei << endl;
+    for(const EdgeIntersection& ei : e.nodeMap) {
+        os << ei << endl;
     }
     return os;
 }
@@ -46,9 +46,11 @@
 #include <geos/geom/MultiPolygon.h>
 #include <geos/geom/GeometryCollection.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/ParallelChunks.h>
 
 #include <geos/inline.h>
 
+#include <algorithm>
 #include <vector>
 #include <memory> // unique_ptr
 #include <cassert>
@@ -108,7 +110,16 @@ GeometryGraph::createEdgeSetIntersector()
     //private EdgeSetIntersector esi = new MCSweepLineIntersector();
 
     //return new SimpleEdgeSetIntersector();
-    return new SimpleMCSweepLineIntersector();
+    SimpleMCSweepLineIntersector* esi = new SimpleMCSweepLineIntersector();
+    esi->setNumThreads(numThreads);
+    return esi;
+}
+
+/*public*/
+void
+GeometryGraph::setNumThreads(std::size_t n)
+{
+    numThreads = util::normalizeThreadCount(n);
 }
 
 /*public*/
@@ -399,17 +410,27 @@ GeometryGraph::computeSelfNodes(LineIntersector& li,
 #endif // GEOS_DEBUG
 
     addSelfIntersectionNodes(argIndex);
+    nodes->prepare();
     return si;
 }
 
 SegmentIntersector*
 GeometryGraph::computeEdgeIntersections(GeometryGraph* g,
                                         LineIntersector* li, bool includeProper, const Envelope* env)
+{
+    return computeEdgeIntersections(g, li, includeProper, false, env);
+}
+
+SegmentIntersector*
+GeometryGraph::computeEdgeIntersections(GeometryGraph* g,
+                                        LineIntersector* li, bool includeProper, bool isDoneIfProperInt,
+                                        const Envelope* env)
 {
 #if GEOS_DEBUG
     cerr << "GeometryGraph::computeEdgeIntersections call" << endl;
 #endif
     SegmentIntersector* si = new SegmentIntersector(li, includeProper, true);
+    si->setIsDoneIfProperInt(isDoneIfProperInt);
 
     si->setBoundaryNodes(getBoundaryNodes(), g->getBoundaryNodes());
     unique_ptr<EdgeSetIntersector> esi(createEdgeSetIntersector());
@@ -495,7 +516,7 @@ GeometryGraph::addSelfIntersectionNodes(int p_argIndex)
         for(EdgeIntersectionList::iterator
                 eiIt = eiL.begin(), eiEnd = eiL.end();
                 eiIt != eiEnd; ++eiIt) {
-            EdgeIntersection* ei = *eiIt;
+            EdgeIntersection* ei = &*eiIt;
             addSelfIntersectionNode(p_argIndex, ei->coord, eLoc);
             GEOS_CHECK_FOR_INTERRUPTS();
         }
@@ -545,10 +566,12 @@ GeometryGraph::GeometryGraph(int newArgIndex,
     useBoundaryDeterminationRule(true),
     boundaryNodeRule(algorithm::BoundaryNodeRule::getBoundaryOGCSFS()),
     argIndex(newArgIndex),
-    hasTooFewPointsVar(false)
+    hasTooFewPointsVar(false),
+    numThreads(1)
 {
     if(parentGeom != nullptr) {
         add(parentGeom);
+        nodes->prepare();
     }
 }
 
@@ -561,10 +584,12 @@ GeometryGraph::GeometryGraph(int newArgIndex,
     useBoundaryDeterminationRule(true),
     boundaryNodeRule(bnr),
     argIndex(newArgIndex),
-    hasTooFewPointsVar(false)
+    hasTooFewPointsVar(false),
+    numThreads(1)
 {
     if(parentGeom != nullptr) {
         add(parentGeom);
+        nodes->prepare();
     }
 }
 
@@ -575,7 +600,8 @@ GeometryGraph::GeometryGraph()
     useBoundaryDeterminationRule(true),
     boundaryNodeRule(algorithm::BoundaryNodeRule::getBoundaryOGCSFS()),
     argIndex(-1),
-    hasTooFewPointsVar(false)
+    hasTooFewPointsVar(false),
+    numThreads(1)
 {
 }
 
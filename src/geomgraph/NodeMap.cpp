@@ -25,6 +25,7 @@
 #include <geos/geom/Location.h>
 #include <geos/geom/Coordinate.h>
 
+#include <algorithm>
 #include <vector>
 #include <cassert>
 
@@ -40,7 +41,8 @@ namespace geomgraph { // geos.geomgraph
 
 NodeMap::NodeMap(const NodeFactory& newNodeFact)
     :
-    nodeFact(newNodeFact)
+    nodeFact(newNodeFact),
+    nSorted(0)
 {
 #if GEOS_DEBUG
     cerr << "[" << this << "] NodeMap::NodeMap" << endl;
@@ -49,12 +51,30 @@ NodeMap::NodeMap(const NodeFactory& newNodeFact)
 
 NodeMap::~NodeMap()
 {
-    NodeMap::const_iterator it = nodeMap.begin();
-    for(; it != nodeMap.end(); it++) {
-        delete it->second;
+    for(const pair& p : nodeMap) {
+        delete p.second;
     }
 }
 
+/*public*/
+void
+NodeMap::prepare()
+{
+    if(nSorted == nodeMap.size()) {
+        return;
+    }
+    // The nodes added since the last call are sorted on their own,
+    // then merged with the already sorted ones
+    CoordinateLessThen lessThen;
+    auto byCoord = [&lessThen](const pair& a, const pair& b) {
+        return lessThen(a.first, b.first);
+    };
+    iterator mid = nodeMap.begin() + static_cast<container::difference_type>(nSorted);
+    std::sort(mid, nodeMap.end(), byCoord);
+    std::inplace_merge(nodeMap.begin(), mid, nodeMap.end(), byCoord);
+    nSorted = nodeMap.size();
+}
+
 Node*
 NodeMap::addNode(const Coordinate& coord)
 {
@@ -69,8 +89,8 @@ NodeMap::addNode(const Coordinate& coord)
         node = nodeFact.createNode(coord);
         Coordinate* c = const_cast<Coordinate*>(
                             &(node->getCoordinate()));
-        nodeMap[c] = node;
-        //nodeMap[const_cast<Coordinate *>(&coord)]=node;
+        nodeIndex.insert(*c, node);
+        nodeMap.emplace_back(c, node);
     }
     else {
 #if GEOS_DEBUG
@@ -97,7 +117,8 @@ NodeMap::addNode(Node* n)
 #if GEOS_DEBUG
         cerr << " is new" << endl;
 #endif
-        nodeMap[c] = n;
+        nodeIndex.insert(*c, n);
+        nodeMap.emplace_back(c, n);
         return n;
     }
 #if GEOS_DEBUG
@@ -128,23 +149,14 @@ NodeMap::add(EdgeEnd* e)
 Node*
 NodeMap::find(const Coordinate& coord) const
 {
-    Coordinate* c = const_cast<Coordinate*>(&coord);
-
-    NodeMap::const_iterator found = nodeMap.find(c);
-
-    if(found == nodeMap.end()) {
-        return nullptr;
-    }
-    else {
-        return found->second;
-    }
+    Node* const* found = nodeIndex.find(coord);
+    return found ? *found : nullptr;
 }
 
 void
 NodeMap::getBoundaryNodes(int geomIndex, vector<Node*>& bdyNodes) const
 {
-    NodeMap::const_iterator it = nodeMap.begin();
-    for(; it != nodeMap.end(); it++) {
+    for(const_iterator it = begin(), itEnd = end(); it != itEnd; ++it) {
         Node* node = it->second;
         if(node->getLabel().getLocation(geomIndex) == Location::BOUNDARY) {
             bdyNodes.push_back(node);
@@ -156,8 +168,7 @@ string
 NodeMap::print() const
 {
     string out = "";
-    NodeMap::const_iterator it = nodeMap.begin();
-    for(; it != nodeMap.end(); it++) {
+    for(const_iterator it = begin(), itEnd = end(); it != itEnd; ++it) {
         Node* node = it->second;
         out += node->print();
     }
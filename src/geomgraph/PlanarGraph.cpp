@@ -159,8 +159,8 @@ void
 PlanarGraph::getNodes(vector<Node*>& values)
 {
     assert(nodes);
-    NodeMap::iterator it = nodes->nodeMap.begin();
-    while(it != nodes->nodeMap.end()) {
+    NodeMap::iterator it = nodes->begin();
+    while(it != nodes->end()) {
         assert(it->second);
         values.push_back(it->second);
         it++;
@@ -232,8 +232,8 @@ PlanarGraph::linkResultDirectedEdges()
 #if GEOS_DEBUG
     cerr << "PlanarGraph::linkResultDirectedEdges called" << endl;
 #endif
-    NodeMap::iterator nodeit = nodes->nodeMap.begin();
-    for(; nodeit != nodes->nodeMap.end(); nodeit++) {
+    NodeMap::iterator nodeit = nodes->begin();
+    for(; nodeit != nodes->end(); nodeit++) {
         Node* node = nodeit->second;
         assert(node);
 
@@ -258,8 +258,8 @@ PlanarGraph::linkAllDirectedEdges()
 #if GEOS_DEBUG
     cerr << "PlanarGraph::linkAllDirectedEdges called" << endl;
 #endif
-    NodeMap::iterator nodeit = nodes->nodeMap.begin();
-    for(; nodeit != nodes->nodeMap.end(); nodeit++) {
+    NodeMap::iterator nodeit = nodes->begin();
+    for(; nodeit != nodes->end(); nodeit++) {
         Node* node = nodeit->second;
         assert(node);
 
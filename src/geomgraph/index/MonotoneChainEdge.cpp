@@ -109,55 +109,14 @@ MonotoneChainEdge::computeIntersectsForChain(size_t chainIndex0,
         const MonotoneChainEdge& mce, size_t chainIndex1,
         SegmentIntersector& si)
 {
-    computeIntersectsForChain(startIndex[chainIndex0],
-                              startIndex[chainIndex0 + 1], mce,
-                              mce.startIndex[chainIndex1],
-                              mce.startIndex[chainIndex1 + 1],
-                              si);
-}
-
-void
-MonotoneChainEdge::computeIntersectsForChain(size_t start0, size_t end0,
-        const MonotoneChainEdge& mce, size_t start1, size_t end1,
-        SegmentIntersector& ei)
-{
-    // terminating condition for the recursion
-    if(end0 - start0 == 1 && end1 - start1 == 1) {
-        ei.addIntersections(e, start0, mce.e, start1);
-        return;
-    }
-
-    if(!overlaps(start0, end0, mce, start1, end1)) {
-        return;
-    }
-    // the chains overlap, so split each in half and iterate
-    // (binary search)
-    size_t mid0 = (start0 + end0) / 2;
-    size_t mid1 = (start1 + end1) / 2;
-
-    // Assert: mid != start or end
-    // (since we checked above for end - start <= 1)
-    // check terminating conditions before recursing
-    if(start0 < mid0) {
-        if(start1 < mid1)
-            computeIntersectsForChain(start0, mid0, mce,
-                                      start1, mid1, ei);
-        if(mid1 < end1)
-            computeIntersectsForChain(start0, mid0, mce,
-                                      mid1, end1, ei);
-    }
-    if(mid0 < end0) {
-        if(start1 < mid1)
-            computeIntersectsForChain(mid0, end0, mce,
-                                      start1, mid1, ei);
-        if(mid1 < end1)
-            computeIntersectsForChain(mid0, end0, mce,
-                                      mid1, end1, ei);
-    }
+    auto addIntersections = [&si](Edge* e0, size_t i0, Edge* e1, size_t i1) {
+        si.addIntersections(e0, i0, e1, i1);
+    };
+    visitChainSegmentPairs(chainIndex0, mce, chainIndex1, addIntersections);
 }
 
 bool
-MonotoneChainEdge::overlaps(size_t start0, size_t end0, const MonotoneChainEdge& mce, size_t start1, size_t end1)
+MonotoneChainEdge::overlaps(size_t start0, size_t end0, const MonotoneChainEdge& mce, size_t start1, size_t end1) const
 {
     return Envelope::intersects(pts->getAt(start0), pts->getAt(end0),
                                 mce.pts->getAt(start1), mce.pts->getAt(end1));
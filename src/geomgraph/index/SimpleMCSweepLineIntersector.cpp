@@ -14,14 +14,18 @@
  **********************************************************************/
 
 #include <algorithm>
+#include <atomic>
 #include <vector>
 
+#include <geos/algorithm/LineIntersector.h>
 #include <geos/geomgraph/index/SimpleMCSweepLineIntersector.h>
 #include <geos/geomgraph/index/MonotoneChainEdge.h>
 #include <geos/geomgraph/index/MonotoneChain.h>
 #include <geos/geomgraph/index/SweepLineEvent.h>
 #include <geos/geomgraph/Edge.h>
+#include <geos/geom/CoordinateSequence.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/ParallelChunks.h>
 
 using namespace std;
 
@@ -29,9 +33,36 @@ namespace geos {
 namespace geomgraph { // geos.geomgraph
 namespace index { // geos.geomgraph.index
 
+namespace {
+
+/// A pair of intersecting segments, found while processing an insert event
+struct SegmentPair {
+    size_t event;
+    Edge* e0;
+    size_t segIndex0;
+    Edge* e1;
+    size_t segIndex1;
+};
+
+/// Number of events handed to a thread at a time
+const size_t EVENTS_PER_CHUNK = 256;
+
+/// Below this number of events, threads cost more than they save
+const size_t MIN_PARALLEL_EVENTS = 4 * EVENTS_PER_CHUNK;
+
+} // anonymous namespace
+
 SimpleMCSweepLineIntersector::SimpleMCSweepLineIntersector()
-//events(new vector<SweepLineEvent*>())
+    :
+    nOverlaps(0),
+    numThreads(1)
+{
+}
+
+void
+SimpleMCSweepLineIntersector::setNumThreads(size_t n)
 {
+    numThreads = util::normalizeThreadCount(n);
 }
 
 SimpleMCSweepLineIntersector::~SimpleMCSweepLineIntersector()
@@ -125,6 +156,10 @@ SimpleMCSweepLineIntersector::computeIntersections(SegmentIntersector* si)
 {
     nOverlaps = 0;
     prepareEvents();
+    if(numThreads > 1 && events.size() >= MIN_PARALLEL_EVENTS) {
+        computeIntersectionsParallel(si);
+        return;
+    }
     for(size_t i = 0; i < events.size(); ++i) {
         GEOS_CHECK_FOR_INTERRUPTS();
         SweepLineEvent* ev = events[i];
@@ -137,6 +172,77 @@ SimpleMCSweepLineIntersector::computeIntersections(SegmentIntersector* si)
     }
 }
 
+/*
+ * The threads only read the edges. For each insert event they record
+ * the pairs of segments which intersect, as found by a LineIntersector
+ * of their own; the SegmentIntersector, which adds the intersections to
+ * the edges, then sees the same pairs as in a single-threaded sweep,
+ * without the ones that do not intersect, which it would ignore.
+ */
+void
+SimpleMCSweepLineIntersector::computeIntersectionsParallel(SegmentIntersector* si)
+{
+    size_t nEvents = events.size();
+    size_t nChunks = (nEvents + EVENTS_PER_CHUNK - 1) / EVENTS_PER_CHUNK;
+    vector<vector<SegmentPair>> chunkPairs(nChunks);
+    std::atomic<int> overlapCount(0);
+
+    util::runChunks(nChunks, numThreads, algorithm::LineIntersector(),
+    [&](size_t chunk, algorithm::LineIntersector & li) {
+        vector<SegmentPair>& pairs = chunkPairs[chunk];
+        size_t event = 0;
+        auto recordPair = [&](Edge* e0, size_t segIndex0,
+                              Edge* e1, size_t segIndex1) {
+            if(e0 == e1 && segIndex0 == segIndex1) {
+                return;
+            }
+            const geom::CoordinateSequence* cl0 = e0->getCoordinates();
+            const geom::CoordinateSequence* cl1 = e1->getCoordinates();
+            li.computeIntersection(cl0->getAt(segIndex0), cl0->getAt(segIndex0 + 1),
+                                   cl1->getAt(segIndex1), cl1->getAt(segIndex1 + 1));
+            if(li.hasIntersection()) {
+                pairs.push_back({event, e0, segIndex0, e1, segIndex1});
+            }
+        };
+
+        int overlaps = 0;
+        size_t end = std::min(nEvents, (chunk + 1) * EVENTS_PER_CHUNK);
+        for(event = chunk * EVENTS_PER_CHUNK; event < end; ++event) {
+            SweepLineEvent* ev0 = events[event];
+            if(!ev0->isInsert()) {
+                continue;
+            }
+            MonotoneChain* mc0 = (MonotoneChain*) ev0->getObject();
+            for(size_t i = event, iEnd = ev0->getDeleteEventIndex(); i < iEnd; ++i) {
+                SweepLineEvent* ev1 = events[i];
+                if(ev1->isInsert() &&
+                        (ev0->edgeSet == nullptr || ev0->edgeSet != ev1->edgeSet)) {
+                    mc0->visitSegmentPairs((MonotoneChain*) ev1->getObject(), recordPair);
+                    overlaps++;
+                }
+            }
+        }
+        overlapCount += overlaps;
+    });
+
+    nOverlaps = overlapCount;
+
+    // as in the single-threaded sweep, stop after the event which
+    // made the SegmentIntersector done
+    size_t lastEvent = nEvents;
+    for(const auto& pairs : chunkPairs) {
+        for(const SegmentPair& p : pairs) {
+            if(p.event != lastEvent) {
+                if(si->getIsDone()) {
+                    return;
+                }
+                lastEvent = p.event;
+            }
+            si->addIntersections(p.e0, p.segIndex0, p.e1, p.segIndex1);
+        }
+    }
+}
+
 void
 SimpleMCSweepLineIntersector::processOverlaps(size_t start, size_t end,
         SweepLineEvent* ev0, SegmentIntersector* si)
@@ -19,6 +19,7 @@
 #include <geos/index/chain/MonotoneChainBuilder.h>
 #include <geos/index/chain/MonotoneChain.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/PackedCoordinateSequence.h>
 #include <geos/geomgraph/Quadrant.h>
 
 #include <cassert>
@@ -41,6 +42,44 @@ namespace geos {
 namespace index { // geos.index
 namespace chain { // geos.index.chain
 
+namespace {
+
+/*
+ * findChainEnd over a packed ordinate buffer with D ordinates per point,
+ * avoiding the Coordinate cache of PackedCoordinateSequence.
+ */
+template<std::size_t D>
+std::size_t
+findPackedChainEnd(const double* p, std::size_t npts, std::size_t start)
+{
+    auto equals2D = [p](std::size_t i, std::size_t j) {
+        return p[i * D] == p[j * D] && p[i * D + 1] == p[j * D + 1];
+    };
+    auto quadrant = [p](std::size_t i, std::size_t j) {
+        return Quadrant::quadrant(p[j * D] - p[i * D], p[j * D + 1] - p[i * D + 1]);
+    };
+
+    std::size_t safeStart = start;
+    while(safeStart < npts - 1 && equals2D(safeStart, safeStart + 1)) {
+        ++safeStart;
+    }
+    if(safeStart >= npts - 1) {
+        return npts - 1;
+    }
+
+    int chainQuad = quadrant(safeStart, safeStart + 1);
+    std::size_t last = start + 1;
+    while(last < npts) {
+        if(! equals2D(last - 1, last) && quadrant(last - 1, last) != chainQuad) {
+            break;
+        }
+        ++last;
+    }
+    return last - 1;
+}
+
+}
+
 /* static public */
 std::unique_ptr<std::vector<std::unique_ptr<MonotoneChain>>>
 MonotoneChainBuilder::getChains(const CoordinateSequence* pts, void* context)
@@ -77,6 +116,21 @@ MonotoneChainBuilder::getChainStartIndices(const CoordinateSequence& pts,
     std::size_t start = 0;
     startIndexList.push_back(start);
     const std::size_t n = pts.getSize() - 1;
+
+    const PackedCoordinateSequence* packed =
+        dynamic_cast<const PackedCoordinateSequence*>(&pts);
+    if(packed) {
+        do {
+            std::size_t last = packed->getDimension() == 2 ?
+                               findPackedChainEnd<2>(packed->data(), n + 1, start) :
+                               findPackedChainEnd<3>(packed->data(), n + 1, start);
+            startIndexList.push_back(last);
+            start = last;
+        }
+        while(start < n);
+        return;
+    }
+
     do {
         std::size_t last = findChainEnd(pts, start);
         startIndexList.push_back(last);
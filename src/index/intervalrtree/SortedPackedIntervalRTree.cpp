@@ -31,16 +31,6 @@ namespace intervalrtree {
 //
 // private:
 //
-void
-SortedPackedIntervalRTree::init()
-{
-    if(root != nullptr) {
-        return;
-    }
-
-    root = buildTree();
-}
-
 const IntervalRTreeNode*
 SortedPackedIntervalRTree::buildTree()
 {
@@ -107,11 +97,25 @@ SortedPackedIntervalRTree::insert(double min, double max, void* item)
     leaves.emplace_back(min, max, item);
 }
 
+void
+SortedPackedIntervalRTree::init()
+{
+    if(root != nullptr || leaves.empty()) {
+        return;
+    }
+
+    root = buildTree();
+}
+
 void
 SortedPackedIntervalRTree::query(double min, double max, index::ItemVisitor* visitor)
 {
     init();
 
+    if(root == nullptr) {
+        return;
+    }
+
     root->query(min, max, visitor);
 }
 
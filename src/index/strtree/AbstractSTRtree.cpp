@@ -58,6 +58,11 @@ AbstractSTRtree::build()
     }
 
     root = (itemBoundables->empty() ? createNode(0) : createHigherLevels(itemBoundables, -1));
+    if(! itemBoundables->empty()) {
+        // computed lazily otherwise, which would make the first
+        // queries of a built tree write to it
+        root->getBounds();
+    }
     built = true;
 }
 
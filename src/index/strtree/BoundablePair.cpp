@@ -21,6 +21,9 @@
 #include <geos/index/strtree/AbstractNode.h>
 #include <geos/util/IllegalArgumentException.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace geos {
 namespace index {
 namespace strtree {
@@ -61,6 +64,20 @@ BoundablePair::distance() const
     return e1->distance(e2);
 }
 
+double
+BoundablePair::maximumDistance() const
+{
+    const geom::Envelope* e1 = (const geom::Envelope*) boundable1->getBounds();
+    const geom::Envelope* e2 = (const geom::Envelope*) boundable2->getBounds();
+
+    if(!e1 || !e2) {
+        throw util::GEOSException("Can't compute envelope of item in BoundablePair");
+    }
+    double dx = std::max(e1->getMaxX(), e2->getMaxX()) - std::min(e1->getMinX(), e2->getMinX());
+    double dy = std::max(e1->getMaxY(), e2->getMaxY()) - std::min(e1->getMinY(), e2->getMinY());
+    return std::sqrt(dx * dx + dy * dy);
+}
+
 double
 BoundablePair::getDistance() const
 {
@@ -98,20 +115,20 @@ BoundablePair::expandToQueue(BoundablePairQueue& priQ, double minDistance)
      */
     if(isComp1 && isComp2) {
         if(area(boundable1) > area(boundable2)) {
-            expand(boundable1, boundable2, priQ, minDistance);
+            expand(boundable1, boundable2, false, priQ, minDistance);
             return;
         }
         else {
-            expand(boundable2, boundable1, priQ, minDistance);
+            expand(boundable2, boundable1, true, priQ, minDistance);
             return;
         }
     }
     else if(isComp1) {
-        expand(boundable1, boundable2, priQ, minDistance);
+        expand(boundable1, boundable2, false, priQ, minDistance);
         return;
     }
     else if(isComp2) {
-        expand(boundable2, boundable1, priQ, minDistance);
+        expand(boundable2, boundable1, true, priQ, minDistance);
         return;
     }
 
@@ -121,11 +138,24 @@ BoundablePair::expandToQueue(BoundablePairQueue& priQ, double minDistance)
 void
 BoundablePair::expand(const Boundable* bndComposite, const Boundable* bndOther, BoundablePairQueue& priQ,
                       double minDistance)
+{
+    expand(bndComposite, bndOther, false, priQ, minDistance);
+}
+
+void
+BoundablePair::expand(const Boundable* bndComposite, const Boundable* bndOther, bool isFlipped,
+                      BoundablePairQueue& priQ, double minDistance)
 {
     std::vector<Boundable*>* children = ((AbstractNode*) bndComposite)->getChildBoundables();
     for(std::vector<Boundable*>::iterator it = children->begin(); it != children->end(); ++it) {
         Boundable* child = *it;
-        std::unique_ptr<BoundablePair> bp(new BoundablePair(child, bndOther, itemDistance));
+        std::unique_ptr<BoundablePair> bp;
+        if(isFlipped) {
+            bp.reset(new BoundablePair(bndOther, child, itemDistance));
+        }
+        else {
+            bp.reset(new BoundablePair(child, bndOther, itemDistance));
+        }
         if(minDistance == std::numeric_limits<double>::infinity() || bp->getDistance() < minDistance) {
             priQ.push(bp.release());
         }
@@ -0,0 +1,172 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/index/ItemVisitor.h>
+#include <geos/geom/Envelope.h>
+#include <geos/util/UnsupportedOperationException.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace index { // geos.index
+namespace strtree { // geos.index.strtree
+
+/*public*/
+PackedSTRtree::PackedSTRtree(std::size_t p_nodeCapacity)
+    :
+    nodeCapacity(p_nodeCapacity),
+    built(false)
+{
+    assert(nodeCapacity > 1);
+}
+
+/*public*/
+void
+PackedSTRtree::insert(const Envelope* itemEnv, void* item)
+{
+    assert(!built);
+    if(itemEnv->isNull()) {
+        return;
+    }
+    nodeBounds.push_back(*itemEnv);
+    items.push_back(item);
+}
+
+/*private*/
+void
+PackedSTRtree::sortItems()
+{
+    std::size_t n = items.size();
+
+    // Sort by x of the centres, cut into vertical slices, and sort each
+    // slice by y. Slices hold a whole number of leaf nodes, so that
+    // no leaf node spans two slices.
+    std::size_t leafNodeCount = (n + nodeCapacity - 1) / nodeCapacity;
+    std::size_t sliceCount = static_cast<std::size_t>(
+                                 std::ceil(std::sqrt(static_cast<double>(leafNodeCount))));
+    std::size_t sliceCapacity = nodeCapacity
+                                * ((leafNodeCount + sliceCount - 1) / sliceCount);
+
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+
+    // centres are compared as sums, which orders them the same
+    std::sort(order.begin(), order.end(),
+    [this](std::size_t a, std::size_t b) {
+        return nodeBounds[a].getMinX() + nodeBounds[a].getMaxX()
+               < nodeBounds[b].getMinX() + nodeBounds[b].getMaxX();
+    });
+
+    for(std::size_t start = 0; start < n; start += sliceCapacity) {
+        std::size_t end = std::min(start + sliceCapacity, n);
+        std::sort(order.begin() + start, order.begin() + end,
+        [this](std::size_t a, std::size_t b) {
+            return nodeBounds[a].getMinY() + nodeBounds[a].getMaxY()
+                   < nodeBounds[b].getMinY() + nodeBounds[b].getMaxY();
+        });
+    }
+
+    // leave room for the upper levels of the tree
+    std::size_t nodeCount = n;
+    std::size_t levelSize = n;
+    do {
+        levelSize = (levelSize + nodeCapacity - 1) / nodeCapacity;
+        nodeCount += levelSize;
+    }
+    while(levelSize > 1);
+
+    std::vector<Envelope> sortedBounds;
+    std::vector<void*> sortedItems;
+    sortedBounds.reserve(nodeCount);
+    sortedItems.reserve(n);
+    for(std::size_t i : order) {
+        sortedBounds.push_back(nodeBounds[i]);
+        sortedItems.push_back(items[i]);
+    }
+    nodeBounds.swap(sortedBounds);
+    items.swap(sortedItems);
+}
+
+/*public*/
+void
+PackedSTRtree::build()
+{
+    if(built) {
+        return;
+    }
+    built = true;
+
+    if(items.empty()) {
+        return;
+    }
+
+    sortItems();
+
+    // Each upper level groups runs of nodeCapacity nodes of the level
+    // below, up to a single root node
+    levelOffsets.push_back(0);
+    std::size_t levelStart = 0;
+    std::size_t levelEnd = nodeBounds.size();
+    do {
+        levelOffsets.push_back(levelEnd);
+        for(std::size_t i = levelStart; i < levelEnd; i += nodeCapacity) {
+            Envelope env(nodeBounds[i]);
+            for(std::size_t j = i + 1, nj = std::min(i + nodeCapacity, levelEnd); j < nj; j++) {
+                env.expandToInclude(&nodeBounds[j]);
+            }
+            nodeBounds.push_back(env);
+        }
+        levelStart = levelEnd;
+        levelEnd = nodeBounds.size();
+    }
+    while(levelEnd - levelStart > 1);
+    levelOffsets.push_back(levelEnd);
+}
+
+/*public*/
+void
+PackedSTRtree::query(const Envelope* searchEnv, std::vector<void*>& matches)
+{
+    build();
+    query(*searchEnv, [&matches](void* item) {
+        matches.push_back(item);
+    });
+}
+
+/*public*/
+void
+PackedSTRtree::query(const Envelope* searchEnv, ItemVisitor& visitor)
+{
+    build();
+    query(*searchEnv, [&visitor](void* item) {
+        visitor.visitItem(item);
+    });
+}
+
+/*public*/
+bool
+PackedSTRtree::remove(const Envelope* /*itemEnv*/, void* /*item*/)
+{
+    throw util::UnsupportedOperationException(
+        "PackedSTRtree does not support removing items");
+}
+
+} // namespace geos.index.strtree
+} // namespace geos.index
+} // namespace geos
@@ -287,6 +287,85 @@ STRtree::nearestNeighbour(BoundablePair* initBndPair, double maxDistance)
     return std::pair<const void*, const void*>(item0, item1);
 }
 
+bool
+STRtree::isWithinDistance(STRtree* tree, ItemDistance* itemDist, double maxDistance)
+{
+    build();
+    tree->build();
+
+    BoundablePair bp(getRoot(), tree->getRoot(), itemDist);
+    return isWithinDistance(&bp, maxDistance);
+}
+
+bool
+STRtree::isWithinDistance(const Envelope* env, const void* item, ItemDistance* itemDist,
+                          double maxDistance)
+{
+    build();
+
+    ItemBoundable bnd = ItemBoundable(env, (void*) item);
+    BoundablePair bp(getRoot(), &bnd, itemDist);
+
+    return isWithinDistance(&bp, maxDistance);
+}
+
+bool
+STRtree::isWithinDistance(BoundablePair* initBndPair, double maxDistance)
+{
+    bool isWithin = false;
+
+    BoundablePair::BoundablePairQueue priQ;
+    priQ.push(initBndPair);
+
+    while(!priQ.empty()) {
+        BoundablePair* bndPair = priQ.top();
+        priQ.pop();
+
+        double currentDistance = bndPair->getDistance();
+
+        /**
+         * The pairs are dequeued by increasing distance, so if this
+         * one is too far apart all the remaining ones are.
+         */
+        if(currentDistance > maxDistance) {
+            if(bndPair != initBndPair) {
+                delete bndPair;
+            }
+            break;
+        }
+
+        /**
+         * A pair of items within the distance, or a pair of nodes
+         * whose bounds are entirely within it, answers the test.
+         */
+        if(bndPair->isLeaves() || bndPair->maximumDistance() <= maxDistance) {
+            isWithin = true;
+            if(bndPair != initBndPair) {
+                delete bndPair;
+            }
+            break;
+        }
+
+        // only queue the pairs at most maxDistance apart
+        bndPair->expandToQueue(priQ, std::nextafter(maxDistance, std::numeric_limits<double>::infinity()));
+
+        if(bndPair != initBndPair) {
+            delete bndPair;
+        }
+    }
+
+    /* Free any remaining BoundablePairs in the queue */
+    while(!priQ.empty()) {
+        BoundablePair* bndPair = priQ.top();
+        priQ.pop();
+        if(bndPair != initBndPair) {
+            delete bndPair;
+        }
+    }
+
+    return isWithin;
+}
+
 class STRAbstractNode: public AbstractNode {
 public:
 
@@ -0,0 +1,290 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: ORIGINAL WORK
+ *
+ **********************************************************************/
+
+#include <geos/io/NumberConversion.h>
+
+#include <algorithm>
+#include <clocale>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+// Powers of ten exactly representable as doubles
+const double POW10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20,
+    1e21, 1e22
+};
+
+const int MAX_EXACT_POW10 = 22;
+
+// Integers up to 2^53 are exactly representable as doubles
+const std::uint64_t MAX_EXACT_INT = std::uint64_t(1) << 53;
+
+// Significant digits accumulated before the mantissa could overflow
+const int MAX_MANTISSA_DIGITS = 19;
+
+bool
+isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool
+isPrintfChar(char c)
+{
+    // what printf writes for a double, apart from the decimal point:
+    // digits, signs, exponent markers and the letters of inf and nan
+    return isDigit(c) || c == '-' || c == '+' ||
+           (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+bool
+equalsIgnoreCase(const char* str, std::size_t len, const char* word)
+{
+    if(std::strlen(word) != len) {
+        return false;
+    }
+    for(std::size_t i = 0; i < len; ++i) {
+        char c = str[i];
+        if(c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+        if(c != word[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Formats with printf, then replaces whatever decimal point the
+ * current locale uses, which may span several bytes, with '.'.
+ * This only reads the locale, so it is safe to run concurrently.
+ */
+std::size_t
+formatNumber(const char* format, double d, int precision,
+             char* buf, std::size_t size)
+{
+    precision = std::max(0, std::min(precision, NumberConversion::MAX_PRECISION));
+
+    // some room for a multi-byte decimal point
+    char tmp[NumberConversion::BUFFER_SIZE + 8];
+    int n = std::snprintf(tmp, sizeof(tmp), format, precision, d);
+    if(n < 0) {
+        n = 0;
+    }
+    std::size_t len = std::min(static_cast<std::size_t>(n), sizeof(tmp) - 1);
+
+    std::size_t out = 0;
+    for(std::size_t i = 0; i < len;) {
+        if(isPrintfChar(tmp[i])) {
+            tmp[out++] = tmp[i++];
+        }
+        else {
+            tmp[out++] = '.';
+            while(i < len && ! isPrintfChar(tmp[i])) {
+                ++i;
+            }
+        }
+    }
+
+    if(size > 0) {
+        std::size_t ncopy = std::min(out, size - 1);
+        std::memcpy(buf, tmp, ncopy);
+        buf[ncopy] = '\0';
+    }
+    return out;
+}
+
+/*
+ * Correctly rounded conversion of an already validated number, for
+ * the cases the fast path cannot handle exactly, with strtod. As it
+ * follows the decimal point of the current C locale, the number is
+ * copied with its '.' replaced by that one, into a stack buffer
+ * unless it is too long for it.
+ */
+double
+parseDoubleStrtod(const char* str, std::size_t len)
+{
+    const char* point = static_cast<const char*>(std::memchr(str, '.', len));
+    const char* decimalPoint = point ? std::localeconv()->decimal_point : "";
+    std::size_t before = point ? static_cast<std::size_t>(point - str) : len;
+    std::size_t pointLen = std::strlen(decimalPoint);
+    const char* rest = point ? point + 1 : str + len;
+    std::size_t after = len - static_cast<std::size_t>(rest - str);
+
+    if(before + pointLen + after < NumberConversion::BUFFER_SIZE) {
+        char buf[NumberConversion::BUFFER_SIZE];
+        std::memcpy(buf, str, before);
+        std::memcpy(buf + before, decimalPoint, pointLen);
+        std::memcpy(buf + before + pointLen, rest, after);
+        buf[before + pointLen + after] = '\0';
+        return std::strtod(buf, nullptr);
+    }
+
+    std::string num(str, before);
+    num.append(decimalPoint);
+    num.append(rest, after);
+    return std::strtod(num.c_str(), nullptr);
+}
+
+} // anonymous namespace
+
+const std::size_t NumberConversion::BUFFER_SIZE;
+const int NumberConversion::MAX_PRECISION;
+
+/* public static */
+std::size_t
+NumberConversion::writeFixed(double d, int precision, char* buf, std::size_t size)
+{
+    return formatNumber("%.*f", d, precision, buf, size);
+}
+
+/* public static */
+std::size_t
+NumberConversion::writeGeneral(double d, int precision, char* buf, std::size_t size)
+{
+    return formatNumber("%.*g", d, precision, buf, size);
+}
+
+/* public static */
+bool
+NumberConversion::parseDouble(const char* str, std::size_t len, double& result)
+{
+    const char* p = str;
+    const char* end = str + len;
+
+    bool negative = false;
+    if(p != end && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        ++p;
+    }
+    if(p == end) {
+        return false;
+    }
+
+    if(! isDigit(*p) && *p != '.') {
+        std::size_t wordLen = static_cast<std::size_t>(end - p);
+        if(equalsIgnoreCase(p, wordLen, "inf") ||
+                equalsIgnoreCase(p, wordLen, "infinity")) {
+            result = negative ? -std::numeric_limits<double>::infinity()
+                     : std::numeric_limits<double>::infinity();
+            return true;
+        }
+        if(equalsIgnoreCase(p, wordLen, "nan")) {
+            result = std::numeric_limits<double>::quiet_NaN();
+            return true;
+        }
+        return false;
+    }
+
+    std::uint64_t mantissa = 0;
+    int nDigits = 0;        // significant digits in mantissa
+    long exponent = 0;      // decimal exponent applying to mantissa
+    bool inexact = false;   // non-zero digits were dropped
+    bool anyDigits = false;
+
+    for(; p != end && isDigit(*p); ++p) {
+        anyDigits = true;
+        if(nDigits < MAX_MANTISSA_DIGITS) {
+            mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+            if(mantissa != 0) {
+                ++nDigits;
+            }
+        }
+        else {
+            ++exponent;
+            inexact = inexact || *p != '0';
+        }
+    }
+    if(p != end && *p == '.') {
+        for(++p; p != end && isDigit(*p); ++p) {
+            anyDigits = true;
+            if(nDigits < MAX_MANTISSA_DIGITS) {
+                mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+                if(mantissa != 0) {
+                    ++nDigits;
+                }
+                --exponent;
+            }
+            else {
+                inexact = inexact || *p != '0';
+            }
+        }
+    }
+    if(! anyDigits) {
+        return false;
+    }
+
+    if(p != end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negativeExp = false;
+        if(p != end && (*p == '+' || *p == '-')) {
+            negativeExp = (*p == '-');
+            ++p;
+        }
+        if(p == end || ! isDigit(*p)) {
+            return false;
+        }
+        long e = 0;
+        for(; p != end && isDigit(*p); ++p) {
+            // anything this large over- or underflows anyway
+            if(e < 100000) {
+                e = e * 10 + (*p - '0');
+            }
+        }
+        exponent += negativeExp ? -e : e;
+    }
+    if(p != end) {
+        return false;
+    }
+
+    if(mantissa == 0 && ! inexact) {
+        result = negative ? -0.0 : 0.0;
+        return true;
+    }
+
+    // Both the mantissa and the power of ten are exact doubles,
+    // so a single correctly rounded operation gives the correctly
+    // rounded result (Clinger's fast path).
+    if(! inexact && mantissa <= MAX_EXACT_INT &&
+            exponent >= -MAX_EXACT_POW10 && exponent <= MAX_EXACT_POW10) {
+        double d = static_cast<double>(mantissa);
+        if(exponent < 0) {
+            d /= POW10[-exponent];
+        }
+        else {
+            d *= POW10[exponent];
+        }
+        result = negative ? -d : d;
+        return true;
+    }
+
+    result = parseDoubleStrtod(str, len);
+    return true;
+}
+
+} // namespace geos.io
+} // namespace geos
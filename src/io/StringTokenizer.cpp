@@ -18,10 +18,9 @@
  **********************************************************************/
 
 #include <geos/io/StringTokenizer.h>
+#include <geos/io/NumberConversion.h>
 
 #include <string>
-#include <cstdlib>
-#include <limits>
 
 using namespace std;
 
@@ -38,47 +37,10 @@ StringTokenizer::StringTokenizer(const string& txt)
     iter = str.begin();
 }
 
-double
-strtod_with_vc_fix(const char* str, char** str_end)
-{
-    double dbl = strtod(str, str_end);
-#if _MSC_VER && !__INTEL_COMPILER
-    // Special handling of NAN and INF in MSVC, where strtod returns 0.0
-    // for NAN and INF.
-    // This fixes failing test GEOSisValidDetail::test<3>, maybe others
-    // as well.
-    // Note: this hack is not robust, Boost lexical_cast or
-    // std::stod (C++11) would be better.
-    if(*str_end[0] != '\0') {
-        char sign = 0;
-        const char* pos = str;
-        if(*pos == '+' || *pos == '-') {
-            sign = *pos++;
-        }
-
-        if(stricmp(pos, "inf") == 0) {
-            if(!sign || sign == '+') {
-                dbl = std::numeric_limits<double>::infinity();
-            }
-            else {
-                dbl = -(std::numeric_limits<double>::infinity)();
-            }
-            *str_end[0] = '\0';
-        }
-        else if(stricmp(pos, "nan") == 0) {
-            dbl = std::numeric_limits<double>::quiet_NaN();
-            *str_end[0] = '\0';
-        }
-    }
-#endif
-    return dbl;
-}
-
 /*public*/
 int
 StringTokenizer::nextToken()
 {
-    string tok = "";
     if(iter == str.end()) {
         return StringTokenizer::TT_EOF;
     }
@@ -103,31 +65,10 @@ StringTokenizer::nextToken()
     }
     string::size_type pos = str.find_first_of("\n\r\t() ,",
                             iter - str.begin());
-    if(pos == string::npos) {
-        if(iter != str.end()) {
-            tok.assign(iter, str.end());
-            iter = str.end();
-        }
-        else {
-            return StringTokenizer::TT_EOF;
-        }
-    }
-    else {
-        tok.assign(iter, str.begin() + pos);
-        iter = str.begin() + pos;
-    }
-    char* stopstring;
-    double dbl = strtod_with_vc_fix(tok.c_str(), &stopstring);
-    if(*stopstring == '\0') {
-        ntok = dbl;
-        stok = "";
-        return StringTokenizer::TT_NUMBER;
-    }
-    else {
-        ntok = 0.0;
-        stok = tok;
-        return StringTokenizer::TT_WORD;
-    }
+    string::const_iterator tokEnd = pos == string::npos ? str.end() : str.begin() + pos;
+    string::const_iterator tokStart = iter;
+    iter = tokEnd;
+    return classifyToken(tokStart, tokEnd);
 }
 
 /*public*/
@@ -136,7 +77,6 @@ StringTokenizer::peekNextToken()
 {
 
     string::size_type pos;
-    string tok = "";
     if(iter == str.end()) {
         return StringTokenizer::TT_EOF;
     }
@@ -156,30 +96,28 @@ StringTokenizer::peekNextToken()
     // It's either a Number or a Word, let's
     // see when it ends
 
-    pos = str.find_first_of("\n\r\t() ,", iter - str.begin());
-
-    if(pos == string::npos) {
-        if(iter != str.end()) {
-            tok.assign(iter, str.end());
-        }
-        else {
-            return StringTokenizer::TT_EOF;
-        }
-    }
-    else {
-        tok.assign(iter, str.begin() + pos); //str.end());
-    }
+    string::const_iterator tokStart = str.begin() + pos;
+    pos = str.find_first_of("\n\r\t() ,", pos);
+    string::const_iterator tokEnd = pos == string::npos ? str.end() : str.begin() + pos;
+    return classifyToken(tokStart, tokEnd);
+}
 
-    char* stopstring;
-    double dbl = strtod_with_vc_fix(tok.c_str(), &stopstring);
-    if(*stopstring == '\0') {
+/*private*/
+int
+StringTokenizer::classifyToken(string::const_iterator tokStart,
+                               string::const_iterator tokEnd)
+{
+    // numbers are parsed in place, only words are copied out
+    double dbl;
+    if(NumberConversion::parseDouble(&*tokStart,
+                                     static_cast<size_t>(tokEnd - tokStart), dbl)) {
         ntok = dbl;
-        stok = "";
+        stok.clear();
         return StringTokenizer::TT_NUMBER;
     }
     else {
         ntok = 0.0;
-        stok = tok;
+        stok.assign(tokStart, tokEnd);
         return StringTokenizer::TT_WORD;
     }
 }
@@ -33,7 +33,9 @@
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/PrecisionModel.h>
 
+#include <algorithm>
 #include <iomanip>
+#include <memory>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -46,6 +48,16 @@ using namespace geos::geom;
 namespace geos {
 namespace io { // geos.io
 
+namespace {
+
+// byte order and type of an empty geometry
+const std::size_t WKB_MIN_GEOMETRY_SIZE = 5;
+
+// points decoded at once from an istream
+const std::size_t WKB_STREAM_CHUNK_POINTS = 1024;
+
+}
+
 WKBReader::WKBReader()
     :
     factory(*(GeometryFactory::getDefaultInstance()))
@@ -130,8 +142,8 @@ ASCIIHexToUChar(char val)
 Geometry*
 WKBReader::readHEX(istream& is)
 {
-    // setup input/output stream
-    stringstream os(ios_base::binary | ios_base::in | ios_base::out);
+    // decoded bytes
+    vector<unsigned char> bytes;
 
     while(true) {
         const int input_high = is.get();
@@ -156,12 +168,11 @@ WKBReader::readHEX(istream& is)
 #if DEBUG_HEX_READER
         cout << "HEX " << high << low << " -> DEC " << (int)value << endl;
 #endif
-        // write the value to the output stream
-        os << value;
+        bytes.push_back(value);
     }
 
     // now call read to convert the geometry
-    return this->read(os);
+    return this->read(bytes.data(), bytes.size());
 }
 
 Geometry*
@@ -171,6 +182,13 @@ WKBReader::read(istream& is)
     return readGeometry();
 }
 
+Geometry*
+WKBReader::read(const unsigned char* buf, size_t size)
+{
+    dis.setInStream(buf, size); // will default to machine endian
+    return readGeometry();
+}
+
 Geometry*
 WKBReader::readGeometry()
 {
@@ -271,6 +289,18 @@ WKBReader::readGeometry()
     return result;
 }
 
+int
+WKBReader::readCount(std::size_t minElementSize)
+{
+    int count = dis.readInt();
+    // every element takes some bytes, so a valid count is bounded by
+    // what is left to read
+    if(count < 0 || (dis.hasSize() && dis.size() / minElementSize < static_cast<std::size_t>(count))) {
+        throw ParseException("Invalid number of elements in WKB");
+    }
+    return count;
+}
+
 Point*
 WKBReader::readPoint()
 {
@@ -308,7 +338,7 @@ WKBReader::readLinearRing()
 Polygon*
 WKBReader::readPolygon()
 {
-    int numRings = dis.readInt();
+    int numRings = readCount(4);
 
 #if DEBUG_WKB_READER
     cout << "WKB numRings: " << numRings << endl;
@@ -342,7 +372,7 @@ WKBReader::readPolygon()
 MultiPoint*
 WKBReader::readMultiPoint()
 {
-    int numGeoms = dis.readInt();
+    int numGeoms = readCount(WKB_MIN_GEOMETRY_SIZE);
     vector<Geometry*>* geoms = new vector<Geometry*>(numGeoms);
 
     try {
@@ -369,7 +399,7 @@ WKBReader::readMultiPoint()
 MultiLineString*
 WKBReader::readMultiLineString()
 {
-    int numGeoms = dis.readInt();
+    int numGeoms = readCount(WKB_MIN_GEOMETRY_SIZE);
     vector<Geometry*>* geoms = new vector<Geometry*>(numGeoms);
 
     try {
@@ -396,7 +426,7 @@ WKBReader::readMultiLineString()
 MultiPolygon*
 WKBReader::readMultiPolygon()
 {
-    int numGeoms = dis.readInt();
+    int numGeoms = readCount(WKB_MIN_GEOMETRY_SIZE);
     vector<Geometry*>* geoms = new vector<Geometry*>(numGeoms);
 
     try {
@@ -423,7 +453,7 @@ WKBReader::readMultiPolygon()
 GeometryCollection*
 WKBReader::readGeometryCollection()
 {
-    int numGeoms = dis.readInt();
+    int numGeoms = readCount(WKB_MIN_GEOMETRY_SIZE);
     vector<Geometry*>* geoms = new vector<Geometry*>(numGeoms);
 
     try {
@@ -444,18 +474,48 @@ WKBReader::readGeometryCollection()
 CoordinateSequence*
 WKBReader::readCoordinateSequence(int size)
 {
-    CoordinateSequence* seq = factory.getCoordinateSequenceFactory()->create(size, inputDimension);
-    auto targetDim = seq->getDimension();
-    if(targetDim > inputDimension) {
-        targetDim = inputDimension;
+    if(size < 0) {
+        throw ParseException("Negative number of points in WKB");
     }
-    for(int i = 0; i < size; i++) {
-        readCoordinate();
-        for(unsigned int j = 0; j < targetDim; j++) {
-            seq->setOrdinate(i, j, ordValues[j]);
+    std::size_t npts = static_cast<std::size_t>(size);
+
+    // A buffer is decoded at once, checking its length up front so that
+    // a corrupt count cannot trigger a huge allocation. A stream does not
+    // tell its length, and is decoded by chunks as it is read.
+    std::size_t chunkSize = npts;
+    if(dis.hasSize()) {
+        if(dis.size() / (8 * inputDimension) < npts) {
+            throw ParseException("Unexpected EOF parsing WKB");
+        }
+    }
+    else {
+        chunkSize = std::min(npts, WKB_STREAM_CHUNK_POINTS);
+    }
+
+    const PrecisionModel& pm = *factory.getPrecisionModel();
+    const bool isFloating = (pm.getType() == PrecisionModel::FLOATING);
+
+    std::unique_ptr<vector<Coordinate>> coords(new vector<Coordinate>());
+    coords->reserve(chunkSize);
+    ordValues.resize(chunkSize * inputDimension);
+    for(std::size_t start = 0; start < npts; start += chunkSize) {
+        std::size_t n = std::min(chunkSize, npts - start);
+        dis.readDoubles(ordValues.data(), n * inputDimension);
+
+        const double* ord = ordValues.data();
+        for(std::size_t i = 0; i < n; i++, ord += inputDimension) {
+            Coordinate c(ord[0], ord[1]);
+            if(inputDimension == 3) {
+                c.z = ord[2];
+            }
+            if(!isFloating) {
+                c.x = pm.makePrecise(c.x);
+                c.y = pm.makePrecise(c.y);
+            }
+            coords->push_back(c);
         }
     }
-    return seq;
+    return factory.getCoordinateSequenceFactory()->create(coords.release(), inputDimension);
 }
 
 void
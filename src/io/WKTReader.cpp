@@ -20,7 +20,6 @@
 #include <geos/io/WKTReader.h>
 #include <geos/io/StringTokenizer.h>
 #include <geos/io/ParseException.h>
-#include <geos/io/CLocalizer.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/Point.h>
@@ -61,7 +60,6 @@ Geometry*
 WKTReader::read(const string& wellKnownText)
 {
     //unique_ptr<StringTokenizer> tokenizer(new StringTokenizer(wellKnownText));
-    CLocalizer clocale;
     StringTokenizer tokenizer(wellKnownText);
     Geometry* g = nullptr;
     g = readGeometryTaggedText(&tokenizer);
@@ -20,7 +20,7 @@
 
 #include <geos/io/WKTWriter.h>
 #include <geos/io/Writer.h>
-#include <geos/io/CLocalizer.h>
+#include <geos/io/NumberConversion.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/Point.h>
 #include <geos/geom/LinearRing.h>
@@ -40,7 +40,6 @@
 #include <sstream>
 #include <cassert>
 #include <cmath>
-#include <iomanip>
 
 using namespace std;
 using namespace geos::geom;
@@ -178,9 +177,9 @@ void
 WKTWriter::writeFormatted(const Geometry* geometry, bool p_isFormatted,
                           Writer* writer)
 {
-    CLocalizer clocale;
     this->isFormatted = p_isFormatted;
-    decimalPlaces = roundingPrecision == -1 ? geometry->getPrecisionModel()->getMaximumSignificantDigits() :
+    const PrecisionModel* pm = geometry->getPrecisionModel();
+    decimalPlaces = roundingPrecision == -1 ? pm->getMaximumSignificantDigits() :
                     roundingPrecision;
     appendGeometryTaggedText(geometry, 0, writer);
 }
@@ -341,16 +340,16 @@ void
 WKTWriter::appendCoordinate(const Coordinate* coordinate,
                             Writer* writer)
 {
-    writer->write(writeNumber(coordinate->x));
-    writer->write(" ");
-    writer->write(writeNumber(coordinate->y));
+    writeNumber(coordinate->x, writer);
+    writer->write(" ", 1);
+    writeNumber(coordinate->y, writer);
     if(outputDimension == 3) {
-        writer->write(" ");
+        writer->write(" ", 1);
         if(std::isnan(coordinate->z)) {
-            writer->write(writeNumber(0.0));
+            writeNumber(0.0, writer);
         }
         else {
-            writer->write(writeNumber(coordinate->z));
+            writeNumber(coordinate->z, writer);
         }
     }
 }
@@ -359,15 +358,26 @@ WKTWriter::appendCoordinate(const Coordinate* coordinate,
 string
 WKTWriter::writeNumber(double d)
 {
+    Writer w;
+    writeNumber(d, &w);
+    return w.toString();
+}
 
-    std::stringstream ss;
+/* protected */
+void
+WKTWriter::writeNumber(double d, Writer* writer)
+{
+    char buf[NumberConversion::BUFFER_SIZE];
+    std::size_t len;
+    int precision = decimalPlaces >= 0 ? decimalPlaces : 0;
 
-    if(! trim) {
-        ss << std::fixed;
+    if(trim) {
+        len = NumberConversion::writeGeneral(d, precision, buf, sizeof(buf));
     }
-    ss << std::setprecision(decimalPlaces >= 0 ? decimalPlaces : 0) << d;
-
-    return ss.str();
+    else {
+        len = NumberConversion::writeFixed(d, precision, buf, sizeof(buf));
+    }
+    writer->write(buf, std::min(len, sizeof(buf) - 1));
 }
 
 void
@@ -45,6 +45,12 @@ Writer::write(const std::string& txt)
     str.append(txt);
 }
 
+void
+Writer::write(const char* txt, std::size_t len)
+{
+    str.append(txt, len);
+}
+
 const std::string&
 Writer::toString()
 {
@@ -39,17 +39,17 @@ namespace noding { // geos::noding
  */
 FastSegmentSetIntersectionFinder::
 FastSegmentSetIntersectionFinder(noding::SegmentString::ConstVect* baseSegStrings)
-    :	segSetMutInt(new MCIndexSegmentSetMutualIntersector()),
-      lineIntersector(new algorithm::LineIntersector())
+    :	segSetMutInt(new MCIndexSegmentSetMutualIntersector())
 {
     segSetMutInt->setBaseSegments(baseSegStrings);
 }
 
 bool
 FastSegmentSetIntersectionFinder::
-intersects(noding::SegmentString::ConstVect* segStrings)
+intersects(noding::SegmentString::ConstVect* segStrings) const
 {
-    SegmentIntersectionDetector intFinder(lineIntersector.get());
+    algorithm::LineIntersector li;
+    SegmentIntersectionDetector intFinder(&li);
 
     return this->intersects(segStrings, &intFinder);
 }
@@ -57,10 +57,9 @@ intersects(noding::SegmentString::ConstVect* segStrings)
 bool
 FastSegmentSetIntersectionFinder::
 intersects(noding::SegmentString::ConstVect* segStrings,
-           SegmentIntersectionDetector* intDetector)
+           SegmentIntersectionDetector* intDetector) const
 {
-    segSetMutInt->setSegmentIntersector(intDetector);
-    segSetMutInt->process(segStrings);
+    segSetMutInt->process(segStrings, intDetector);
 
     return intDetector->hasIntersection();
 }
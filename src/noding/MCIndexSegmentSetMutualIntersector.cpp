@@ -52,40 +52,45 @@ MCIndexSegmentSetMutualIntersector::addToIndex(SegmentString* segStr)
 
 
 /*private*/
-void
-MCIndexSegmentSetMutualIntersector::intersectChains()
+int
+MCIndexSegmentSetMutualIntersector::intersectChains(
+    const MonoChains& queryChains, SegmentIntersector& si) const
 {
-    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(*segInt);
+    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(si);
 
-    for(const auto& queryChain : monoChains) {
-        std::vector<void*> overlapChains;
+    int overlaps = 0;
+    std::vector<void*> overlapChains;
+    for(const auto& queryChain : queryChains) {
+        overlapChains.clear();
         index->query(&(queryChain->getEnvelope()), overlapChains);
 
         for(std::size_t j = 0, nj = overlapChains.size(); j < nj; j++) {
             MonotoneChain* testChain = (MonotoneChain*)(overlapChains[j]);
 
             queryChain->computeOverlaps(testChain, &overlapAction);
-            nOverlaps++;
-            if(segInt->isDone()) {
-                return;
+            overlaps++;
+            if(si.isDone()) {
+                return overlaps;
             }
         }
     }
+    return overlaps;
 }
 
-/*private*/
+/*private static*/
 void
-MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr)
+MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr,
+        MonoChains& chains, int& counter)
 {
     MonoChains segChains;
     MonotoneChainBuilder::getChains(segStr->getCoordinates(),
                                     segStr, segChains);
 
     MonoChains::size_type n = segChains.size();
-    monoChains.reserve(monoChains.size() + n);
+    chains.reserve(chains.size() + n);
     for(auto& mc : segChains) {
-        mc->setId(processCounter++);
-        monoChains.push_back(std::move(mc));
+        mc->setId(counter++);
+        chains.push_back(std::move(mc));
     }
 }
 
@@ -118,6 +123,9 @@ MCIndexSegmentSetMutualIntersector::setBaseSegments(SegmentString::ConstVect* se
         SegmentString* ss = const_cast<SegmentString*>(css);
         addToIndex(ss);
     }
+
+    // Queries only read a built tree, see process(segStrings, segInt)
+    index->build();
 }
 
 /*public*/
@@ -131,9 +139,24 @@ MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings
 
     for(SegmentString::ConstVect::size_type i = 0, n = segStrings->size(); i < n; i++) {
         SegmentString* seg = (SegmentString*)((*segStrings)[i]);
-        addToMonoChains(seg);
+        addToMonoChains(seg, monoChains, processCounter);
+    }
+    nOverlaps = intersectChains(monoChains, *segInt);
+}
+
+/*public*/
+void
+MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings,
+        SegmentIntersector* p_segInt) const
+{
+    int counter = indexCounter + 1;
+    MonoChains queryChains;
+
+    for(SegmentString::ConstVect::size_type i = 0, n = segStrings->size(); i < n; i++) {
+        SegmentString* seg = (SegmentString*)((*segStrings)[i]);
+        addToMonoChains(seg, queryChains, counter);
     }
-    intersectChains();
+    intersectChains(queryChains, *p_segInt);
 }
 
 
@@ -41,16 +41,15 @@ namespace noding { // geos.noding
 SegmentNode::SegmentNode(const NodedSegmentString& ss, const Coordinate& nCoord,
                          size_t nSegmentIndex, int nSegmentOctant)
     :
-    segString(ss),
     segmentOctant(nSegmentOctant),
     coord(nCoord),
     segmentIndex(nSegmentIndex)
 {
     // Number of points in NodedSegmentString is one-more number of segments
-    assert(segmentIndex < segString.size());
+    assert(segmentIndex < ss.size());
 
     isInteriorVar = \
-                    !coord.equals2D(segString.getCoordinate(segmentIndex));
+                    !coord.equals2D(ss.getCoordinate(segmentIndex));
 
 }
 
@@ -73,7 +72,7 @@ SegmentNode::isEndPoint(unsigned int maxSegmentIndex) const
  * @return 1 this EdgeIntersection is located after the argument location
  */
 int
-SegmentNode::compareTo(const SegmentNode& other)
+SegmentNode::compareTo(const SegmentNode& other) const
 {
     if(segmentIndex < other.segmentIndex) {
         return -1;
@@ -17,11 +17,12 @@
  *
  **********************************************************************/
 
+#include <algorithm>
 #include <cassert>
-#include <set>
 
 #include <geos/profiler.h>
 #include <geos/util/GEOSException.h>
+#include <geos/util/IllegalStateException.h>
 #include <geos/noding/SegmentNodeList.h>
 #include <geos/noding/NodedSegmentString.h>
 #include <geos/noding/SegmentString.h> // for use
@@ -50,29 +51,42 @@ static Profiler* profiler = Profiler::instance();
 
 SegmentNodeList::~SegmentNodeList()
 {
-    std::set<SegmentNode*, SegmentNodeLT>::iterator it = nodeMap.begin();
-    for(; it != nodeMap.end(); it++) {
-        delete *it;
-    }
 }
 
-SegmentNode*
+void
 SegmentNodeList::add(const Coordinate& intPt, size_t segmentIndex)
 {
-    SegmentNode* eiNew = new SegmentNode(edge, intPt, segmentIndex,
-                                         edge.getSegmentOctant(segmentIndex));
+    nodeMap.emplace_back(edge, intPt, segmentIndex,
+                         edge.getSegmentOctant(segmentIndex));
+    sorted = false;
+}
 
-    std::pair<SegmentNodeList::iterator, bool> p = nodeMap.insert(eiNew);
-    if(p.second) {    // new SegmentNode inserted
-        return eiNew;
+/* public */
+void
+SegmentNodeList::prepare()
+{
+    if(sorted) {
+        return;
     }
-    else {
-
-        // sanity check
-        assert(eiNew->coord.equals2D(intPt));
+    sorted = true;
+
+    // a stable sort keeps the node added first among equal ones
+    std::stable_sort(nodeMap.begin(), nodeMap.end(),
+    [](const SegmentNode& s1, const SegmentNode& s2) {
+        return s1.compareTo(s2) < 0;
+    });
+    nodeMap.erase(std::unique(nodeMap.begin(), nodeMap.end(),
+    [](const SegmentNode& s1, const SegmentNode& s2) {
+        return s1.compareTo(s2) == 0;
+    }), nodeMap.end());
+}
 
-        delete eiNew;
-        return *(p.first);
+/*private*/
+void
+SegmentNodeList::checkPrepared() const
+{
+    if(!sorted) {
+        throw util::IllegalStateException("SegmentNodeList read before prepare()");
     }
 }
 
@@ -133,23 +147,23 @@ SegmentNodeList::findCollapsesFromInsertedNodes(
     // there should always be at least two entries in the list,
     // since the endpoints are nodes
     iterator it = begin();
-    SegmentNode* eiPrev = *it;
+    const SegmentNode* eiPrev = &*it;
     ++it;
     for(iterator itEnd = end(); it != itEnd; ++it) {
-        SegmentNode* ei = *it;
-        bool isCollapsed = findCollapseIndex(*eiPrev, *ei,
+        const SegmentNode& ei = *it;
+        bool isCollapsed = findCollapseIndex(*eiPrev, ei,
                                              collapsedVertexIndex);
         if(isCollapsed) {
             collapsedVertexIndexes.push_back(collapsedVertexIndex);
         }
 
-        eiPrev = ei;
+        eiPrev = &ei;
     }
 }
 
 /* private */
 bool
-SegmentNodeList::findCollapseIndex(SegmentNode& ei0, SegmentNode& ei1,
+SegmentNodeList::findCollapseIndex(const SegmentNode& ei0, const SegmentNode& ei1,
                                    size_t& collapsedVertexIndex)
 {
     assert(ei1.segmentIndex >= ei0.segmentIndex);
@@ -192,23 +206,21 @@ SegmentNodeList::addSplitEdges(std::vector<SegmentString*>& edgeList)
     // there should always be at least two entries in the list
     // since the endpoints are nodes
     iterator it = begin();
-    SegmentNode* eiPrev = *it;
-    assert(eiPrev);
+    const SegmentNode* eiPrev = &*it;
     it++;
     for(iterator itEnd = end(); it != itEnd; ++it) {
-        SegmentNode* ei = *it;
-        assert(ei);
+        const SegmentNode& ei = *it;
 
-        if(! ei->compareTo(*eiPrev)) {
+        if(! ei.compareTo(*eiPrev)) {
             continue;
         }
 
-        SegmentString* newEdge = createSplitEdge(eiPrev, ei);
+        SegmentString* newEdge = createSplitEdge(*eiPrev, ei);
         edgeList.push_back(newEdge);
 #if GEOS_DEBUG
         testingSplitEdges.push_back(newEdge);
 #endif
-        eiPrev = ei;
+        eiPrev = &ei;
     }
 #if GEOS_DEBUG
     std::cerr << __FUNCTION__ << " finished, now checking correctness" << std::endl;
@@ -247,14 +259,11 @@ SegmentNodeList::checkSplitEdgesCorrectness(std::vector<SegmentString*>& splitEd
 
 /*private*/
 SegmentString*
-SegmentNodeList::createSplitEdge(SegmentNode* ei0, SegmentNode* ei1)
+SegmentNodeList::createSplitEdge(const SegmentNode& ei0, const SegmentNode& ei1)
 {
-    assert(ei0);
-    assert(ei1);
-
-    size_t npts = ei1->segmentIndex - ei0->segmentIndex + 2;
+    size_t npts = ei1.segmentIndex - ei0.segmentIndex + 2;
 
-    const Coordinate& lastSegStartPt = edge.getCoordinate(ei1->segmentIndex);
+    const Coordinate& lastSegStartPt = edge.getCoordinate(ei1.segmentIndex);
 
     // if the last intersection point is not equal to the its
     // segment start pt, add it to the points list as well.
@@ -267,7 +276,7 @@ SegmentNodeList::createSplitEdge(SegmentNode* ei0, SegmentNode* ei1)
     // would mean creating a SegmentString with a single point
     // FIXME: check with mbdavis about this, ie: is it a bug in the caller ?
     //
-    bool useIntPt1 = npts == 2 || (ei1->isInterior() || ! ei1->coord.equals2D(lastSegStartPt));
+    bool useIntPt1 = npts == 2 || (ei1.isInterior() || ! ei1.coord.equals2D(lastSegStartPt));
 
     if(! useIntPt1) {
         npts--;
@@ -275,12 +284,12 @@ SegmentNodeList::createSplitEdge(SegmentNode* ei0, SegmentNode* ei1)
 
     CoordinateSequence* pts = new CoordinateArraySequence(npts);
     size_t ipt = 0;
-    pts->setAt(ei0->coord, ipt++);
-    for(size_t i = ei0->segmentIndex + 1; i <= ei1->segmentIndex; i++) {
+    pts->setAt(ei0.coord, ipt++);
+    for(size_t i = ei0.segmentIndex + 1; i <= ei1.segmentIndex; i++) {
         pts->setAt(edge.getCoordinate(i), ipt++);
     }
     if(useIntPt1) {
-        pts->setAt(ei1->coord, ipt++);
+        pts->setAt(ei1.coord, ipt++);
     }
 
     // SegmentString takes ownership of CoordinateList 'pts'
@@ -296,15 +305,11 @@ SegmentNodeList::createSplitEdge(SegmentNode* ei0, SegmentNode* ei1)
 std::ostream&
 operator<< (std::ostream& os, const SegmentNodeList& nlist)
 {
+    // printed as they are, whether prepared or not
     os << "Intersections: (" << nlist.nodeMap.size() << "):" << std::endl;
 
-    std::set<SegmentNode*, SegmentNodeLT>::const_iterator
-    it = nlist.nodeMap.begin(),
-    itEnd = nlist.nodeMap.end();
-
-    for(; it != itEnd; it++) {
-        SegmentNode* ei = *it;
-        os << " " << *ei;
+    for(const SegmentNode& ei : nlist.nodeMap) {
+        os << " " << ei;
     }
     return os;
 }
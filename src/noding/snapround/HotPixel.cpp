@@ -79,7 +79,6 @@ HotPixel::initCorners(const Coordinate& p_pt)
     miny = p_pt.y - tolerance;
     maxy = p_pt.y + tolerance;
 
-    corner.resize(4);
     corner[0] = Coordinate(maxx, maxy);
     corner[1] = Coordinate(minx, maxy);
     corner[2] = Coordinate(minx, miny);
@@ -0,0 +1,389 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/noding/snapround/SnapRoundingNoder.h>
+#include <geos/noding/snapround/HotPixel.h>
+#include <geos/noding/NodedSegmentString.h>
+#include <geos/noding/SegmentString.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/index/chain/MonotoneChain.h>
+#include <geos/index/chain/MonotoneChainBuilder.h>
+#include <geos/index/chain/MonotoneChainOverlapAction.h>
+#include <geos/index/chain/MonotoneChainSelectAction.h>
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/util/ParallelChunks.h>
+#include <geos/util/math.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace geos::geom;
+using geos::index::chain::MonotoneChain;
+
+namespace geos {
+namespace noding { // geos.noding
+namespace snapround { // geos.noding.snapround
+
+namespace {
+
+/// Number of chains or segment strings handed to a thread at a time
+const std::size_t CHUNK_SIZE = 256;
+
+/// Origin of a hot pixel shared by several points, or of an intersection
+const std::size_t NO_ORIGIN = std::numeric_limits<std::size_t>::max();
+
+/// The monotone chains of the segment strings, and their index
+struct ChainSet {
+    std::vector<std::unique_ptr<MonotoneChain>> chains;
+    /// The chains of string i are [stringChains[i], stringChains[i + 1])
+    std::vector<std::size_t> stringChains;
+    /// Items point into chains
+    index::strtree::PackedSTRtree tree;
+};
+
+/// The hot pixels and their index
+struct HotPixelSet {
+    /// The coordinate each pixel snaps to
+    std::vector<Coordinate> pts;
+    std::vector<Envelope> safeEnvs;
+    /// The only vertex (string, index) a pixel was created for, if any
+    std::vector<std::pair<std::size_t, std::size_t>> origins;
+    /// Set once a segment has been snapped to the pixel
+    std::unique_ptr<std::atomic<bool>[]> snapped;
+    /// Items point into pts
+    index::strtree::PackedSTRtree tree;
+};
+
+struct CellHash {
+    std::size_t
+    operator()(const Coordinate& p) const
+    {
+        std::size_t h = std::hash<double>()(p.x);
+        return h ^ (std::hash<double>()(p.y) + 0x9e3779b9 + (h << 6) + (h >> 2));
+    }
+};
+
+struct CellEqual {
+    bool
+    operator()(const Coordinate& p, const Coordinate& q) const
+    {
+        return p.equals2D(q);
+    }
+};
+
+/// Maps the grid cell of a point to the hot pixel created for it
+typedef std::unordered_map<Coordinate, std::size_t, CellHash, CellEqual> CellMap;
+
+/*
+ * Collects the interior intersections of the segments of two chains,
+ * as IntersectionFinderAdder does.
+ */
+class IntersectionCollector: public index::chain::MonotoneChainOverlapAction {
+public:
+
+    IntersectionCollector(const PrecisionModel& pm)
+        :
+        intersections(nullptr)
+    {
+        li.setPrecisionModel(&pm);
+    }
+
+    IntersectionCollector(const IntersectionCollector& other)
+        :
+        index::chain::MonotoneChainOverlapAction(),
+        li(other.li),
+        intersections(nullptr)
+    {}
+
+    void
+    setIntersections(std::vector<Coordinate>* p_intersections)
+    {
+        intersections = p_intersections;
+    }
+
+    void
+    overlap(MonotoneChain& mc0, std::size_t segIndex0,
+            MonotoneChain& mc1, std::size_t segIndex1) override
+    {
+        SegmentString* e0 = static_cast<SegmentString*>(mc0.getContext());
+        SegmentString* e1 = static_cast<SegmentString*>(mc1.getContext());
+
+        // don't bother intersecting a segment with itself
+        if(e0 == e1 && segIndex0 == segIndex1) {
+            return;
+        }
+
+        li.computeIntersection(e0->getCoordinate(segIndex0), e0->getCoordinate(segIndex0 + 1),
+                               e1->getCoordinate(segIndex1), e1->getCoordinate(segIndex1 + 1));
+        if(li.hasIntersection() && li.isInteriorIntersection()) {
+            for(std::size_t i = 0, n = li.getIntersectionNum(); i < n; i++) {
+                intersections->push_back(li.getIntersection(i));
+            }
+        }
+    }
+
+private:
+
+    algorithm::LineIntersector li;
+
+    std::vector<Coordinate>* intersections;
+};
+
+/*
+ * Records the segments of a chain which pass through a hot pixel,
+ * as HotPixel::addSnappedNode does.
+ */
+class HotPixelSnapper: public index::chain::MonotoneChainSelectAction {
+public:
+
+    HotPixelSnapper(const PrecisionModel& pm, double p_scaleFactor,
+                    HotPixelSet& p_pixels)
+        :
+        scaleFactor(p_scaleFactor),
+        pixels(p_pixels),
+        pixelIndex(0),
+        stringIndex(0)
+    {
+        li.setPrecisionModel(&pm);
+    }
+
+    HotPixelSnapper(const HotPixelSnapper& other)
+        :
+        index::chain::MonotoneChainSelectAction(),
+        li(other.li),
+        scaleFactor(other.scaleFactor),
+        pixels(other.pixels),
+        pixelIndex(0),
+        stringIndex(0)
+    {}
+
+    /// Nodes found, as (pixel, segment index)
+    std::vector<std::pair<std::size_t, std::size_t>> nodes;
+
+    void
+    snap(MonotoneChain& mc, std::size_t p_stringIndex, std::size_t p_pixelIndex)
+    {
+        stringIndex = p_stringIndex;
+        pixelIndex = p_pixelIndex;
+        HotPixel hotPixel(pixels.pts[pixelIndex], scaleFactor, li);
+        currentPixel = &hotPixel;
+        mc.select(pixels.safeEnvs[pixelIndex], *this);
+        currentPixel = nullptr;
+    }
+
+    void
+    select(MonotoneChain& mc, std::size_t segIndex) override
+    {
+        // don't snap a vertex to itself
+        if(pixels.origins[pixelIndex].first == stringIndex
+                && pixels.origins[pixelIndex].second == segIndex) {
+            return;
+        }
+
+        const SegmentString* ss = static_cast<const SegmentString*>(mc.getContext());
+        if(currentPixel->intersects(ss->getCoordinate(segIndex),
+                                    ss->getCoordinate(segIndex + 1))) {
+            nodes.emplace_back(pixelIndex, segIndex);
+            pixels.snapped[pixelIndex].store(true, std::memory_order_relaxed);
+        }
+    }
+
+    void
+    select(const LineSegment& /*seg*/) override
+    {}
+
+private:
+
+    algorithm::LineIntersector li;
+
+    double scaleFactor;
+
+    HotPixelSet& pixels;
+
+    std::size_t pixelIndex;
+
+    std::size_t stringIndex;
+
+    const HotPixel* currentPixel = nullptr;
+};
+
+} // anonymous namespace
+
+/*public*/
+SnapRoundingNoder::SnapRoundingNoder(const PrecisionModel& p_pm)
+    :
+    pm(p_pm),
+    scaleFactor(p_pm.getScale()),
+    numThreads(1),
+    nodedSegStrings(nullptr)
+{}
+
+SnapRoundingNoder::~SnapRoundingNoder() {}
+
+/*public*/
+void
+SnapRoundingNoder::setNumThreads(std::size_t n)
+{
+    numThreads = util::normalizeThreadCount(n);
+}
+
+/*public*/
+std::vector<SegmentString*>*
+SnapRoundingNoder::getNodedSubstrings() const
+{
+    return NodedSegmentString::getNodedSubstrings(*nodedSegStrings);
+}
+
+/*public*/
+void
+SnapRoundingNoder::computeNodes(std::vector<SegmentString*>* inputSegStrings)
+{
+    nodedSegStrings = inputSegStrings;
+    std::vector<SegmentString*>& segStrings = *inputSegStrings;
+    std::size_t nStrings = segStrings.size();
+    std::size_t nStringChunks = (nStrings + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+    // The envelopes of the chains are computed once, here, as the
+    // threads only read the chains
+    ChainSet chainSet;
+    chainSet.stringChains.reserve(nStrings + 1);
+    for(SegmentString* ss : segStrings) {
+        assert(dynamic_cast<NodedSegmentString*>(ss));
+        chainSet.stringChains.push_back(chainSet.chains.size());
+        index::chain::MonotoneChainBuilder::getChains(ss->getCoordinates(), ss, chainSet.chains);
+    }
+    chainSet.stringChains.push_back(chainSet.chains.size());
+    for(auto& mc : chainSet.chains) {
+        chainSet.tree.insert(&mc->getEnvelope(), &mc);
+    }
+    chainSet.tree.build();
+
+    // Interior intersections, in the order a single thread finds them
+    std::size_t nChains = chainSet.chains.size();
+    std::size_t nChainChunks = (nChains + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    std::vector<std::vector<Coordinate>> chunkIntersections(nChainChunks);
+    util::runChunks(nChainChunks, numThreads, IntersectionCollector(pm),
+    [&](std::size_t chunk, IntersectionCollector & collector) {
+        collector.setIntersections(&chunkIntersections[chunk]);
+        std::size_t end = std::min(nChains, (chunk + 1) * CHUNK_SIZE);
+        for(std::size_t i = chunk * CHUNK_SIZE; i < end; i++) {
+            MonotoneChain* queryChain = chainSet.chains[i].get();
+            chainSet.tree.query(queryChain->getEnvelope(), [&](void* item) {
+                std::size_t j = static_cast<std::unique_ptr<MonotoneChain>*>(item)
+                                - chainSet.chains.data();
+                // compare each pair of chains once
+                if(j > i) {
+                    queryChain->computeOverlaps(chainSet.chains[j].get(), &collector);
+                }
+            });
+        }
+    });
+
+    // One hot pixel per grid cell holding a vertex or an intersection.
+    // As in MCIndexSnapRounder, the last vertex of a string makes none.
+    HotPixelSet pixels;
+    CellMap cells;
+    auto cellOf = [this](const Coordinate& p) {
+        if(scaleFactor == 1.0) {
+            return Coordinate(p.x, p.y);
+        }
+        return Coordinate(util::round(p.x * scaleFactor),
+                          util::round(p.y * scaleFactor));
+    };
+    auto addPixel = [&](const Coordinate& p, std::size_t stringIndex, std::size_t vertexIndex) {
+        auto inserted = cells.emplace(cellOf(p), pixels.pts.size());
+        if(inserted.second) {
+            pixels.pts.push_back(p);
+            pixels.origins.emplace_back(stringIndex, vertexIndex);
+        }
+        else {
+            pixels.origins[inserted.first->second] = std::make_pair(NO_ORIGIN, NO_ORIGIN);
+        }
+    };
+    for(std::size_t s = 0; s < nStrings; s++) {
+        const CoordinateSequence& pts = *segStrings[s]->getCoordinates();
+        for(std::size_t i = 0, n = pts.size(); i + 1 < n; i++) {
+            addPixel(pts[i], s, i);
+        }
+    }
+    for(const auto& intersections : chunkIntersections) {
+        for(const Coordinate& p : intersections) {
+            addPixel(p, NO_ORIGIN, NO_ORIGIN);
+        }
+    }
+    chunkIntersections.clear();
+
+    std::size_t nPixels = pixels.pts.size();
+    double safeTolerance = 0.75 / scaleFactor;
+    pixels.safeEnvs.reserve(nPixels);
+    pixels.snapped.reset(new std::atomic<bool>[nPixels]);
+    for(std::size_t p = 0; p < nPixels; p++) {
+        const Coordinate& pt = pixels.pts[p];
+        pixels.safeEnvs.emplace_back(pt.x - safeTolerance, pt.x + safeTolerance,
+                                     pt.y - safeTolerance, pt.y + safeTolerance);
+        pixels.snapped[p] = false;
+        pixels.tree.insert(&pixels.safeEnvs[p], &pixels.pts[p]);
+    }
+    pixels.tree.build();
+
+    // Snap the segments of each string to the pixels they pass through.
+    // A thread only adds nodes to the strings of its own chunks.
+    util::runChunks(nStringChunks, numThreads, HotPixelSnapper(pm, scaleFactor, pixels),
+    [&](std::size_t chunk, HotPixelSnapper & snapper) {
+        std::size_t end = std::min(nStrings, (chunk + 1) * CHUNK_SIZE);
+        for(std::size_t s = chunk * CHUNK_SIZE; s < end; s++) {
+            snapper.nodes.clear();
+            for(std::size_t c = chainSet.stringChains[s]; c < chainSet.stringChains[s + 1]; c++) {
+                MonotoneChain& mc = *chainSet.chains[c];
+                pixels.tree.query(mc.getEnvelope(), [&](void* item) {
+                    snapper.snap(mc, s, static_cast<Coordinate*>(item) - pixels.pts.data());
+                });
+            }
+            NodedSegmentString* ss = static_cast<NodedSegmentString*>(segStrings[s]);
+            for(const auto& node : snapper.nodes) {
+                ss->addIntersection(pixels.pts[node.first], node.second);
+            }
+        }
+    });
+
+    // A vertex whose pixel snapped other segments must be noded too
+    util::runChunks(nStringChunks, numThreads, 0,
+    [&](std::size_t chunk, int /*noWorker*/) {
+        std::size_t end = std::min(nStrings, (chunk + 1) * CHUNK_SIZE);
+        for(std::size_t s = chunk * CHUNK_SIZE; s < end; s++) {
+            NodedSegmentString* ss = static_cast<NodedSegmentString*>(segStrings[s]);
+            const CoordinateSequence& pts = *ss->getCoordinates();
+            for(std::size_t i = 0, n = pts.size(); i + 1 < n; i++) {
+                auto cell = cells.find(cellOf(pts[i]));
+                assert(cell != cells.end());
+                if(pixels.snapped[cell->second]) {
+                    ss->addIntersection(pts[i], i);
+                }
+            }
+        }
+    });
+}
+
+} // namespace geos.noding.snapround
+} // namespace geos.noding
+} // namespace geos
@@ -103,6 +103,15 @@ GeometryGraphOperation::getArgGeometry(unsigned int i) const
     return arg[i]->getGeometry();
 }
 
+/*public*/
+void
+GeometryGraphOperation::setNumThreads(std::size_t n)
+{
+    for(GeometryGraph* g : arg) {
+        g->setNumThreads(n);
+    }
+}
+
 /*protected*/
 void
 GeometryGraphOperation::setComputationPrecision(const PrecisionModel* pm)
@@ -209,7 +209,7 @@ IsSimpleOp::hasNonEndpointIntersection(GeometryGraph& graph)
         EdgeIntersectionList& eiL = e->getEdgeIntersectionList();
         for(EdgeIntersectionList::iterator eiIt = eiL.begin(),
                 eiEnd = eiL.end(); eiIt != eiEnd; ++eiIt) {
-            EdgeIntersection* ei = *eiIt;
+            EdgeIntersection* ei = &*eiIt;
             if(!ei->isEndPoint(maxSegmentIndex)) {
                 nonSimpleLocation.reset(
                     new Coordinate(ei->getCoordinate())
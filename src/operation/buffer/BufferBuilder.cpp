@@ -663,7 +663,8 @@ BufferBuilder::buildSubgraphs(const std::vector<BufferSubgraph*>& subgraphList,
 #if GEOS_DEBUG
     std::cerr << __FUNCTION__ << " got " << subgraphList.size() << " subgraphs" << std::endl;
 #endif
-    std::vector<BufferSubgraph*> processedGraphs;
+    // subgraphs are located among the ones processed before them
+    SubgraphDepthLocater locater(subgraphList);
     for(size_t i = 0, n = subgraphList.size(); i < n; i++) {
         BufferSubgraph* subgraph = subgraphList[i];
         Coordinate* p = subgraph->getRightmostCoordinate();
@@ -673,13 +674,7 @@ BufferBuilder::buildSubgraphs(const std::vector<BufferSubgraph*>& subgraphList,
         std::cerr << " " << i << ") Subgraph[" << subgraph << "]" << std::endl;
         std::cerr << "  rightmost Coordinate " << *p;
 #endif
-        SubgraphDepthLocater locater(&processedGraphs);
-#if GEOS_DEBUG
-        std::cerr << " after SubgraphDepthLocater processedGraphs contain "
-                  << processedGraphs.size()
-                  << " elements" << std::endl;
-#endif
-        int outsideDepth = locater.getDepth(*p);
+        int outsideDepth = locater.getDepth(*p, i);
 #if GEOS_DEBUG
         std::cerr << " Depth of rightmost coordinate: " << outsideDepth << std::endl;
 #endif
@@ -689,11 +684,6 @@ BufferBuilder::buildSubgraphs(const std::vector<BufferSubgraph*>& subgraphList,
         std::cerr << " after computeDepth and findResultEdges subgraph contain:" << std::endl
                   << "   " << subgraph->getDirectedEdges()->size() << " DirecteEdges " << std::endl
                   << "   " << subgraph->getNodes()->size() << " Nodes " << std::endl;
-#endif
-        processedGraphs.push_back(subgraph);
-#if GEOS_DEBUG
-        std::cerr << " added " << subgraph << " to processedGraphs, new size is "
-                  << processedGraphs.size() << std::endl;
 #endif
         polyBuilder.add(subgraph->getDirectedEdges(), subgraph->getNodes());
     }
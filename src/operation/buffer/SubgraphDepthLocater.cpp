@@ -33,6 +33,9 @@
 #include <geos/geomgraph/Edge.h>
 #include <geos/geomgraph/Position.h>
 
+#include <geos/index/ItemVisitor.h>
+#include <geos/index/intervalrtree/SortedPackedIntervalRTree.h>
+
 #ifndef GEOS_DEBUG
 #define GEOS_DEBUG 0
 #endif
@@ -151,13 +154,112 @@ struct DepthSegmentLessThen {
 
 
 
+namespace {
+
+class SegmentCollector: public index::ItemVisitor {
+public:
+    SegmentCollector(std::vector<void*>& p_items)
+        :
+        items(p_items)
+    {}
+
+    void
+    visitItem(void* item) override
+    {
+        items.push_back(item);
+    }
+
+private:
+    std::vector<void*>& items;
+};
+
+} // anonymous namespace
+
+/*public*/
+SubgraphDepthLocater::SubgraphDepthLocater(vector<BufferSubgraph*>* newSubgraphs)
+    :
+    subgraphs(newSubgraphs),
+    indexedSubgraphs(nullptr)
+{}
+
+/*public*/
+SubgraphDepthLocater::SubgraphDepthLocater(const vector<BufferSubgraph*>& allSubgraphs)
+    :
+    subgraphs(nullptr),
+    indexedSubgraphs(&allSubgraphs)
+{
+    // Horizontal segments never cross the stabbing line, and only
+    // forward DirectedEdges are checked, as in findStabbedSegments
+    for(size_t i = 0, n = allSubgraphs.size(); i < n; ++i) {
+        vector<DirectedEdge*>* dirEdges = allSubgraphs[i]->getDirectedEdges();
+        for(DirectedEdge* de : *dirEdges) {
+            if(!de->isForward()) {
+                continue;
+            }
+            const CoordinateSequence* pts = de->getEdge()->getCoordinates();
+            for(size_t j = 0, nj = pts->getSize() - 1; j < nj; ++j) {
+                if(pts->getAt(j).y != pts->getAt(j + 1).y) {
+                    segments.push_back({de, j, i});
+                }
+            }
+        }
+    }
+
+    segmentIndex.reset(new index::intervalrtree::SortedPackedIntervalRTree(segments.size()));
+    for(IndexedSegment& is : segments) {
+        const CoordinateSequence* pts = is.dirEdge->getEdge()->getCoordinates();
+        double y0 = pts->getAt(is.segIndex).y;
+        double y1 = pts->getAt(is.segIndex + 1).y;
+        segmentIndex->insert(std::min(y0, y1), std::max(y0, y1), &is);
+    }
+    segmentIndex->init();
+}
+
+SubgraphDepthLocater::~SubgraphDepthLocater() = default;
+
 /*public*/
 int
 SubgraphDepthLocater::getDepth(const Coordinate& p)
 {
     vector<DepthSegment*> stabbedSegments;
     findStabbedSegments(p, stabbedSegments);
+    return getDepth(stabbedSegments);
+}
+
+/*public*/
+int
+SubgraphDepthLocater::getDepth(const Coordinate& p, size_t numSubgraphs)
+{
+    assert(segmentIndex);
+
+    vector<void*> found;
+    SegmentCollector collector(found);
+    segmentIndex->query(p.y, p.y, &collector);
+
+    // the segments are stored in scan order, so that ties between
+    // stabbed segments are resolved as by getDepth(p)
+    sort(found.begin(), found.end());
+
+    vector<DepthSegment*> stabbedSegments;
+    for(void* item : found) {
+        const IndexedSegment* is = static_cast<const IndexedSegment*>(item);
+        if(is->subgraphIndex >= numSubgraphs) {
+            continue;
+        }
+        // don't bother checking subgraphs which the ray does not intersect
+        Envelope* env = (*indexedSubgraphs)[is->subgraphIndex]->getEnvelope();
+        if(!env->covers(p.x, p.y)) {
+            continue;
+        }
+        findStabbedSegment(p, is->dirEdge, is->segIndex, stabbedSegments);
+    }
+    return getDepth(stabbedSegments);
+}
 
+/*private*/
+int
+SubgraphDepthLocater::getDepth(vector<DepthSegment*>& stabbedSegments)
+{
     // if no segments on stabbing line subgraph must be outside all others
     if(stabbedSegments.empty()) {
         return 0;
@@ -169,7 +271,7 @@ SubgraphDepthLocater::getDepth(const Coordinate& p)
     int ret = ds->leftDepth;
 
 #if GEOS_DEBUG
-    cerr << "SubgraphDepthLocater::getDepth(" << p.toString() << "): " << ret << endl;
+    cerr << "SubgraphDepthLocater::getDepth(): " << ret << endl;
 #endif
 
     for(vector<DepthSegment*>::iterator
@@ -235,131 +337,75 @@ SubgraphDepthLocater::findStabbedSegments(
     vector<DepthSegment*>& stabbedSegments)
 {
     const CoordinateSequence* pts = dirEdge->getEdge()->getCoordinates();
-
-// It seems that LineSegment is *very* slow... undef this
-// to see yourself
-// LineSegment has been refactored to be mostly inline, still
-// it makes copies of the given coordinates, while the 'non-LineSemgent'
-// based code below uses pointers instead. I'll kip the SKIP_LS
-// defined until LineSegment switches to Coordinate pointers instead.
-//
-#define SKIP_LS 1
-
     auto n = pts->getSize() - 1;
     for(size_t i = 0; i < n; ++i) {
-#ifndef SKIP_LS
-        seg.p0 = pts->getAt(i);
-        seg.p1 = pts->getAt(i + 1);
-#if GEOS_DEBUG
-        cerr << " SubgraphDepthLocater::findStabbedSegments: segment " << i
-             << " (" << seg << ") ";
-#endif
-
-#else
-        const Coordinate* low = &(pts->getAt(i));
-        const Coordinate* high = &(pts->getAt(i + 1));
-        const Coordinate* swap = nullptr;
+        findStabbedSegment(stabbingRayLeftPt, dirEdge, i, stabbedSegments);
+    }
+}
 
-#endif
+/*private*/
+void
+SubgraphDepthLocater::findStabbedSegment(
+    const Coordinate& stabbingRayLeftPt,
+    DirectedEdge* dirEdge,
+    size_t i,
+    vector<DepthSegment*>& stabbedSegments)
+{
+    const CoordinateSequence* pts = dirEdge->getEdge()->getCoordinates();
 
-#ifndef SKIP_LS
-        // ensure segment always points upwards
-        //if (seg.p0.y > seg.p1.y)
-        {
-            seg.reverse();
-#if GEOS_DEBUG
-            cerr << " reverse (" << seg << ") ";
-#endif
-        }
-#else
-        if(low->y > high->y) {
-            swap = low;
-            low = high;
-            high = swap;
-        }
-#endif
+    // LineSegment makes copies of the coordinates, so pointers are
+    // used until the segment is known to be stabbed
+    const Coordinate* low = &(pts->getAt(i));
+    const Coordinate* high = &(pts->getAt(i + 1));
+    const Coordinate* swap = nullptr;
+
+    // ensure segment always points upwards
+    if(low->y > high->y) {
+        swap = low;
+        low = high;
+        high = swap;
+    }
 
-        // skip segment if it is left of the stabbing line
-        // skip if segment is above or below stabbing line
-#ifndef SKIP_LS
-        double maxx = max(seg.p0.x, seg.p1.x);
-#else
-        double maxx = max(low->x, high->x);
-#endif
-        if(maxx < stabbingRayLeftPt.x) {
-#if GEOS_DEBUG
-            cerr << " segment is left to stabbing line, skipping " << endl;
-#endif
-            continue;
-        }
+    // skip segment if it is left of the stabbing line
+    double maxx = max(low->x, high->x);
+    if(maxx < stabbingRayLeftPt.x) {
+        return;
+    }
 
-        // skip horizontal segments (there will be a non-horizontal
-        // one carrying the same depth info
-#ifndef SKIP_LS
-        if(seg.isHorizontal())
-#else
-        if(low->y == high->y)
-#endif
-        {
-#if GEOS_DEBUG
-            cerr << " segment is horizontal, skipping " << endl;
-#endif
-            continue;
-        }
+    // skip horizontal segments (there will be a non-horizontal
+    // one carrying the same depth info
+    if(low->y == high->y) {
+        return;
+    }
 
-        // skip if segment is above or below stabbing line
-#ifndef SKIP_LS
-        if(stabbingRayLeftPt.y < seg.p0.y ||
-                stabbingRayLeftPt.y > seg.p1.y)
-#else
-        if(stabbingRayLeftPt.y < low->y ||
-                stabbingRayLeftPt.y > high->y)
-#endif
-        {
-#if GEOS_DEBUG
-            cerr << " segment above or below stabbing line, skipping " << endl;
-#endif
-            continue;
-        }
+    // skip if segment is above or below stabbing line
+    if(stabbingRayLeftPt.y < low->y ||
+            stabbingRayLeftPt.y > high->y) {
+        return;
+    }
 
-        // skip if stabbing ray is right of the segment
-#ifndef SKIP_LS
-        if(Orientation::index(seg.p0, seg.p1,
-#else
-        if(Orientation::index(*low, *high,
-#endif
-                              stabbingRayLeftPt) == Orientation::RIGHT) {
-#if GEOS_DEBUG
-            cerr << " stabbing ray right of segment, skipping" << endl;
-#endif
-            continue;
-        }
+    // skip if stabbing ray is right of the segment
+    if(Orientation::index(*low, *high,
+                          stabbingRayLeftPt) == Orientation::RIGHT) {
+        return;
+    }
 
-#ifndef SKIP_LS
-        // stabbing line cuts this segment, so record it
-        int depth = dirEdge->getDepth(Position::LEFT);
-        // if segment direction was flipped, use RHS depth instead
-        if(!(seg.p0 == pts->getAt(i)))
-            depth = dirEdge->getDepth(Position::RIGHT);
-#else
-        int depth = swap ?
-                    dirEdge->getDepth(Position::RIGHT)
-                    :
-                    dirEdge->getDepth(Position::LEFT);
-#endif
+    // stabbing line cuts this segment, so record it;
+    // if segment direction was flipped, use RHS depth instead
+    int depth = swap ?
+                dirEdge->getDepth(Position::RIGHT)
+                :
+                dirEdge->getDepth(Position::LEFT);
 
 #if GEOS_DEBUG
-        cerr << " depth: " << depth << endl;
+    cerr << " depth: " << depth << endl;
 #endif
 
-#ifdef SKIP_LS
-        seg.p0 = *low;
-        seg.p1 = *high;
-#endif
+    seg.p0 = *low;
+    seg.p1 = *high;
 
-        DepthSegment* ds = new DepthSegment(seg, depth);
-        stabbedSegments.push_back(ds);
-    }
+    DepthSegment* ds = new DepthSegment(seg, depth);
+    stabbedSegments.push_back(ds);
 }
 
 } // namespace geos.operation.buffer
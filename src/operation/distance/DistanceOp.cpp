@@ -22,6 +22,7 @@
 #include <geos/operation/distance/DistanceOp.h>
 #include <geos/operation/distance/GeometryLocation.h>
 #include <geos/operation/distance/ConnectedElementLocationFilter.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
 #include <geos/algorithm/PointLocator.h>
 #include <geos/algorithm/Distance.h>
 #include <geos/geom/Coordinate.h>
@@ -374,6 +375,11 @@ DistanceOp::computeFacetDistance()
     using geom::util::LinearComponentExtracter;
     using geom::util::PointExtracter;
 
+    if(geom[0]->getNumPoints() * geom[1]->getNumPoints() > INDEXED_FACET_THRESHOLD) {
+        computeFacetDistanceIndexed();
+        return;
+    }
+
     vector<GeometryLocation*> locGeom(2);
 
     /**
@@ -447,6 +453,28 @@ DistanceOp::computeFacetDistance()
 #endif
 }
 
+/*private*/
+void
+DistanceOp::computeFacetDistanceIndexed()
+{
+    IndexedFacetDistance ifd(geom[0]);
+    double dist;
+    std::vector<GeometryLocation> locs = ifd.nearestLocations(geom[1], dist);
+
+    // one of the geometries has no facets
+    if(locs.empty()) {
+        return;
+    }
+
+    if(dist < minDistance) {
+        minDistance = dist;
+        vector<GeometryLocation*> locGeom {
+            new GeometryLocation(locs[0]), new GeometryLocation(locs[1])
+        };
+        updateMinDistance(locGeom, false);
+    }
+}
+
 /*private*/
 void
 DistanceOp::computeMinDistanceLines(
@@ -614,8 +642,38 @@ DistanceOp::isWithinDistance(const geom::Geometry& g0,
                              const geom::Geometry& g1,
                              double distance)
 {
+    if(g0.isEmpty() || g1.isEmpty()) {
+        return false;
+    }
+
+    // short-circuit test
+    if(g0.getEnvelopeInternal()->distance(g1.getEnvelopeInternal()) > distance) {
+        return false;
+    }
+
     DistanceOp distOp(g0, g1, distance);
-    return distOp.distance() <= distance;
+    return distOp.isWithinTerminateDistance();
+}
+
+/*private*/
+bool
+DistanceOp::isWithinTerminateDistance()
+{
+    if(geom[0]->getNumPoints() * geom[1]->getNumPoints() <= INDEXED_FACET_THRESHOLD) {
+        computeMinDistance();
+        return minDistance <= terminateDistance;
+    }
+
+    // Facets within the distance answer the test, whether or not
+    // they are the nearest ones
+    IndexedFacetDistance ifd(geom[0]);
+    if(ifd.isWithinDistance(geom[1], terminateDistance)) {
+        return true;
+    }
+
+    minDistanceLocation = new vector<GeometryLocation*>(2);
+    computeContainmentDistance();
+    return minDistance <= terminateDistance;
 }
 
 } // namespace geos.operation.distance
@@ -17,13 +17,28 @@
  **********************************************************************/
 
 #include <geos/algorithm/Distance.h>
+#include <geos/geom/LineSegment.h>
 #include <geos/operation/distance/FacetSequence.h>
 
+#include <limits>
+#include <memory>
+
 using namespace geos::geom;
 using namespace geos::operation::distance;
 using namespace geos::algorithm;
 
 FacetSequence::FacetSequence(const CoordinateSequence* p_pts, size_t p_start, size_t p_end) :
+    geom(nullptr),
+    pts(p_pts),
+    start(p_start),
+    end(p_end)
+{
+    computeEnvelope();
+}
+
+FacetSequence::FacetSequence(const Geometry* p_geom, const CoordinateSequence* p_pts,
+                             size_t p_start, size_t p_end) :
+    geom(p_geom),
     pts(p_pts),
     start(p_start),
     end(p_end)
@@ -45,30 +60,56 @@ FacetSequence::isPoint() const
 
 double
 FacetSequence::distance(const FacetSequence& facetSeq) const
+{
+    return computeDistance(facetSeq, nullptr);
+}
+
+std::vector<GeometryLocation>
+FacetSequence::nearestLocations(const FacetSequence& facetSeq) const
+{
+    std::vector<GeometryLocation> locs;
+    computeDistance(facetSeq, &locs);
+    return locs;
+}
+
+double
+FacetSequence::computeDistance(const FacetSequence& facetSeq, std::vector<GeometryLocation>* locs) const
 {
     bool isPointThis = isPoint();
     bool isPointOther = facetSeq.isPoint();
 
     if(isPointThis && isPointOther) {
-        Coordinate pt = pts->getAt(start);
-        Coordinate seqPt = facetSeq.pts->getAt(facetSeq.start);
+        const Coordinate& pt = pts->getAt(start);
+        const Coordinate& seqPt = facetSeq.pts->getAt(facetSeq.start);
+        if(locs) {
+            locs->clear();
+            locs->emplace_back(geom, start, pt);
+            locs->emplace_back(facetSeq.geom, facetSeq.start, seqPt);
+        }
         return pt.distance(seqPt);
 
     }
     else if(isPointThis) {
-        Coordinate pt = pts->getAt(start);
-        return computePointLineDistance(pt, facetSeq);
+        const Coordinate& pt = pts->getAt(start);
+        return computePointLineDistance(pt, facetSeq, locs);
     }
     else if(isPointOther) {
-        Coordinate seqPt = facetSeq.pts->getAt(facetSeq.start);
-        return computePointLineDistance(seqPt, *this);
+        const Coordinate& seqPt = facetSeq.pts->getAt(facetSeq.start);
+        double dist = computePointLineDistance(seqPt, *this, locs);
+        if(locs) {
+            // the point location comes first, but belongs to the other sequence
+            (*locs)[0] = (*locs)[1];
+            (*locs)[1] = GeometryLocation(facetSeq.geom, facetSeq.start, seqPt);
+        }
+        return dist;
     }
 
-    return computeLineLineDistance(facetSeq);
+    return computeLineLineDistance(facetSeq, locs);
 }
 
 double
-FacetSequence::computePointLineDistance(const Coordinate& pt, const FacetSequence& facetSeq) const
+FacetSequence::computePointLineDistance(const Coordinate& pt, const FacetSequence& facetSeq,
+                                        std::vector<GeometryLocation>* locs) const
 {
     double minDistance = std::numeric_limits<double>::infinity();
     double dist;
@@ -79,11 +120,19 @@ FacetSequence::computePointLineDistance(const Coordinate& pt, const FacetSequenc
         facetSeq.pts->getAt(i, q0);
         facetSeq.pts->getAt(i + 1, q1);
         dist = Distance::pointToSegment(pt, q0, q1);
-        if(dist == 0.0) {
-            return dist;
-        }
         if(dist < minDistance) {
             minDistance = dist;
+            if(locs) {
+                LineSegment seg(q0, q1);
+                Coordinate segClosestPoint;
+                seg.closestPoint(pt, segClosestPoint);
+                locs->clear();
+                locs->emplace_back(geom, start, pt);
+                locs->emplace_back(facetSeq.geom, i, segClosestPoint);
+            }
+        }
+        if(minDistance == 0.0) {
+            return minDistance;
         }
     }
 
@@ -91,7 +140,8 @@ FacetSequence::computePointLineDistance(const Coordinate& pt, const FacetSequenc
 }
 
 double
-FacetSequence::computeLineLineDistance(const FacetSequence& facetSeq) const
+FacetSequence::computeLineLineDistance(const FacetSequence& facetSeq,
+                                       std::vector<GeometryLocation>* locs) const
 {
     double minDistance = std::numeric_limits<double>::infinity();
     double dist;
@@ -106,11 +156,19 @@ FacetSequence::computeLineLineDistance(const FacetSequence& facetSeq) const
             facetSeq.pts->getAt(j + 1, q1);
 
             dist = Distance::segmentToSegment(p0, p1, q0, q1);
-            if(dist == 0.0) {
-                return dist;
-            }
             if(dist < minDistance) {
                 minDistance = dist;
+                if(locs) {
+                    LineSegment seg0(p0, p1);
+                    LineSegment seg1(q0, q1);
+                    std::unique_ptr<CoordinateSequence> closestPts(seg0.closestPoints(seg1));
+                    locs->clear();
+                    locs->emplace_back(geom, i, closestPts->getAt(0));
+                    locs->emplace_back(facetSeq.geom, j, closestPts->getAt(1));
+                }
+            }
+            if(minDistance == 0.0) {
+                return minDistance;
             }
         }
     }
@@ -19,6 +19,7 @@
 #include <geos/index/strtree/STRtree.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 #include <geos/index/ItemVisitor.h>
+#include <geos/geom/CoordinateArraySequence.h>
 
 using namespace geos::geom;
 using namespace geos::index::strtree;
@@ -34,6 +35,15 @@ struct Deleter : public index::ItemVisitor {
     }
 } deleter;
 
+struct FacetSequenceDistance : public ItemDistance {
+    double
+    distance(const ItemBoundable* item1, const ItemBoundable* item2) override
+    {
+        return static_cast<const FacetSequence*>(item1->getItem())->distance(*static_cast<const FacetSequence*>
+                (item2->getItem()));
+    }
+};
+
 double
 IndexedFacetDistance::distance(const Geometry* g1, const Geometry* g2)
 {
@@ -41,17 +51,17 @@ IndexedFacetDistance::distance(const Geometry* g1, const Geometry* g2)
     return ifd.getDistance(g2);
 }
 
+std::unique_ptr<CoordinateSequence>
+IndexedFacetDistance::nearestPoints(const Geometry* g1, const Geometry* g2)
+{
+    IndexedFacetDistance ifd(g1);
+    return ifd.nearestPoints(g2);
+}
+
 double
 IndexedFacetDistance::getDistance(const Geometry* g) const
 {
-    struct : public ItemDistance {
-        double
-        distance(const ItemBoundable* item1, const ItemBoundable* item2) override
-        {
-            return static_cast<const FacetSequence*>(item1->getItem())->distance(*static_cast<const FacetSequence*>
-                    (item2->getItem()));
-        }
-    } itemDistance;
+    FacetSequenceDistance itemDistance;
 
     std::unique_ptr<STRtree> tree2(FacetSequenceTreeBuilder::build(g));
 
@@ -66,6 +76,126 @@ IndexedFacetDistance::getDistance(const Geometry* g) const
     return p_distance;
 }
 
+std::vector<GeometryLocation>
+IndexedFacetDistance::nearestLocations(const Geometry* g) const
+{
+    double distance;
+    return nearestLocations(g, distance);
+}
+
+std::vector<GeometryLocation>
+IndexedFacetDistance::nearestLocations(const Geometry* g, double& distance) const
+{
+    if(baseGeometry->isEmpty() || g->isEmpty()) {
+        return std::vector<GeometryLocation>();
+    }
+
+    FacetSequenceDistance itemDistance;
+
+    std::unique_ptr<STRtree> tree2(FacetSequenceTreeBuilder::build(g));
+
+    std::vector<GeometryLocation> locs;
+    try {
+        std::pair<const void*, const void*> obj = cachedTree->nearestNeighbour(tree2.get(), &itemDistance);
+        const FacetSequence* fs1 = static_cast<const FacetSequence*>(obj.first);
+        const FacetSequence* fs2 = static_cast<const FacetSequence*>(obj.second);
+        locs = fs1->nearestLocations(*fs2);
+        distance = fs1->distance(*fs2);
+    }
+    catch(...) {
+        tree2->iterate(deleter);
+        throw;
+    }
+
+    tree2->iterate(deleter);
+
+    return locs;
+}
+
+std::unique_ptr<CoordinateSequence>
+IndexedFacetDistance::nearestPoints(const Geometry* g) const
+{
+    std::vector<GeometryLocation> locs = nearestLocations(g);
+    if(locs.empty()) {
+        return nullptr;
+    }
+
+    std::unique_ptr<CoordinateSequence> nearestPts(new CoordinateArraySequence());
+    nearestPts->add(locs[0].getCoordinate());
+    nearestPts->add(locs[1].getCoordinate());
+    return nearestPts;
+}
+
+bool
+IndexedFacetDistance::isWithinDistance(const Geometry* g, double maxDistance) const
+{
+    if(baseGeometry->isEmpty() || g->isEmpty()) {
+        return false;
+    }
+
+    // short-circuit test
+    if(baseGeometry->getEnvelopeInternal()->distance(g->getEnvelopeInternal()) > maxDistance) {
+        return false;
+    }
+
+    FacetSequenceDistance itemDistance;
+
+    std::unique_ptr<STRtree> tree2(FacetSequenceTreeBuilder::build(g));
+
+    bool isWithin;
+    try {
+        isWithin = cachedTree->isWithinDistance(tree2.get(), &itemDistance, maxDistance);
+    }
+    catch(...) {
+        tree2->iterate(deleter);
+        throw;
+    }
+
+    tree2->iterate(deleter);
+
+    return isWithin;
+}
+
+Coordinate
+IndexedFacetDistance::nearestPoint(const Coordinate& pt) const
+{
+    Coordinate nearestPt;
+    if(baseGeometry->isEmpty()) {
+        nearestPt.setNull();
+        return nearestPt;
+    }
+
+    CoordinateArraySequence pts(1);
+    pts.setAt(pt, 0);
+    FacetSequence ptSeq(&pts, 0, 1);
+
+    FacetSequenceDistance itemDistance;
+    const FacetSequence* fs = static_cast<const FacetSequence*>(
+                                  cachedTree->nearestNeighbour(ptSeq.getEnvelope(), &ptSeq, &itemDistance));
+
+    return fs->nearestLocations(ptSeq)[0].getCoordinate();
+}
+
+bool
+IndexedFacetDistance::isWithinDistance(const Coordinate& pt, double maxDistance) const
+{
+    if(baseGeometry->isEmpty()) {
+        return false;
+    }
+
+    CoordinateArraySequence pts(1);
+    pts.setAt(pt, 0);
+    FacetSequence ptSeq(&pts, 0, 1);
+
+    // short-circuit test
+    if(baseGeometry->getEnvelopeInternal()->distance(ptSeq.getEnvelope()) > maxDistance) {
+        return false;
+    }
+
+    FacetSequenceDistance itemDistance;
+    return cachedTree->isWithinDistance(ptSeq.getEnvelope(), &ptSeq, &itemDistance, maxDistance);
+}
+
 IndexedFacetDistance::~IndexedFacetDistance()
 {
     cachedTree->iterate(deleter);
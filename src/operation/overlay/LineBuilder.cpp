@@ -85,9 +85,9 @@ void
 LineBuilder::findCoveredLineEdges()
 {
 // first set covered for all L edges at nodes which have A edges too
-    map<Coordinate*, Node*, CoordinateLessThen>& nodeMap = op->getGraph().getNodeMap()->nodeMap;
-    map<Coordinate*, Node*, CoordinateLessThen>::iterator it = nodeMap.begin();
-    map<Coordinate*, Node*, CoordinateLessThen>::iterator endIt = nodeMap.end();
+    NodeMap& nodeMap = *op->getGraph().getNodeMap();
+    NodeMap::iterator it = nodeMap.begin();
+    NodeMap::iterator endIt = nodeMap.end();
     for(; it != endIt; ++it) {
         Node* node = it->second;
         //node.print(System.out);
@@ -0,0 +1,289 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/overlay/OverlayComponentSplitter.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/BinaryOp.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Polygonal.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/util/TopologyException.h>
+
+#include <algorithm>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace operation { // geos.operation
+namespace overlay { // geos.operation.overlay
+
+namespace {
+
+// Whether the coordinates of the component are left as they are by
+// the precision model the overlay rounds its output to
+bool
+isPrecise(const Geometry& component, const PrecisionModel& pm)
+{
+    if(pm.getType() == PrecisionModel::FLOATING) {
+        return true;
+    }
+    std::unique_ptr<CoordinateSequence> pts(component.getCoordinates());
+    for(std::size_t i = 0, n = pts->size(); i < n; i++) {
+        const Coordinate& c = pts->getAt(i);
+        if(pm.makePrecise(c.x) != c.x || pm.makePrecise(c.y) != c.y) {
+            return false;
+        }
+    }
+    return true;
+}
+
+LinearRing*
+orientedRing(const LineString& ring, bool ccw)
+{
+    CoordinateSequence* pts = ring.getCoordinatesRO()->clone();
+    if(algorithm::Orientation::isCCW(pts) != ccw) {
+        CoordinateSequence::reverse(pts);
+    }
+    return ring.getFactory()->createLinearRing(pts);
+}
+
+// A copy of a polygon oriented as the overlay builds them: shell
+// clockwise, holes counter-clockwise
+Geometry*
+orientedCopy(const Polygon& poly)
+{
+    std::vector<Geometry*>* holes = new std::vector<Geometry*>();
+    for(std::size_t i = 0, n = poly.getNumInteriorRing(); i < n; i++) {
+        holes->push_back(orientedRing(*poly.getInteriorRingN(i), true));
+    }
+    return poly.getFactory()->createPolygon(
+               orientedRing(*poly.getExteriorRing(), false), holes);
+}
+
+} // anonymous namespace
+
+/*public static*/
+std::unique_ptr<Geometry>
+OverlayComponentSplitter::overlay(const Geometry* g0, const Geometry* g1,
+                                  OverlayOp::OpCode opCode)
+{
+    OverlayComponentSplitter splitter(*g0, *g1, opCode);
+    if(!splitter.hasDisjointComponents()) {
+        return BinaryOp(g0, g1, overlayOp(opCode));
+    }
+
+    std::unique_ptr<Geometry> result;
+    std::unique_ptr<Geometry> interacting0 = splitter.getInteracting(0);
+    std::unique_ptr<Geometry> interacting1 = splitter.getInteracting(1);
+    // the interacting components of the second operand are only kept
+    // by a union or a symmetric difference
+    if(!interacting0->isEmpty() || (splitter.isKept(1) && !interacting1->isEmpty())) {
+        try {
+            result = BinaryOp(interacting0.get(), interacting1.get(), overlayOp(opCode));
+        }
+        catch(const util::TopologyException&) {
+            // The robustness heuristics of BinaryOp depend on the whole
+            // operands (e.g. their common bits), and may still succeed
+            // on them.
+            return BinaryOp(g0, g1, overlayOp(opCode));
+        }
+    }
+    return splitter.combine(std::move(result));
+}
+
+/*public*/
+OverlayComponentSplitter::OverlayComponentSplitter(const Geometry& g0,
+        const Geometry& g1, OverlayOp::OpCode p_opCode)
+    :
+    opCode(p_opCode)
+{
+    operands[0] = &g0;
+    operands[1] = &g1;
+
+    std::size_t n[2] = { g0.getNumGeometries(), g1.getNumGeometries() };
+    interacting[0].assign(n[0], true);
+    interacting[1].assign(n[1], true);
+    bool polygonal = dynamic_cast<const Polygonal*>(&g0)
+                     && dynamic_cast<const Polygonal*>(&g1);
+    // nothing to leave out of the overlay of two polygons
+    if(!polygonal || (n[0] <= 1 && n[1] <= 1)) {
+        return;
+    }
+
+    // Envelopes meet both ways, so the components of the smaller
+    // operand are indexed and queried with those of the larger one
+    std::vector<bool> meetsOther[2];
+    meetsOther[0].assign(n[0], false);
+    meetsOther[1].assign(n[1], false);
+    int indexed = n[0] <= n[1] ? 0 : 1;
+    int queried = 1 - indexed;
+    index::strtree::PackedSTRtree tree;
+    for(std::size_t i = 0; i < n[indexed]; i++) {
+        tree.insertIndex(operands[indexed]->getGeometryN(i)->getEnvelopeInternal(), i);
+    }
+    tree.build();
+    for(std::size_t i = 0; i < n[queried]; i++) {
+        const Geometry* component = operands[queried]->getGeometryN(i);
+        if(component->isEmpty()) {
+            continue;
+        }
+        tree.queryIndex(*component->getEnvelopeInternal(), [&](std::size_t j) {
+            meetsOther[queried][i] = true;
+            meetsOther[indexed][j] = true;
+        });
+    }
+
+    const PrecisionModel& pm = *g0.getFactory()->getPrecisionModel();
+    for(int geomIndex = 0; geomIndex < 2; geomIndex++) {
+        const Geometry& g = *operands[geomIndex];
+        if(!isKept(geomIndex)) {
+            for(std::size_t i = 0; i < n[geomIndex]; i++) {
+                interacting[geomIndex][i] = meetsOther[geomIndex][i];
+            }
+            continue;
+        }
+
+        std::vector<std::size_t> candidates;
+        for(std::size_t i = 0; i < n[geomIndex]; i++) {
+            if(!meetsOther[geomIndex][i] && !g.getGeometryN(i)->isEmpty()) {
+                candidates.push_back(i);
+            }
+        }
+        if(candidates.empty()) {
+            continue;
+        }
+
+        // Components of one operand may overlap, and would then be
+        // dissolved by the overlay
+        index::strtree::PackedSTRtree ownTree;
+        for(std::size_t i = 0; i < n[geomIndex]; i++) {
+            ownTree.insertIndex(g.getGeometryN(i)->getEnvelopeInternal(), i);
+        }
+        ownTree.build();
+        for(std::size_t i : candidates) {
+            const Geometry* component = g.getGeometryN(i);
+            bool isolated = true;
+            ownTree.queryIndex(*component->getEnvelopeInternal(), [&](std::size_t j) {
+                if(j != i) {
+                    isolated = false;
+                }
+            });
+            if(isolated && isPrecise(*component, pm)) {
+                interacting[geomIndex][i] = false;
+            }
+        }
+    }
+}
+
+/*private*/
+bool
+OverlayComponentSplitter::isKept(int geomIndex) const
+{
+    switch(opCode) {
+    case OverlayOp::opUNION:
+    case OverlayOp::opSYMDIFFERENCE:
+        return true;
+    case OverlayOp::opDIFFERENCE:
+        return geomIndex == 0;
+    default:
+        return false;
+    }
+}
+
+/*public*/
+bool
+OverlayComponentSplitter::hasDisjointComponents() const
+{
+    for(int geomIndex = 0; geomIndex < 2; geomIndex++) {
+        const std::vector<bool>& inter = interacting[geomIndex];
+        for(std::size_t i = 0; i < inter.size(); i++) {
+            if(!inter[i] && !operands[geomIndex]->getGeometryN(i)->isEmpty()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+OverlayComponentSplitter::getInteracting(int geomIndex) const
+{
+    const Geometry* g = operands[geomIndex];
+    const std::vector<bool>& inter = interacting[geomIndex];
+    std::vector<Geometry*>* parts = new std::vector<Geometry*>();
+    for(std::size_t i = 0; i < inter.size(); i++) {
+        if(inter[i]) {
+            parts->push_back(g->getGeometryN(i)->clone());
+        }
+    }
+    return std::unique_ptr<Geometry>(g->getFactory()->buildGeometry(parts));
+}
+
+/*private*/
+void
+OverlayComponentSplitter::addDisjoint(int geomIndex,
+                                      std::vector<Geometry*>& parts) const
+{
+    const Geometry* g = operands[geomIndex];
+    const std::vector<bool>& inter = interacting[geomIndex];
+    for(std::size_t i = 0; i < inter.size(); i++) {
+        const Geometry* component = g->getGeometryN(i);
+        if(!inter[i] && !component->isEmpty()) {
+            parts.push_back(orientedCopy(dynamic_cast<const Polygon&>(*component)));
+        }
+    }
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+OverlayComponentSplitter::combine(std::unique_ptr<Geometry> interactingResult) const
+{
+    std::vector<Geometry*> disjoint;
+    if(isKept(0)) {
+        addDisjoint(0, disjoint);
+    }
+    if(isKept(1)) {
+        addDisjoint(1, disjoint);
+    }
+
+    const GeometryFactory* factory = operands[0]->getFactory();
+    if(disjoint.empty()) {
+        if(interactingResult) {
+            return interactingResult;
+        }
+        return std::unique_ptr<Geometry>(OverlayOp::createEmptyResult(
+                                             opCode, operands[0], operands[1], factory));
+    }
+
+    std::vector<Geometry*>* parts = new std::vector<Geometry*>();
+    if(interactingResult) {
+        for(std::size_t i = 0, n = interactingResult->getNumGeometries(); i < n; i++) {
+            const Geometry* component = interactingResult->getGeometryN(i);
+            if(!component->isEmpty()) {
+                parts->push_back(component->clone());
+            }
+        }
+    }
+    parts->insert(parts->end(), disjoint.begin(), disjoint.end());
+    return std::unique_ptr<Geometry>(factory->buildGeometry(parts));
+}
+
+} // namespace geos.operation.overlay
+} // namespace geos.operation
+} // namespace geos
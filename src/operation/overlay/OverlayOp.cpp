@@ -250,7 +250,7 @@ OverlayOp::copyPoints(int argIndex, const Envelope* env)
 
     // TODO: set env to null if it covers arg geometry envelope
 
-    NodeMap::container& nodeMap = arg[argIndex]->getNodeMap()->nodeMap;
+    NodeMap& nodeMap = *arg[argIndex]->getNodeMap();
     for(NodeMap::const_iterator it = nodeMap.begin(), itEnd = nodeMap.end();
             it != itEnd; ++it) {
         Node* graphNode = it->second;
@@ -280,7 +280,7 @@ void
 OverlayOp::computeLabelling()
 //throw(TopologyException *) // and what else ?
 {
-    NodeMap::container& nodeMap = graph.getNodeMap()->nodeMap;
+    NodeMap& nodeMap = *graph.getNodeMap();
 
 #if GEOS_DEBUG
     cerr << "OverlayOp::computeLabelling(): at call time: " << edgeList.print() << endl;
@@ -315,7 +315,7 @@ OverlayOp::computeLabelling()
 void
 OverlayOp::mergeSymLabels()
 {
-    NodeMap::container& nodeMap = graph.getNodeMap()->nodeMap;
+    NodeMap& nodeMap = *graph.getNodeMap();
 
 #if GEOS_DEBUG
     cerr << "OverlayOp::mergeSymLabels() scanning " << nodeMap.size() << " nodes from map:" << endl;
@@ -344,7 +344,7 @@ OverlayOp::updateNodeLabelling()
     // (Note that a node may have already been labelled
     // because it is a point in one of the input geometries)
 
-    NodeMap::container& nodeMap = graph.getNodeMap()->nodeMap;
+    NodeMap& nodeMap = *graph.getNodeMap();
 
 #if GEOS_DEBUG
     cerr << "OverlayOp::updateNodeLabelling() scanning "
@@ -369,7 +369,7 @@ OverlayOp::updateNodeLabelling()
 void
 OverlayOp::labelIncompleteNodes()
 {
-    NodeMap::container& nodeMap = graph.getNodeMap()->nodeMap;
+    NodeMap& nodeMap = *graph.getNodeMap();
 
 #if GEOS_DEBUG
     cerr << "OverlayOp::labelIncompleteNodes() scanning " << nodeMap.size() << " nodes from map:" << endl;
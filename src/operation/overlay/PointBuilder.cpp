@@ -61,9 +61,8 @@ PointBuilder::build(OverlayOp::OpCode opCode)
 void
 PointBuilder::extractNonCoveredResultNodes(OverlayOp::OpCode opCode)
 {
-    map<Coordinate*, Node*, CoordinateLessThen>& nodeMap =
-        op->getGraph().getNodeMap()->nodeMap;
-    map<Coordinate*, Node*, CoordinateLessThen>::iterator it = nodeMap.begin();
+    NodeMap& nodeMap = *op->getGraph().getNodeMap();
+    NodeMap::iterator it = nodeMap.begin();
     for(; it != nodeMap.end(); ++it) {
         Node* n = it->second;
 
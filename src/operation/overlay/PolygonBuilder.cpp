@@ -84,7 +84,7 @@ PolygonBuilder::add(PlanarGraph* graph)
         dirEdges[i] = de;
     }
 
-    NodeMap::container& nodeMap = graph->getNodeMap()->nodeMap;
+    NodeMap& nodeMap = *graph->getNodeMap();
     vector<Node*> nodes;
     nodes.reserve(nodeMap.size());
     for(NodeMap::iterator it = nodeMap.begin(), itEnd = nodeMap.end();
@@ -113,9 +113,11 @@ PolygonBuilder::add(const vector<DirectedEdge*>* dirEdges,
 
     sortShellsAndHoles(edgeRings, shellList, freeHoleList);
 
+    // the point-in-area locators are only built for the shells whose
+    // envelope contains a free hole, see findEdgeRingContaining
     vector<FastPIPRing> indexedshellist;
     for(auto const& shell : shellList) {
-        FastPIPRing pipRing { shell, new geos::algorithm::locate::IndexedPointInAreaLocator(*shell->getLinearRing()) };
+        FastPIPRing pipRing { shell, nullptr };
         indexedshellist.push_back(pipRing);
     }
     placeFreeHoles(indexedshellist, freeHoleList);
@@ -325,7 +327,7 @@ PolygonBuilder::findEdgeRingContaining(EdgeRing* testEr,
     EdgeRing* minShell = nullptr;
     const Envelope* minShellEnv = nullptr;
 
-    for(auto const& tryShell : newShellList) {
+    for(auto& tryShell : newShellList) {
         LinearRing* tryShellRing = tryShell.edgeRing->getLinearRing();
         const Envelope* tryShellEnv = tryShellRing->getEnvelopeInternal();
         // the hole envelope cannot equal the shell envelope
@@ -341,6 +343,10 @@ PolygonBuilder::findEdgeRingContaining(EdgeRing* testEr,
         const CoordinateSequence* tsrcs = tryShellRing->getCoordinatesRO();
         Coordinate testPt = operation::polygonize::EdgeRing::ptNotInList(testRing->getCoordinatesRO(), tsrcs);
 
+        if(tryShell.pipLocator == nullptr) {
+            tryShell.pipLocator = new geos::algorithm::locate::IndexedPointInAreaLocator(*tryShellRing);
+        }
+
         bool isContained = false;
         if(tryShell.pipLocator->locate(&testPt) != Location::EXTERIOR) {
             isContained = true;
@@ -0,0 +1,300 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/polygonize/TiledPolygonizer.h>
+#include <geos/operation/polygonize/PolygonizeGraph.h>
+#include <geos/operation/polygonize/PolygonizeEdge.h>
+#include <geos/operation/polygonize/EdgeRing.h>
+#include <geos/planargraph/DirectedEdge.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryComponentFilter.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/ParallelChunks.h>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace operation { // geos.operation
+namespace polygonize { // geos.operation.polygonize
+
+namespace {
+
+class LineStringCollector: public GeometryComponentFilter {
+public:
+
+    LineStringCollector(std::vector<const LineString*>& p_lines)
+        :
+        lines(p_lines)
+    {}
+
+    void
+    filter_ro(const Geometry* g) override
+    {
+        const LineString* ls = dynamic_cast<const LineString*>(g);
+        if(ls) {
+            // computed now, as the lines are later read by all the threads
+            ls->getEnvelopeInternal();
+            lines.push_back(ls);
+        }
+    }
+
+private:
+
+    std::vector<const LineString*>& lines;
+};
+
+bool
+isStrictlyInside(const Envelope& tileEnv, const Envelope& env)
+{
+    return env.getMinX() > tileEnv.getMinX() && env.getMaxX() < tileEnv.getMaxX()
+           && env.getMinY() > tileEnv.getMinY() && env.getMaxY() < tileEnv.getMaxY();
+}
+
+/*
+ * Polygonizes lines[ids] as Polygonizer does, and appends to polys
+ * the polygons whose shell envelope passes keepShell.
+ *
+ * If usedSides is given, the directed edges of the shells kept and of
+ * their holes are counted in it, by line index.
+ */
+template<typename KeepFn>
+void
+polygonizeLines(const std::vector<const LineString*>& lines,
+                const std::vector<std::size_t>& ids,
+                KeepFn keepShell,
+                std::vector<unsigned char>* usedSides,
+                std::vector<std::unique_ptr<Polygon>>& polys)
+{
+    if(ids.empty()) {
+        return;
+    }
+
+    PolygonizeGraph graph(lines[ids.front()]->getFactory());
+    for(std::size_t id : ids) {
+        graph.addEdge(lines[id]);
+    }
+
+    std::vector<const LineString*> dangles;
+    graph.deleteDangles(dangles);
+    std::vector<const LineString*> cutEdges;
+    graph.deleteCutEdges(cutEdges);
+
+    std::vector<EdgeRing*> edgeRings;
+    graph.getEdgeRings(edgeRings);
+
+    std::vector<EdgeRing*> shells;
+    std::vector<EdgeRing*> holes;
+    for(EdgeRing* er : edgeRings) {
+        if(!er->isValid()) {
+            continue;
+        }
+        if(er->isHole()) {
+            holes.push_back(er);
+        }
+        else {
+            shells.push_back(er);
+        }
+    }
+
+    std::unordered_map<const LineString*, std::size_t> lineIndex;
+    if(usedSides) {
+        for(std::size_t id : ids) {
+            lineIndex[lines[id]] = id;
+        }
+    }
+    auto countSides = [usedSides, &lineIndex](const EdgeRing * er) {
+        if(!usedSides) {
+            return;
+        }
+        for(const planargraph::DirectedEdge* de : er->getEdges()) {
+            PolygonizeEdge* e = static_cast<PolygonizeEdge*>(de->getEdge());
+            (*usedSides)[lineIndex[e->getLine()]]++;
+        }
+    };
+
+    std::unordered_set<const EdgeRing*> keptShells;
+    for(EdgeRing* shell : shells) {
+        if(keepShell(*shell->getRingInternal()->getEnvelopeInternal())) {
+            keptShells.insert(shell);
+            countSides(shell);
+        }
+    }
+    for(EdgeRing* hole : holes) {
+        EdgeRing* shell = EdgeRing::findEdgeRingContaining(hole, &shells);
+        if(shell != nullptr && keptShells.count(shell)) {
+            countSides(hole);
+            shell->addHole(hole->getRingOwnership());
+        }
+    }
+    for(EdgeRing* shell : shells) {
+        if(keptShells.count(shell)) {
+            polys.emplace_back(shell->getPolygon());
+        }
+    }
+}
+
+/// Number of tiles polygonized before their polygons are handed out
+const std::size_t TILES_PER_THREAD_BATCH = 16;
+
+} // anonymous namespace
+
+/*public*/
+TiledPolygonizer::TiledPolygonizer(double p_tileSize)
+    :
+    tileSize(p_tileSize),
+    numThreads(1),
+    nTilesX(0),
+    nTilesY(0)
+{
+    if(!(tileSize > 0.0)) {
+        throw util::IllegalArgumentException("TiledPolygonizer: tile size must be positive");
+    }
+}
+
+TiledPolygonizer::~TiledPolygonizer() {}
+
+/*public*/
+void
+TiledPolygonizer::setNumThreads(std::size_t n)
+{
+    numThreads = util::normalizeThreadCount(n);
+}
+
+/*public*/
+void
+TiledPolygonizer::add(const Geometry* g)
+{
+    std::size_t first = lines.size();
+    LineStringCollector collector(lines);
+    g->apply_ro(&collector);
+    for(std::size_t i = first; i < lines.size(); i++) {
+        extent.expandToInclude(lines[i]->getEnvelopeInternal());
+    }
+}
+
+/*private*/
+Envelope
+TiledPolygonizer::getTileEnvelope(std::size_t ix, std::size_t iy) const
+{
+    double x0 = extent.getMinX();
+    double y0 = extent.getMinY();
+    return Envelope(x0 + static_cast<double>(ix) * tileSize,
+                    x0 + static_cast<double>(ix + 1) * tileSize,
+                    y0 + static_cast<double>(iy) * tileSize,
+                    y0 + static_cast<double>(iy + 1) * tileSize);
+}
+
+/*private*/
+bool
+TiledPolygonizer::isInsideTile(const Envelope& env) const
+{
+    // The tile is found by division, and its neighbours are checked too
+    // so that rounding cannot make this disagree with getTileEnvelope
+    double fx = std::floor((env.getMinX() - extent.getMinX()) / tileSize);
+    double fy = std::floor((env.getMinY() - extent.getMinY()) / tileSize);
+    std::size_t ix = static_cast<std::size_t>(std::max(fx, 0.0));
+    std::size_t iy = static_cast<std::size_t>(std::max(fy, 0.0));
+    for(std::size_t x = (ix > 0 ? ix - 1 : 0); x <= ix + 1 && x < nTilesX; x++) {
+        for(std::size_t y = (iy > 0 ? iy - 1 : 0); y <= iy + 1 && y < nTilesY; y++) {
+            if(isStrictlyInside(getTileEnvelope(x, y), env)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*public*/
+void
+TiledPolygonizer::polygonize(const PolygonSink& sink)
+{
+    if(lines.empty()) {
+        return;
+    }
+
+    nTilesX = std::max<std::size_t>(1, static_cast<std::size_t>(
+                                        std::ceil(extent.getWidth() / tileSize)));
+    nTilesY = std::max<std::size_t>(1, static_cast<std::size_t>(
+                                        std::ceil(extent.getHeight() / tileSize)));
+    std::size_t nTiles = nTilesX * nTilesY;
+
+    index::strtree::PackedSTRtree tree;
+    for(std::size_t i = 0; i < lines.size(); i++) {
+        tree.insertIndex(lines[i]->getEnvelopeInternal(), i);
+    }
+    tree.build();
+
+    // Number of directed edges of each line used by the polygons found
+    // in the tiles. Such polygons are strictly inside their tile, so
+    // each line is only ever counted by a single tile.
+    std::vector<unsigned char> usedSides(lines.size(), 0);
+
+    std::size_t batchSize = TILES_PER_THREAD_BATCH * numThreads;
+    std::vector<std::vector<std::unique_ptr<Polygon>>> tilePolys(batchSize);
+
+    for(std::size_t batchStart = 0; batchStart < nTiles; batchStart += batchSize) {
+        std::size_t batchEnd = std::min(nTiles, batchStart + batchSize);
+        util::runChunks(batchEnd - batchStart, numThreads, std::vector<std::size_t>(),
+        [&](std::size_t chunk, std::vector<std::size_t>& ids) {
+            std::size_t tile = batchStart + chunk;
+            Envelope tileEnv = getTileEnvelope(tile % nTilesX, tile / nTilesX);
+            ids.clear();
+            tree.queryIndex(tileEnv, [&ids](std::size_t i) {
+                ids.push_back(i);
+            });
+            // the graph, hence the polygons, depend on the edge order
+            std::sort(ids.begin(), ids.end());
+
+            polygonizeLines(lines, ids, [&tileEnv](const Envelope & env) {
+                return isStrictlyInside(tileEnv, env);
+            }, &usedSides, tilePolys[chunk]);
+        });
+
+        for(auto& polys : tilePolys) {
+            for(auto& poly : polys) {
+                sink(std::move(poly));
+            }
+            polys.clear();
+        }
+    }
+
+    // Stitch the polygons not strictly inside a tile from the lines
+    // not used on both sides. Polygons found in the tiles reappear
+    // from these lines only as areas inside a single tile, which are
+    // left out again.
+    std::vector<std::size_t> ids;
+    for(std::size_t i = 0; i < lines.size(); i++) {
+        if(usedSides[i] < 2) {
+            ids.push_back(i);
+        }
+    }
+    std::vector<std::unique_ptr<Polygon>> polys;
+    polygonizeLines(lines, ids, [this](const Envelope & env) {
+        return !isInsideTile(env);
+    }, nullptr, polys);
+    for(auto& poly : polys) {
+        sink(std::move(poly));
+    }
+}
+
+} // namespace geos.operation.polygonize
+} // namespace geos.operation
+} // namespace geos
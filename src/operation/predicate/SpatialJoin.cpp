@@ -0,0 +1,164 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/predicate/SpatialJoin.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryComponentFilter.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/util/ParallelChunks.h>
+
+#include <algorithm>
+#include <memory>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace operation { // geos.operation
+namespace predicate { // geos.operation.predicate
+
+namespace {
+
+/*
+ * Geometries cache their envelope on first use. The right-hand
+ * geometries are read by all the threads at once, so their envelopes,
+ * and those of their components, are computed beforehand rather than
+ * have the threads wait for each other on them.
+ */
+class ComponentEnvelopeFilter: public GeometryComponentFilter {
+public:
+    void
+    filter_ro(const Geometry* g) override
+    {
+        g->getEnvelopeInternal();
+    }
+};
+
+/// Number of left-hand geometries handed to a thread at a time
+const std::size_t CHUNK_SIZE = 64;
+
+} // anonymous namespace
+
+/*public*/
+SpatialJoin::SpatialJoin(const std::vector<const Geometry*>& p_left,
+                         const std::vector<const Geometry*>& p_right)
+    :
+    left(p_left),
+    right(p_right),
+    numThreads(1)
+{}
+
+/*public*/
+void
+SpatialJoin::setNumThreads(std::size_t n)
+{
+    numThreads = util::normalizeThreadCount(n);
+}
+
+/*public static*/
+std::vector<SpatialJoin::IndexPair>
+SpatialJoin::join(const std::vector<const Geometry*>& left,
+                  const std::vector<const Geometry*>& right,
+                  Predicate pred, double distance,
+                  std::size_t numThreads)
+{
+    SpatialJoin op(left, right);
+    op.setNumThreads(numThreads);
+    return op.join(pred, distance);
+}
+
+/*public*/
+std::vector<SpatialJoin::IndexPair>
+SpatialJoin::join(Predicate pred, double distance) const
+{
+    index::strtree::PackedSTRtree tree;
+    ComponentEnvelopeFilter envFilter;
+    for(std::size_t j = 0; j < right.size(); j++) {
+        const Geometry* g = right[j];
+        if(g == nullptr || g->isEmpty()) {
+            continue;
+        }
+        g->apply_ro(&envFilter);
+        tree.insertIndex(g->getEnvelopeInternal(), j);
+    }
+    tree.build();
+
+    double expandBy = (pred == WITHIN_DISTANCE) ? distance : 0.0;
+
+    std::size_t nChunks = (left.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    std::vector<std::vector<IndexPair>> chunkPairs(nChunks);
+
+    util::runChunks(nChunks, numThreads, std::vector<std::size_t>(),
+    [&](std::size_t chunk, std::vector<std::size_t>& candidates) {
+        std::vector<IndexPair>& pairs = chunkPairs[chunk];
+        std::size_t end = std::min(left.size(), (chunk + 1) * CHUNK_SIZE);
+        for(std::size_t i = chunk * CHUNK_SIZE; i < end; i++) {
+            const Geometry* g = left[i];
+            if(g == nullptr || g->isEmpty()) {
+                continue;
+            }
+
+            Envelope searchEnv(*g->getEnvelopeInternal());
+            searchEnv.expandBy(expandBy);
+
+            candidates.clear();
+            tree.queryIndex(searchEnv, [&candidates](std::size_t j) {
+                candidates.push_back(j);
+            });
+            if(candidates.empty()) {
+                continue;
+            }
+            std::sort(candidates.begin(), candidates.end());
+
+            std::unique_ptr<const geom::prep::PreparedGeometry> prep(
+                geom::prep::PreparedGeometryFactory::prepare(g));
+
+            for(std::size_t j : candidates) {
+                const Geometry* other = right[j];
+                bool match;
+                switch(pred) {
+                case INTERSECTS:
+                    match = prep->intersects(other);
+                    break;
+                case CONTAINS:
+                    match = prep->contains(other);
+                    break;
+                case COVERS:
+                    match = prep->covers(other);
+                    break;
+                default:
+                    match = prep->isWithinDistance(other, distance);
+                }
+                if(match) {
+                    pairs.emplace_back(i, j);
+                }
+            }
+        }
+    });
+
+    std::vector<IndexPair> result;
+    std::size_t n = 0;
+    for(const auto& pairs : chunkPairs) {
+        n += pairs.size();
+    }
+    result.reserve(n);
+    for(const auto& pairs : chunkPairs) {
+        result.insert(result.end(), pairs.begin(), pairs.end());
+    }
+    return result;
+}
+
+} // namespace geos.operation.predicate
+} // namespace geos.operation
+} // namespace geos
@@ -66,14 +66,14 @@ EdgeEndBuilder::computeEdgeEnds(Edge* edge, vector<EdgeEnd*>* l)
     EdgeIntersection* eiPrev = nullptr;
     EdgeIntersection* eiCurr = nullptr;
 
-    EdgeIntersection* eiNext = *it;
+    EdgeIntersection* eiNext = &*it;
     it++;
     do {
         eiPrev = eiCurr;
         eiCurr = eiNext;
         eiNext = nullptr;
         if(it != eiList.end()) {
-            eiNext = *it;
+            eiNext = &*it;
             it++;
         }
         if(eiCurr != nullptr) {
@@ -25,6 +25,7 @@
 #include <geos/algorithm/LineIntersector.h>
 #include <geos/algorithm/PointLocator.h>
 #include <geos/geom/IntersectionMatrix.h>
+#include <geos/geom/Dimension.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/Envelope.h>
 #include <geos/geomgraph/index/SegmentIntersector.h>
@@ -37,9 +38,12 @@
 #include <geos/geomgraph/EdgeIntersection.h>
 
 #include <geos/util/Interrupt.h>
+#include <geos/util/IllegalArgumentException.h>
 
+#include <algorithm>
 #include <vector>
 #include <cassert>
+#include <sstream>
 
 #ifndef GEOS_DEBUG
 #define GEOS_DEBUG 0
@@ -61,7 +65,8 @@ namespace relate { // geos.operation.relate
 RelateComputer::RelateComputer(std::vector<GeometryGraph*>* newArg):
     arg(newArg),
     nodes(RelateNodeFactory::instance()),
-    im(new IntersectionMatrix())
+    im(new IntersectionMatrix()),
+    patterns(nullptr)
 {
 }
 
@@ -81,6 +86,9 @@ RelateComputer::computeIM()
         computeDisjointIM(im.get());
         return im.release();
     }
+    if(isMatchDecided()) {
+        return im.release();
+    }
 
 #if GEOS_DEBUG
     std::cerr << "RelateComputer::computeIM: "
@@ -112,13 +120,41 @@ RelateComputer::computeIM()
               << std::endl;
 #endif
 
+    // When matching patterns, the sweep can stop at the first proper
+    // intersection if the lower bound it gives decides the match
+    bool isDoneIfProperInt = false;
+    if(patterns) {
+        IntersectionMatrix properIM(*im);
+        computeProperIntersectionIM(true, false, &properIM);
+        isDoneIfProperInt = matchPatterns(properIM) != MATCH_UNKNOWN;
+    }
+
     // compute intersections between edges of the two input geometries
     std::unique_ptr< SegmentIntersector> intersector(
-        (*arg)[0]->computeEdgeIntersections((*arg)[1], &li, false)
+        (*arg)[0]->computeEdgeIntersections((*arg)[1], &li, false,
+                isDoneIfProperInt)
     );
 
     GEOS_CHECK_FOR_INTERRUPTS();
 
+#if GEOS_DEBUG
+    std::cerr << "RelateComputer::computeIM: "
+              << "computing proper intersection matrix"
+              << std::endl;
+#endif
+
+    /*
+     * If a proper intersection was found, we can set a lower bound
+     * on the IM.
+     */
+    computeProperIntersectionIM(intersector.get(), im.get());
+
+    // Also reached when the sweep stopped early, as it only stops
+    // once the match is decided
+    if(isMatchDecided()) {
+        return im.release();
+    }
+
 #if GEOS_DEBUG
     std::cerr << "RelateComputer::computeIM: "
               << "copying intersection nodes"
@@ -162,18 +198,6 @@ RelateComputer::computeIM()
     labelIsolatedNodes();
     //Debug.printWatch();
 
-#if GEOS_DEBUG
-    std::cerr << "RelateComputer::computeIM: "
-              << "computing proper intersection matrix"
-              << std::endl;
-#endif
-
-    /*
-     * If a proper intersection was found, we can set a lower bound
-     * on the IM.
-     */
-    computeProperIntersectionIM(intersector.get(), im.get());
-
 #if GEOS_DEBUG
     std::cerr << "RelateComputer::computeIM: "
               << "computing improper intersections"
@@ -240,6 +264,111 @@ RelateComputer::computeIM()
     return im.release();
 }
 
+bool
+RelateComputer::matches(const std::vector<std::string>& p_patterns)
+{
+    for(const std::string& pattern : p_patterns) {
+        if(pattern.length() != 9) {
+            std::ostringstream s;
+            s << "IllegalArgumentException: Should be length 9, is "
+              << "[" << pattern << "] instead" << std::endl;
+            throw util::IllegalArgumentException(s.str());
+        }
+    }
+
+    patterns = &p_patterns;
+    std::unique_ptr<IntersectionMatrix> imX(computeIM());
+    PatternMatch match = matchPatterns(*imX);
+    patterns = nullptr;
+    if(match != MATCH_UNKNOWN) {
+        return match == MATCH_TRUE;
+    }
+
+    // the matrix is complete, only its exact values may still be unknown
+    for(const std::string& pattern : p_patterns) {
+        if(imX->matches(pattern)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* private */
+RelateComputer::PatternMatch
+RelateComputer::matchPatterns(const IntersectionMatrix& imX) const
+{
+    // Upper bounds of the dimension of the interior, boundary and
+    // exterior of each geometry
+    int maxDim[2][3];
+    for(int i = 0; i < 2; i++) {
+        int dim = std::max(int((*arg)[i]->getGeometry()->getDimension()), int(Dimension::False));
+        maxDim[i][Location::INTERIOR] = dim;
+        maxDim[i][Location::BOUNDARY] = std::max(dim - 1, int(Dimension::False));
+        maxDim[i][Location::EXTERIOR] = Dimension::A;
+    }
+
+    bool allFalse = true;
+    for(const std::string& pattern : *patterns) {
+        PatternMatch patternMatch = MATCH_TRUE;
+        for(int ai = 0; ai < 3 && patternMatch != MATCH_FALSE; ai++) {
+            for(int bi = 0; bi < 3 && patternMatch != MATCH_FALSE; bi++) {
+                int lower = imX.get(ai, bi);
+                int upper = std::min(maxDim[0][ai], maxDim[1][bi]);
+                PatternMatch entryMatch;
+                char symbol = pattern[3 * ai + bi];
+                switch(symbol) {
+                case '*':
+                    entryMatch = MATCH_TRUE;
+                    break;
+                case 'T':
+                    entryMatch = lower >= 0 ? MATCH_TRUE
+                                 : (upper < 0 ? MATCH_FALSE : MATCH_UNKNOWN);
+                    break;
+                case 'F':
+                    entryMatch = lower >= 0 ? MATCH_FALSE
+                                 : (upper < 0 ? MATCH_TRUE : MATCH_UNKNOWN);
+                    break;
+                case '0':
+                case '1':
+                case '2': {
+                    int dim = symbol - '0';
+                    if(lower > dim || upper < dim) {
+                        entryMatch = MATCH_FALSE;
+                    }
+                    else if(lower == dim && upper == dim) {
+                        entryMatch = MATCH_TRUE;
+                    }
+                    else {
+                        entryMatch = MATCH_UNKNOWN;
+                    }
+                    break;
+                }
+                default:
+                    // never matched by IntersectionMatrix::matches
+                    entryMatch = MATCH_FALSE;
+                }
+                if(entryMatch != MATCH_TRUE) {
+                    patternMatch = entryMatch;
+                }
+            }
+        }
+        if(patternMatch == MATCH_TRUE) {
+            return MATCH_TRUE;
+        }
+        if(patternMatch == MATCH_UNKNOWN) {
+            allFalse = false;
+        }
+    }
+    return allFalse ? MATCH_FALSE : MATCH_UNKNOWN;
+}
+
+/* private */
+bool
+RelateComputer::isMatchDecided() const
+{
+    return patterns && matchPatterns(*im) != MATCH_UNKNOWN;
+}
+
 void
 RelateComputer::insertEdgeEnds(std::vector<EdgeEnd*>* ee)
 {
@@ -252,12 +381,20 @@ RelateComputer::insertEdgeEnds(std::vector<EdgeEnd*>* ee)
 /* private */
 void
 RelateComputer::computeProperIntersectionIM(SegmentIntersector* intersector, IntersectionMatrix* imX)
+{
+    computeProperIntersectionIM(intersector->hasProperIntersection(),
+                                intersector->hasProperInteriorIntersection(),
+                                imX);
+}
+
+/* private */
+void
+RelateComputer::computeProperIntersectionIM(bool hasProper,
+        bool hasProperInterior, IntersectionMatrix* imX)
 {
     // If a proper intersection is found, we can set a lower bound on the IM.
     int dimA = (*arg)[0]->getGeometry()->getDimension();
     int dimB = (*arg)[1]->getGeometry()->getDimension();
-    bool hasProper = intersector->hasProperIntersection();
-    bool hasProperInterior = intersector->hasProperInteriorIntersection();
     // For Geometry's of dim 0 there can never be proper intersections.
     /**
     * If edge segments of Areas properly intersect, the areas must properly overlap.
@@ -351,7 +488,7 @@ RelateComputer::computeIntersectionNodes(int argIndex)
         EdgeIntersectionList::iterator it = eiL.begin();
         EdgeIntersectionList::iterator end = eiL.end();
         for(; it != end; ++it) {
-            EdgeIntersection* ei = *it;
+            EdgeIntersection* ei = &*it;
             assert(dynamic_cast<RelateNode*>(nodes.addNode(ei->coord)));
             RelateNode* n = static_cast<RelateNode*>(nodes.addNode(ei->coord));
             if(eLoc == Location::BOUNDARY) {
@@ -385,7 +522,7 @@ RelateComputer::labelIntersectionNodes(int argIndex)
         EdgeIntersectionList::iterator eiEnd = eiL.end();
 
         for(; eiIt != eiEnd; ++eiIt) {
-            EdgeIntersection* ei = *eiIt;
+            EdgeIntersection* ei = &*eiIt;
             RelateNode* n = (RelateNode*) nodes.find(ei->coord);
             if(n->getLabel().isNull(argIndex)) {
                 if(eLoc == Location::BOUNDARY) {
@@ -419,9 +556,8 @@ RelateComputer::computeDisjointIM(IntersectionMatrix* imX)
 void
 RelateComputer::labelNodeEdges()
 {
-    std::map<Coordinate*, Node*, CoordinateLessThen>& nMap = nodes.nodeMap;
-    std::map<Coordinate*, Node*, CoordinateLessThen>::iterator nodeIt;
-    for(nodeIt = nMap.begin(); nodeIt != nMap.end(); nodeIt++) {
+    NodeMap::iterator nodeIt;
+    for(nodeIt = nodes.begin(); nodeIt != nodes.end(); nodeIt++) {
         assert(dynamic_cast<RelateNode*>(nodeIt->second));
         RelateNode* node = static_cast<RelateNode*>(nodeIt->second);
 #if GEOS_DEBUG
@@ -446,9 +582,8 @@ RelateComputer::updateIM(IntersectionMatrix& imX)
         e->GraphComponent::updateIM(imX);
         //Debug.println(im);
     }
-    std::map<Coordinate*, Node*, CoordinateLessThen>& nMap = nodes.nodeMap;
-    std::map<Coordinate*, Node*, CoordinateLessThen>::iterator nodeIt;
-    for(nodeIt = nMap.begin(); nodeIt != nMap.end(); nodeIt++) {
+    NodeMap::iterator nodeIt;
+    for(nodeIt = nodes.begin(); nodeIt != nodes.end(); nodeIt++) {
         RelateNode* node = (RelateNode*) nodeIt->second;
         node->updateIM(imX);
         //Debug.println(im);
@@ -49,10 +49,10 @@ RelateNodeGraph::~RelateNodeGraph()
     delete nodes;
 }
 
-map<Coordinate*, Node*, CoordinateLessThen>&
+NodeMap&
 RelateNodeGraph::getNodeMap()
 {
-    return nodes->nodeMap;
+    return *nodes;
 }
 
 void
@@ -75,6 +75,7 @@ RelateNodeGraph::build(GeometryGraph* geomGraph)
     insertEdgeEnds(eeList);
     delete eeBuilder;
     delete eeList;
+    nodes->prepare();
     //Debug.println("==== NodeList ===");
     //Debug.print(nodes);
 }
@@ -102,7 +103,7 @@ RelateNodeGraph::computeIntersectionNodes(GeometryGraph* geomGraph,
         EdgeIntersectionList::iterator eiIt = eiL.begin();
         EdgeIntersectionList::iterator eiEnd = eiL.end();
         for(; eiIt != eiEnd; ++eiIt) {
-            EdgeIntersection* ei = *eiIt;
+            EdgeIntersection* ei = &*eiIt;
             RelateNode* n = (RelateNode*) nodes->addNode(ei->coord);
             if(eLoc == Location::BOUNDARY) {
                 n->setLabelBoundary(argIndex);
@@ -128,8 +129,8 @@ RelateNodeGraph::computeIntersectionNodes(GeometryGraph* geomGraph,
 void
 RelateNodeGraph::copyNodesAndLabels(GeometryGraph* geomGraph, int argIndex)
 {
-    map<Coordinate*, Node*, CoordinateLessThen>& nMap = geomGraph->getNodeMap()->nodeMap;
-    map<Coordinate*, Node*, CoordinateLessThen>::iterator nodeIt;
+    NodeMap& nMap = *geomGraph->getNodeMap();
+    NodeMap::iterator nodeIt;
     for(nodeIt = nMap.begin(); nodeIt != nMap.end(); nodeIt++) {
         Node* graphNode = nodeIt->second;
         Node* newNode = nodes->addNode(graphNode->getCoordinate());
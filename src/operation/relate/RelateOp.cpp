@@ -50,6 +50,14 @@ RelateOp::relate(const Geometry* a, const Geometry* b,
     return relOp.getIntersectionMatrix();
 }
 
+bool
+RelateOp::matches(const Geometry* a, const Geometry* b,
+                  const std::vector<std::string>& patterns)
+{
+    RelateOp relOp(a, b);
+    return relOp.matches(patterns);
+}
+
 RelateOp::RelateOp(const Geometry* g0, const Geometry* g1):
     GeometryGraphOperation(g0, g1),
     relateComp(&arg)
@@ -74,6 +82,12 @@ RelateOp::getIntersectionMatrix()
     return relateComp.computeIM();
 }
 
+bool
+RelateOp::matches(const std::vector<std::string>& patterns)
+{
+    return relateComp.matches(patterns);
+}
+
 } // namespace geos.operation.relate
 } // namespace geos.operation
 } // namespace geos
@@ -19,23 +19,28 @@
  **********************************************************************/
 
 #include <geos/operation/union/CascadedPolygonUnion.h>
+#include <geos/geom/BinaryOp.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Polygon.h>
 #include <geos/geom/MultiPolygon.h>
 #include <geos/geom/util/GeometryCombiner.h>
 #include <geos/geom/util/PolygonExtracter.h>
+#include <geos/operation/overlay/OverlayOp.h>
 #include <geos/index/strtree/STRtree.h>
 // std
 #include <cassert>
 #include <cstddef>
+#include <future>
 #include <memory>
+#include <system_error>
 #include <vector>
 #include <sstream>
 
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/operation/IsSimpleOp.h>
 #include <geos/algorithm/BoundaryNodeRule.h>
+#include <geos/util/ParallelChunks.h>
 #include <geos/util/TopologyException.h>
 #include <string>
 #include <iomanip>
@@ -112,6 +117,15 @@ CascadedPolygonUnion::Union(std::vector<geom::Polygon*>* polys)
     return op.Union();
 }
 
+geom::Geometry*
+CascadedPolygonUnion::Union(std::vector<geom::Polygon*>* polys,
+                            std::size_t numThreads)
+{
+    CascadedPolygonUnion op(polys);
+    op.setNumThreads(numThreads);
+    return op.Union();
+}
+
 geom::Geometry*
 CascadedPolygonUnion::Union(const geom::MultiPolygon* multipoly)
 {
@@ -127,6 +141,12 @@ CascadedPolygonUnion::Union(const geom::MultiPolygon* multipoly)
     return op.Union();
 }
 
+void
+CascadedPolygonUnion::setNumThreads(std::size_t n)
+{
+    numThreads = util::normalizeThreadCount(n);
+}
+
 geom::Geometry*
 CascadedPolygonUnion::Union()
 {
@@ -135,6 +155,7 @@ CascadedPolygonUnion::Union()
     }
 
     geomFactory = inputPolys->front()->getFactory();
+    spareThreads = numThreads - 1;
 
     /**
      * A spatial index to organize the collection
@@ -168,6 +189,40 @@ CascadedPolygonUnion::unionTree(
     return binaryUnion(geoms.get());
 }
 
+/* private */
+std::future<std::unique_ptr<geom::Geometry>>
+CascadedPolygonUnion::forkUnion(std::function<geom::Geometry*()> unionFn)
+{
+    std::size_t n = spareThreads.load();
+    do {
+        if(n == 0) {
+            return std::future<std::unique_ptr<geom::Geometry>>();
+        }
+    }
+    while(! spareThreads.compare_exchange_weak(n, n - 1));
+
+    try {
+        return std::async(std::launch::async, [this, unionFn]() {
+            std::unique_ptr<geom::Geometry> g;
+            try {
+                g.reset(unionFn());
+            }
+            catch(...) {
+                ++spareThreads;
+                throw;
+            }
+            ++spareThreads;
+            return g;
+        });
+    }
+    catch(const std::system_error&) {
+        // no thread could be started: give the slot back and let
+        // the caller do the work
+        ++spareThreads;
+        return std::future<std::unique_ptr<geom::Geometry>>();
+    }
+}
+
 geom::Geometry*
 CascadedPolygonUnion::binaryUnion(GeometryListHolder* geoms)
 {
@@ -187,8 +242,18 @@ CascadedPolygonUnion::binaryUnion(GeometryListHolder* geoms,
     else {
         // recurse on both halves of the list
         std::size_t mid = (end + start) / 2;
-        std::unique_ptr<geom::Geometry> g0(binaryUnion(geoms, start, mid));
+        std::future<std::unique_ptr<geom::Geometry>> f0 = forkUnion(
+        [this, geoms, start, mid]() {
+            return binaryUnion(geoms, start, mid);
+        });
+        std::unique_ptr<geom::Geometry> g0;
         std::unique_ptr<geom::Geometry> g1(binaryUnion(geoms, mid, end));
+        if(f0.valid()) {
+            g0 = f0.get();
+        }
+        else {
+            g0.reset(binaryUnion(geoms, start, mid));
+        }
         return unionSafe(g0.get(), g1.get());
     }
 }
@@ -198,11 +263,26 @@ CascadedPolygonUnion::reduceToGeometries(index::strtree::ItemsList* geomTree)
 {
     std::unique_ptr<GeometryListHolder> geoms(new GeometryListHolder());
 
+    // Subtrees are unioned on spare threads while there are some,
+    // the others on this one. The results keep the order of the tree.
     typedef index::strtree::ItemsList::iterator iterator_type;
     iterator_type end = geomTree->end();
+    std::vector<std::future<std::unique_ptr<geom::Geometry>>> subtrees;
     for(iterator_type i = geomTree->begin(); i != end; ++i) {
         if((*i).get_type() == index::strtree::ItemsListItem::item_is_list) {
-            std::unique_ptr<geom::Geometry> geom(unionTree((*i).get_itemslist()));
+            index::strtree::ItemsList* subtree = (*i).get_itemslist();
+            subtrees.push_back(forkUnion([this, subtree]() {
+                return unionTree(subtree);
+            }));
+        }
+    }
+
+    std::size_t k = 0;
+    for(iterator_type i = geomTree->begin(); i != end; ++i) {
+        if((*i).get_type() == index::strtree::ItemsListItem::item_is_list) {
+            std::future<std::unique_ptr<geom::Geometry>>& f = subtrees[k++];
+            std::unique_ptr<geom::Geometry> geom(
+                f.valid() ? f.get().release() : unionTree((*i).get_itemslist()));
             geoms->push_back_owned(geom.get());
             geom.release();
         }
@@ -386,7 +466,15 @@ CascadedPolygonUnion::extractByEnvelope(geom::Envelope const& env,
 geom::Geometry*
 CascadedPolygonUnion::unionActual(geom::Geometry* g0, geom::Geometry* g1)
 {
-    return restrictToPolygons(std::unique_ptr<geom::Geometry>(g0->Union(g1))).release();
+    // The operands are already split by envelope, and go through the
+    // overlay whole: leaving out their disjoint components as
+    // Geometry::Union does would also leave invalid input polygons
+    // uncleaned for the next unions.
+    if(g0->isEmpty() || g1->isEmpty()) {
+        return restrictToPolygons(std::unique_ptr<geom::Geometry>(g0->Union(g1))).release();
+    }
+    return restrictToPolygons(geom::BinaryOp(g0, g1,
+                              operation::overlay::overlayOp(operation::overlay::OverlayOp::opUNION))).release();
 }
 
 std::unique_ptr<geom::Geometry>
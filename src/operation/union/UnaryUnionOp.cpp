@@ -108,8 +108,12 @@ UnaryUnionOp::Union()
 
     GeomPtr unionPolygons;
     if(!polygons.empty()) {
-        unionPolygons.reset(CascadedPolygonUnion::Union(polygons.begin(),
-                            polygons.end()));
+        std::vector<geom::Polygon*> polys;
+        polys.reserve(polygons.size());
+        for(const geom::Polygon* p : polygons) {
+            polys.push_back(const_cast<geom::Polygon*>(p));
+        }
+        unionPolygons.reset(CascadedPolygonUnion::Union(&polys, numThreads));
     }
 
     /**
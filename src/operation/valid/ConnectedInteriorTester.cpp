@@ -41,6 +41,9 @@
 #include <geos/geomgraph/PlanarGraph.h>
 #include <geos/geomgraph/EdgeRing.h>
 #include <geos/geomgraph/DirectedEdge.h>
+#include <geos/geomgraph/EdgeEndStar.h>
+#include <geos/geomgraph/Node.h>
+#include <geos/geomgraph/NodeMap.h>
 #include <geos/geomgraph/Position.h>
 #include <geos/geomgraph/Label.h>
 
@@ -262,8 +265,27 @@ ConnectedInteriorTester::visitInteriorRing(const LineString* ring, PlanarGraph&
      * Need special check since the first point may be repeated.
      */
     const Coordinate& pt1 = findDifferentPoint(pts, pt0);
-    Edge* e = graph.findEdgeInSameDirection(pt0, pt1);
-    DirectedEdge* de = static_cast<DirectedEdge*>(graph.findEdgeEnd(e));
+
+    /*
+     * The ring start is a node of the graph, so the edge is looked
+     * for among the edges leaving that node, rather than among all
+     * the edges of the graph.
+     */
+    DirectedEdge* de = nullptr;
+    if(Node* node = graph.getNodeMap()->find(pt0)) {
+        EdgeEndStar* star = node->getEdges();
+        for(EdgeEndStar::iterator it = star->begin(), itEnd = star->end();
+                it != itEnd; ++it) {
+            if((*it)->getDirectedCoordinate() == pt1) {
+                de = static_cast<DirectedEdge*>(*it);
+                break;
+            }
+        }
+    }
+    if(de == nullptr) {
+        Edge* e = graph.findEdgeInSameDirection(pt0, pt1);
+        de = static_cast<DirectedEdge*>(graph.findEdgeEnd(e));
+    }
     DirectedEdge* intDe = nullptr;
     if(de->getLabel().getLocation(0, Position::RIGHT) == Location::INTERIOR) {
         intDe = de;
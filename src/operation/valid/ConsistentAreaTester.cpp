@@ -20,6 +20,7 @@
 #include <geos/operation/valid/ConsistentAreaTester.h>
 #include <geos/algorithm/LineIntersector.h>
 #include <geos/geomgraph/GeometryGraph.h>
+#include <geos/geomgraph/NodeMap.h>
 #include <geos/geomgraph/EdgeEnd.h>
 #include <geos/geomgraph/EdgeEndStar.h>
 #include <geos/geomgraph/Edge.h>
@@ -87,8 +88,8 @@ ConsistentAreaTester::isNodeEdgeAreaLabelsConsistent()
 {
     assert(geomGraph);
 
-    map<Coordinate*, Node*, CoordinateLessThen>& nMap = nodeGraph.getNodeMap();
-    map<Coordinate*, Node*, CoordinateLessThen>::iterator nodeIt;
+    NodeMap& nMap = nodeGraph.getNodeMap();
+    NodeMap::iterator nodeIt;
     for(nodeIt = nMap.begin(); nodeIt != nMap.end(); nodeIt++) {
         relate::RelateNode* node = static_cast<relate::RelateNode*>(nodeIt->second);
         if(!node->getEdges()->isAreaLabelsConsistent(*geomGraph)) {
@@ -103,8 +104,8 @@ ConsistentAreaTester::isNodeEdgeAreaLabelsConsistent()
 bool
 ConsistentAreaTester::hasDuplicateRings()
 {
-    map<Coordinate*, Node*, CoordinateLessThen>& nMap = nodeGraph.getNodeMap();
-    map<Coordinate*, Node*, CoordinateLessThen>::iterator nodeIt;
+    NodeMap& nMap = nodeGraph.getNodeMap();
+    NodeMap::iterator nodeIt;
     for(nodeIt = nMap.begin(); nodeIt != nMap.end(); ++nodeIt) {
         assert(dynamic_cast<relate::RelateNode*>(nodeIt->second));
         relate::RelateNode* node = static_cast<relate::RelateNode*>(nodeIt->second);
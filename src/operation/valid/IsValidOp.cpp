@@ -38,16 +38,19 @@
 #include <geos/geomgraph/Edge.h>
 #include <geos/geomgraph/index/SegmentIntersector.h>
 #include <geos/index/chain/MonotoneChainSelectAction.h>
+#include <geos/index/strtree/PackedSTRtree.h>
 #include <geos/operation/valid/ConnectedInteriorTester.h>
 #include <geos/operation/valid/ConsistentAreaTester.h>
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/util/UnsupportedOperationException.h>
 
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <typeinfo>
 #include <set>
+#include <vector>
 
 using namespace std;
 using namespace geos::algorithm;
@@ -189,6 +192,7 @@ IsValidOp::checkValid(const LineString* g)
     }
 
     GeometryGraph graph(0, g);
+    graph.setNumThreads(numThreads);
     checkTooFewPoints(&graph);
 }
 
@@ -209,6 +213,7 @@ IsValidOp::checkValid(const LinearRing* g)
     }
 
     GeometryGraph graph(0, g);
+    graph.setNumThreads(numThreads);
     checkTooFewPoints(&graph);
     if(validErr != nullptr) {
         return;
@@ -237,6 +242,7 @@ IsValidOp::checkValid(const Polygon* g)
     }
 
     GeometryGraph graph(0, g);
+    graph.setNumThreads(numThreads);
 
     checkTooFewPoints(&graph);
     if(validErr != nullptr) {
@@ -291,6 +297,7 @@ IsValidOp::checkValid(const MultiPolygon* g)
     }
 
     GeometryGraph graph(0, g);
+    graph.setNumThreads(numThreads);
 
     checkTooFewPoints(&graph);
     if(validErr != nullptr) {
@@ -408,7 +415,7 @@ IsValidOp::checkNoSelfIntersectingRing(EdgeIntersectionList& eiList)
     EdgeIntersectionList::iterator it = eiList.begin();
     EdgeIntersectionList::iterator end = eiList.end();
     for(; it != end; ++it) {
-        EdgeIntersection* ei = *it;
+        EdgeIntersection* ei = &*it;
         if(isFirst) {
             isFirst = false;
             continue;
@@ -524,29 +531,45 @@ IsValidOp::checkHolesNotNested(const Polygon* p, GeometryGraph* graph)
 void
 IsValidOp::checkShellsNotNested(const MultiPolygon* mp, GeometryGraph* graph)
 {
-    for(size_t i = 0, ngeoms = mp->getNumGeometries(); i < ngeoms; ++i) {
+    size_t ngeoms = mp->getNumGeometries();
+    vector<const Polygon*> polys(ngeoms);
+
+    geos::index::strtree::PackedSTRtree tree;
+    for(size_t j = 0; j < ngeoms; ++j) {
         const Polygon* p = dynamic_cast<const Polygon*>(
-                               mp->getGeometryN(i));
+                               mp->getGeometryN(j));
         assert(p);
+        polys[j] = p;
+        if(! p->isEmpty()) {
+            tree.insertIndex(p->getEnvelopeInternal(), j);
+        }
+    }
+    tree.build();
 
+    vector<size_t> candidates;
+    for(size_t i = 0; i < ngeoms; ++i) {
         const LinearRing* shell = dynamic_cast<const LinearRing*>(
-                                      p->getExteriorRing());
+                                      polys[i]->getExteriorRing());
         assert(shell);
 
-        for(size_t j = 0; j < ngeoms; ++j) {
-            if(i == j) {
-                continue;
-            }
+        if(shell->isEmpty()) {
+            continue;
+        }
 
-            const Polygon* p2 = dynamic_cast<const Polygon*>(
-                                    mp->getGeometryN(j));
-            assert(p2);
+        // compare in the order of the polygons, so that the error
+        // reported is the first one found by a full scan
+        candidates.clear();
+        tree.queryIndex(*shell->getEnvelopeInternal(), [&candidates](size_t j) {
+            candidates.push_back(j);
+        });
+        sort(candidates.begin(), candidates.end());
 
-            if(shell->isEmpty() || p2->isEmpty()) {
+        for(size_t j : candidates) {
+            if(i == j) {
                 continue;
             }
 
-            checkShellNotNested(shell, p2, graph);
+            checkShellNotNested(shell, polys[j], graph);
 
             if(validErr != nullptr) {
                 return;
@@ -16,7 +16,8 @@
 #include <geos/planargraph/NodeMap.h>
 #include <geos/planargraph/Node.h>
 
-#include <map>
+#include <algorithm>
+#include <vector>
 
 using namespace std;
 
@@ -27,6 +28,9 @@ namespace planargraph {
  * Constructs a NodeMap without any Nodes.
  */
 NodeMap::NodeMap()
+    :
+    nSorted(0),
+    stale(false)
 {
 }
 
@@ -37,17 +41,49 @@ NodeMap::~NodeMap()
 NodeMap::container&
 NodeMap::getNodeMap()
 {
+    prepare();
     return nodeMap;
 }
 
+/*private*/
+void
+NodeMap::prepare() const
+{
+    if(stale) {
+        nodeMap.clear();
+        nodeIndex.forEach([this](Node* n) {
+            nodeMap.emplace_back(n->getCoordinate(), n);
+        });
+        nSorted = 0;
+        stale = false;
+    }
+    if(nSorted == nodeMap.size()) {
+        return;
+    }
+    // The nodes added since the last call are sorted on their own,
+    // then merged with the already sorted ones
+    geom::CoordinateLessThen lessThen;
+    auto byCoord = [&lessThen](const container::value_type & a,
+                               const container::value_type & b) {
+        return lessThen(a.first, b.first);
+    };
+    container::iterator mid = nodeMap.begin() +
+                              static_cast<container::difference_type>(nSorted);
+    std::sort(mid, nodeMap.end(), byCoord);
+    std::inplace_merge(nodeMap.begin(), mid, nodeMap.end(), byCoord);
+    nSorted = nodeMap.size();
+}
+
 /**
- * Adds a node to the map, replacing any that is already at that location.
- * @return the added node
+ * Adds a node to the map, unless there is already one at that location.
+ * @return the given node
  */
 Node*
 NodeMap::add(Node* n)
 {
-    nodeMap.insert(pair<geom::Coordinate, Node*>(n->getCoordinate(), n));
+    if(nodeIndex.insert(n->getCoordinate(), n).second && !stale) {
+        nodeMap.emplace_back(n->getCoordinate(), n);
+    }
     return n;
 }
 
@@ -59,7 +95,9 @@ Node*
 NodeMap::remove(geom::Coordinate& pt)
 {
     Node* n = find(pt);
-    nodeMap.erase(pt);
+    if(nodeIndex.erase(pt)) {
+        stale = true;
+    }
     return n;
 }
 
@@ -67,7 +105,8 @@ NodeMap::remove(geom::Coordinate& pt)
 void
 NodeMap::getNodes(vector<Node*>& values)
 {
-    NodeMap::container::iterator it = nodeMap.begin(), itE = nodeMap.end();
+    NodeMap::container::iterator it = begin(), itE = end();
+    values.reserve(values.size() + size());
     while(it != itE) {
         values.push_back(it->second);
         ++it;
@@ -80,13 +119,8 @@ NodeMap::getNodes(vector<Node*>& values)
 Node*
 NodeMap::find(const geom::Coordinate& coord)
 {
-    container::iterator found = nodeMap.find(coord);
-    if(found == nodeMap.end()) {
-        return nullptr;
-    }
-    else {
-        return found->second;
-    }
+    Node** found = nodeIndex.find(coord);
+    return found ? *found : nullptr;
 }
 
 } //namespace planargraph
@@ -15,9 +15,12 @@
 #include <geos/util/Interrupt.h>
 #include <geos/util/GEOSException.h> // for inheritance
 
+#include <atomic>
+
 namespace {
 /* Could these be portably stored in thread-specific space ? */
-bool requested = false;
+// atomic, as the worker threads of util::runChunks check it
+std::atomic<bool> requested(false);
 
 geos::util::Interrupt::Callback* callback = nullptr;
 }
@@ -63,8 +66,7 @@ Interrupt::process()
     if(callback) {
         (*callback)();
     }
-    if(requested) {
-        requested = false;
+    if(requested.exchange(false)) {
         interrupt();
     }
 }
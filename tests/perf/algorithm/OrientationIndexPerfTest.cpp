@@ -0,0 +1,143 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Compares the cost of the extended-precision fallback of the
+ * orientation predicate, which is taken whenever the floating-point
+ * filter cannot decide, using ttmath and DoubleDouble arithmetic.
+ *
+ **********************************************************************/
+
+#include <geos/algorithm/CGAlgorithmsDD.h>
+#if defined(_MSC_VER) && defined(_WIN64) && !defined(TTMATH_NOASM)
+// the MSVC x64 assembler routines are only linked in with GEOS_ENABLE_TTMATH
+#define TTMATH_NOASM
+#endif
+// ttmath leaves its values uninitialized until assigned, which GCC
+// cannot always follow through the inlined arithmetic
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <geos/algorithm/ttmath/ttmath.h>
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#include <geos/math/DD.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/profiler.h>
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+using geos::algorithm::CGAlgorithmsDD;
+using geos::geom::Coordinate;
+using geos::math::DD;
+
+typedef ttmath::Big<TTMATH_BITS(32), TTMATH_BITS(128)> BigDD;
+
+static int
+orientationBig(const Coordinate& p1, const Coordinate& p2, const Coordinate& q)
+{
+    BigDD dx1 = BigDD(p2.x) + BigDD(-p1.x);
+    BigDD dy1 = BigDD(p2.y) + BigDD(-p1.y);
+    BigDD dx2 = BigDD(q.x) + BigDD(-p2.x);
+    BigDD dy2 = BigDD(q.y) + BigDD(-p2.y);
+    BigDD d = dx1 * dy2 - dy1 * dx2;
+    static BigDD const zero(0.0);
+    if(d < zero) {
+        return -1;
+    }
+    if(d > zero) {
+        return 1;
+    }
+    return 0;
+}
+
+static int
+orientationDD(const Coordinate& p1, const Coordinate& p2, const Coordinate& q)
+{
+    DD dx1 = DD::twoSum(p2.x, -p1.x);
+    DD dy1 = DD::twoSum(p2.y, -p1.y);
+    DD dx2 = DD::twoSum(q.x, -p2.x);
+    DD dy2 = DD::twoSum(q.y, -p2.y);
+    return DD::signOfDet2x2(dx1, dy1, dx2, dy2);
+}
+
+class OrientationIndexPerfTest {
+public:
+
+    OrientationIndexPerfTest(std::size_t n)
+    {
+        // Points lying (up to rounding) on a common line, so that the
+        // floating-point filter fails and the robust fallback is taken.
+        std::mt19937 gen(12345);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        Coordinate p1(-1234.5678, 9876.5432);
+        Coordinate p2(8765.4321, -3210.1234);
+        for(std::size_t i = 0; i < n; i++) {
+            double t = dist(gen);
+            pts.emplace_back(p1.x + t * (p2.x - p1.x), p1.y + t * (p2.y - p1.y));
+        }
+        a = p1;
+        b = p2;
+    }
+
+    template<typename F>
+    void
+    run(const char* name, F orient)
+    {
+        geos::util::Profile sw(name);
+        long sum = 0;
+        sw.start();
+        for(int iter = 0; iter < MAX_ITER; iter++) {
+            for(const Coordinate& q : pts) {
+                sum += orient(a, b, q);
+            }
+        }
+        sw.stop();
+        std::cout << name << ": " << sw.getTot() << " usecs"
+                  << " (checksum " << sum << ")" << std::endl;
+    }
+
+    void
+    test()
+    {
+        std::size_t nFiltered = 0;
+        for(const Coordinate& q : pts) {
+            if(CGAlgorithmsDD::orientationIndexFilter(a, b, q) > 1) {
+                nFiltered++;
+            }
+        }
+        std::cout << pts.size() << " near-collinear points, "
+                  << nFiltered << " not decided by the filter" << std::endl;
+
+        run("ttmath", orientationBig);
+        run("DoubleDouble", orientationDD);
+        run("CGAlgorithmsDD::orientationIndex", CGAlgorithmsDD::orientationIndex);
+    }
+
+private:
+
+    static const int MAX_ITER = 10;
+
+    std::vector<Coordinate> pts;
+    Coordinate a;
+    Coordinate b;
+};
+
+int
+main()
+{
+    OrientationIndexPerfTest tester(100000);
+    tester.test();
+}
@@ -0,0 +1,126 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Reports how CascadedPolygonUnion scales with the number of threads,
+ * on a grid of overlapping circles.
+ *
+ * Usage: perf_cascaded_polygon_union [maxThreads [gridSize]]
+ *
+ **********************************************************************/
+
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Polygon.h>
+#include <geos/operation/union/CascadedPolygonUnion.h>
+#include <geos/util/GeometricShapeFactory.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace geos::geom;
+using geos::operation::geounion::CascadedPolygonUnion;
+using namespace std;
+
+class CascadedPolygonUnionPerfTest {
+public:
+    CascadedPolygonUnionPerfTest()
+        :
+        pm(),
+        fact(GeometryFactory::create(&pm, 0))
+    {}
+
+    ~CascadedPolygonUnionPerfTest()
+    {
+        for(Polygon* p : polys) {
+            delete p;
+        }
+    }
+
+    void
+    createCircles(int gridSize)
+    {
+        geos::util::GeometricShapeFactory gsf(fact.get());
+        gsf.setNumPoints(NUM_CIRCLE_PTS);
+        gsf.setSize(1.5);
+
+        // each circle overlaps its neighbours, with a little jitter so
+        // that the intersection points are not all alike
+        for(int i = 0; i < gridSize; i++) {
+            for(int j = 0; j < gridSize; j++) {
+                double jitter = ((i * 31 + j * 17) % 10) * 0.01;
+                gsf.setCentre(Coordinate(i + jitter, j - jitter));
+                polys.push_back(gsf.createCircle());
+            }
+        }
+    }
+
+    void
+    run(unsigned int maxThreads)
+    {
+        cout << polys.size() << " polygons" << endl;
+
+        unique_ptr<Geometry> serial;
+        double serialTime = 0;
+        for(unsigned int n = 1; n <= maxThreads; n *= 2) {
+            geos::util::Profile sw("union");
+            sw.start();
+            unique_ptr<Geometry> result(CascadedPolygonUnion::Union(&polys, n));
+            sw.stop();
+
+            bool same = true;
+            if(n == 1) {
+                serial = std::move(result);
+                serialTime = sw.getTot();
+            }
+            else {
+                same = result->equalsExact(serial.get());
+            }
+
+            cout << n << " threads: " << sw.getTot() << " usecs"
+                 << ", speedup " << serialTime / sw.getTot()
+                 << (same ? "" : " (RESULT DIFFERS FROM SERIAL)")
+                 << endl;
+        }
+    }
+
+private:
+
+    static const int NUM_CIRCLE_PTS = 64;
+
+    PrecisionModel pm;
+    GeometryFactory::Ptr fact;
+    vector<Polygon*> polys;
+};
+
+int
+main(int argc, char** argv)
+{
+    unsigned int maxThreads = std::thread::hardware_concurrency();
+    int gridSize = 100;
+    if(argc > 1) {
+        maxThreads = static_cast<unsigned int>(atoi(argv[1]));
+    }
+    if(argc > 2) {
+        gridSize = atoi(argv[2]);
+    }
+    if(maxThreads < 1) {
+        maxThreads = 1;
+    }
+
+    CascadedPolygonUnionPerfTest tester;
+    tester.createCircles(gridSize);
+    tester.run(maxThreads);
+}
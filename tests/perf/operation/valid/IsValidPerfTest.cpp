@@ -0,0 +1,118 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Reports how IsValidOp scales with the number of parts of a
+ * MultiPolygon, on grids of square polygons, one in four of which has
+ * a hole holding an island.
+ *
+ * Usage: perf_isvalid [maxGridSize]
+ *
+ **********************************************************************/
+
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/operation/valid/IsValidOp.h>
+#include <geos/profiler.h>
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+using namespace geos::geom;
+using geos::operation::valid::IsValidOp;
+using namespace std;
+
+class IsValidPerfTest {
+public:
+    IsValidPerfTest()
+        :
+        pm(),
+        fact(GeometryFactory::create(&pm, 0))
+    {}
+
+    void
+    run(int maxGridSize)
+    {
+        for(int gridSize = 25; gridSize <= maxGridSize; gridSize *= 2) {
+            unique_ptr<Geometry> mp(createGrid(gridSize));
+
+            geos::util::Profile sw("isValid");
+            sw.start();
+            bool valid = IsValidOp(mp.get()).isValid();
+            sw.stop();
+
+            cout << mp->getNumGeometries() << " polygons: "
+                 << sw.getTot() << " usecs"
+                 << (valid ? "" : " (INVALID)")
+                 << endl;
+        }
+    }
+
+private:
+
+    PrecisionModel pm;
+    GeometryFactory::Ptr fact;
+
+    LinearRing*
+    createSquare(double x, double y, double size) const
+    {
+        CoordinateArraySequence* cs = new CoordinateArraySequence();
+        cs->add(Coordinate(x, y));
+        cs->add(Coordinate(x, y + size));
+        cs->add(Coordinate(x + size, y + size));
+        cs->add(Coordinate(x + size, y));
+        cs->add(Coordinate(x, y));
+        return fact->createLinearRing(cs);
+    }
+
+    Geometry*
+    createGrid(int gridSize) const
+    {
+        // unit squares with a gap between them; every fourth one
+        // has a hole, with an island polygon inside the hole
+        vector<Geometry*>* polys = new vector<Geometry*>();
+        for(int i = 0; i < gridSize; i++) {
+            for(int j = 0; j < gridSize; j++) {
+                double x = i * 1.5;
+                double y = j * 1.5;
+                LinearRing* shell = createSquare(x, y, 1.0);
+                if((i + j) % 4 != 0) {
+                    polys->push_back(fact->createPolygon(shell, nullptr));
+                    continue;
+                }
+                vector<Geometry*>* holes = new vector<Geometry*>();
+                holes->push_back(createSquare(x + 0.2, y + 0.2, 0.6));
+                polys->push_back(fact->createPolygon(shell, holes));
+                polys->push_back(fact->createPolygon(
+                                     createSquare(x + 0.4, y + 0.4, 0.2), nullptr));
+            }
+        }
+        return fact->createMultiPolygon(polys);
+    }
+};
+
+int
+main(int argc, char** argv)
+{
+    int maxGridSize = 200;
+    if(argc > 1) {
+        maxGridSize = atoi(argv[1]);
+    }
+
+    IsValidPerfTest tester;
+    tester.run(maxGridSize);
+}
@@ -0,0 +1,281 @@
+/************************************************************************
+ *
+ *
+ * Multithreaded test of a single prepared geometry shared by all
+ * threads, using the C-Wrapper of GEOS library
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ ***********************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "geos_c.h"
+
+#define NUM_THREADS 8
+#define NUM_ROUNDS 2
+#define RING_POINTS 2000
+#define GRID_SIZE 10
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+enum { PRED_INTERSECTS, PRED_CONTAINS, PRED_COVERS, NUM_PREDS };
+
+typedef struct {
+	int nqueries;
+	GEOSGeometry **queries;          /* owned by the main thread */
+	char *expected;                  /* nqueries * NUM_PREDS results */
+	const GEOSPreparedGeometry *prep;
+	int polygonal;                   /* only intersects for lines */
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	int started;
+} shared_data;
+
+typedef struct {
+	shared_data *shared;
+	int offset;
+	int errors;
+} thread_data;
+
+static void
+notice(const char *fmt, ...)
+{
+	(void)fmt;
+}
+
+static GEOSGeometry *
+createRing(GEOSContextHandle_t h, double cx, double cy,
+           double r1, double r2, unsigned int npoints, int ccw)
+{
+	GEOSCoordSequence *cs = GEOSCoordSeq_create_r(h, npoints + 1, 2);
+	unsigned int i;
+	for (i = 0; i <= npoints; i++) {
+		unsigned int j = i % npoints;
+		double a = 2 * M_PI * j / npoints * (ccw ? 1 : -1);
+		double r = (j % 2) ? r2 : r1;
+		GEOSCoordSeq_setX_r(h, cs, i, cx + r * cos(a));
+		GEOSCoordSeq_setY_r(h, cs, i, cy + r * sin(a));
+	}
+	return GEOSGeom_createLinearRing_r(h, cs);
+}
+
+/* A star-shaped polygon with a hole */
+static GEOSGeometry *
+createTarget(GEOSContextHandle_t h)
+{
+	GEOSGeometry *shell = createRing(h, 0, 0, 100, 90, RING_POINTS, 1);
+	GEOSGeometry *hole = createRing(h, 10, 10, 30, 25, RING_POINTS / 10, 0);
+	return GEOSGeom_createPolygon_r(h, shell, &hole, 1);
+}
+
+static GEOSGeometry *
+createPoint(GEOSContextHandle_t h, double x, double y)
+{
+	GEOSCoordSequence *cs = GEOSCoordSeq_create_r(h, 1, 2);
+	GEOSCoordSeq_setX_r(h, cs, 0, x);
+	GEOSCoordSeq_setY_r(h, cs, 0, y);
+	return GEOSGeom_createPoint_r(h, cs);
+}
+
+static GEOSGeometry *
+createLine(GEOSContextHandle_t h, double x, double y, double dx, double dy)
+{
+	GEOSCoordSequence *cs = GEOSCoordSeq_create_r(h, 2, 2);
+	GEOSCoordSeq_setX_r(h, cs, 0, x);
+	GEOSCoordSeq_setY_r(h, cs, 0, y);
+	GEOSCoordSeq_setX_r(h, cs, 1, x + dx);
+	GEOSCoordSeq_setY_r(h, cs, 1, y + dy);
+	return GEOSGeom_createLineString_r(h, cs);
+}
+
+static char
+evalPrepared(GEOSContextHandle_t h, const GEOSPreparedGeometry *prep,
+             int pred, const GEOSGeometry *g)
+{
+	switch (pred) {
+	case PRED_INTERSECTS:
+		return GEOSPreparedIntersects_r(h, prep, g);
+	case PRED_CONTAINS:
+		return GEOSPreparedContains_r(h, prep, g);
+	default:
+		return GEOSPreparedCovers_r(h, prep, g);
+	}
+}
+
+static char
+evalPlain(GEOSContextHandle_t h, const GEOSGeometry *target,
+          int pred, const GEOSGeometry *g)
+{
+	switch (pred) {
+	case PRED_INTERSECTS:
+		return GEOSIntersects_r(h, target, g);
+	case PRED_CONTAINS:
+		return GEOSContains_r(h, target, g);
+	default:
+		return GEOSCovers_r(h, target, g);
+	}
+}
+
+static void *
+worker(void *arg)
+{
+	thread_data *td = (thread_data *)arg;
+	shared_data *sd = td->shared;
+	GEOSContextHandle_t h = GEOS_init_r();
+	GEOSGeometry **queries;
+	int i, k, npreds;
+
+	GEOSContext_setNoticeHandler_r(h, notice);
+	GEOSContext_setErrorHandler_r(h, notice);
+
+	/* each thread queries its own copies of the test geometries */
+	queries = malloc(sizeof(GEOSGeometry *) * (size_t)sd->nqueries);
+	for (i = 0; i < sd->nqueries; i++) {
+		queries[i] = GEOSGeom_clone_r(h, sd->queries[i]);
+	}
+
+	/* start all together, so that the first queries race */
+	pthread_mutex_lock(&sd->mutex);
+	while (! sd->started) {
+		pthread_cond_wait(&sd->cond, &sd->mutex);
+	}
+	pthread_mutex_unlock(&sd->mutex);
+
+	npreds = sd->polygonal ? NUM_PREDS : 1;
+	for (k = 0; k < sd->nqueries; k++) {
+		int q = (k + td->offset) % sd->nqueries;
+		int pred;
+		for (pred = 0; pred < npreds; pred++) {
+			char r = evalPrepared(h, sd->prep, pred, queries[q]);
+			if (r != sd->expected[q * NUM_PREDS + pred]) {
+				td->errors++;
+			}
+		}
+	}
+
+	for (i = 0; i < sd->nqueries; i++) {
+		GEOSGeom_destroy_r(h, queries[i]);
+	}
+	free(queries);
+	GEOS_finish_r(h);
+	return NULL;
+}
+
+static int
+runRound(GEOSContextHandle_t h, shared_data *sd, const GEOSGeometry *target)
+{
+	pthread_t threads[NUM_THREADS];
+	thread_data td[NUM_THREADS];
+	int i, errors = 0;
+
+	/* a fresh prepared geometry, with nothing built yet */
+	sd->prep = GEOSPrepare_r(h, target);
+	sd->started = 0;
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		td[i].shared = sd;
+		td[i].offset = i * sd->nqueries / NUM_THREADS;
+		td[i].errors = 0;
+		if (pthread_create(&threads[i], NULL, worker, &td[i])) {
+			fprintf(stderr, "Failed to create thread\n");
+			exit(1);
+		}
+	}
+
+	pthread_mutex_lock(&sd->mutex);
+	sd->started = 1;
+	pthread_cond_broadcast(&sd->cond);
+	pthread_mutex_unlock(&sd->mutex);
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		pthread_join(threads[i], NULL);
+		errors += td[i].errors;
+	}
+
+	GEOSPreparedGeom_destroy_r(h, sd->prep);
+	return errors;
+}
+
+static int
+runTest(GEOSContextHandle_t h, shared_data *sd, const GEOSGeometry *target,
+        const char *name)
+{
+	int i, pred, round, errors = 0;
+	int npreds = sd->polygonal ? NUM_PREDS : 1;
+
+	for (i = 0; i < sd->nqueries; i++) {
+		for (pred = 0; pred < npreds; pred++) {
+			sd->expected[i * NUM_PREDS + pred] =
+				evalPlain(h, target, pred, sd->queries[i]);
+		}
+	}
+
+	for (round = 0; round < NUM_ROUNDS; round++) {
+		errors += runRound(h, sd, target);
+	}
+
+	printf("%s: %d threads x %d queries x %d rounds, %d wrong results\n",
+	       name, NUM_THREADS, sd->nqueries * npreds, NUM_ROUNDS, errors);
+	return errors;
+}
+
+int
+main()
+{
+	GEOSContextHandle_t h = GEOS_init_r();
+	shared_data sd;
+	GEOSGeometry *target;
+	GEOSGeometry *boundary;
+	int i, j, n = 0, errors = 0;
+
+	GEOSContext_setNoticeHandler_r(h, notice);
+	GEOSContext_setErrorHandler_r(h, notice);
+
+	sd.nqueries = GRID_SIZE * GRID_SIZE * 3;
+	sd.queries = malloc(sizeof(GEOSGeometry *) * (size_t)sd.nqueries);
+	sd.expected = malloc((size_t)sd.nqueries * NUM_PREDS);
+	pthread_mutex_init(&sd.mutex, NULL);
+	pthread_cond_init(&sd.cond, NULL);
+
+	/* points, short lines and small squares all over the target */
+	for (i = 0; i < GRID_SIZE; i++) {
+		for (j = 0; j < GRID_SIZE; j++) {
+			double x = -110 + 220.0 * i / (GRID_SIZE - 1);
+			double y = -110 + 220.0 * j / (GRID_SIZE - 1);
+			GEOSGeometry *line = createLine(h, x, y, 12, 5);
+			sd.queries[n++] = createPoint(h, x, y);
+			sd.queries[n++] = GEOSEnvelope_r(h, line);
+			sd.queries[n++] = line;
+		}
+	}
+
+	target = createTarget(h);
+	sd.polygonal = 1;
+	errors += runTest(h, &sd, target, "PreparedPolygon");
+
+	boundary = GEOSBoundary_r(h, target);
+	sd.polygonal = 0;
+	errors += runTest(h, &sd, boundary, "PreparedLineString");
+
+	for (i = 0; i < sd.nqueries; i++) {
+		GEOSGeom_destroy_r(h, sd.queries[i]);
+	}
+	free(sd.queries);
+	free(sd.expected);
+	GEOSGeom_destroy_r(h, boundary);
+	GEOSGeom_destroy_r(h, target);
+	pthread_mutex_destroy(&sd.mutex);
+	pthread_cond_destroy(&sd.cond);
+	GEOS_finish_r(h);
+
+	return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -11,6 +11,7 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h> // required for use in unique_ptr
 #include <geos/geom/Coordinate.h>
+#include <geos/util/IllegalArgumentException.h>
 // std
 #include <cmath>
 #include <sstream>
@@ -132,4 +133,61 @@ void object::test<4>
     runTest("LINESTRING (0 0, 100 0)", "LINESTRING (0 0, 50 50, 100 0)", 0.5, 50.0);
 }
 
+// 5 - The first points are coupled too
+template<>
+template<>
+void object::test<5>
+()
+{
+    runTest("LINESTRING (0 5, 1 0, 2 0)", "LINESTRING (0 0, 1 0, 2 0)", 5.0);
+    runTest("LINESTRING (0 0, 1 0, 2 0)", "LINESTRING (0 0, 1 0, 2 0, 3 0, 4 0, 5 0, 6 0)", 4.0);
+}
+
+// 6 - isWithinDistance
+template<>
+template<>
+void object::test<6>
+()
+{
+    GeomPtr g1(reader.read("LINESTRING (0 0, 100 0)"));
+    GeomPtr g2(reader.read("LINESTRING (0 0, 50 50, 100 0)"));
+
+    ensure(DiscreteFrechetDistance::isWithinDistance(*g1, *g2, 70.8));
+    ensure(!DiscreteFrechetDistance::isWithinDistance(*g1, *g2, 70.7));
+    ensure(DiscreteFrechetDistance::isWithinDistance(*g1, *g2, 50.0, 0.5));
+    ensure(!DiscreteFrechetDistance::isWithinDistance(*g1, *g2, 49.9, 0.5));
+    // abandoned at the row of the top of g2
+    ensure(DiscreteFrechetDistance::isWithinDistance(*g2, *g1, 50.5, 0.01));
+    ensure(!DiscreteFrechetDistance::isWithinDistance(*g2, *g1, 49.5, 0.01));
+}
+
+// 7 - Couplings restricted to a band
+template<>
+template<>
+void object::test<7>
+()
+{
+    // the best coupling waits for the hook at the start of g2
+    GeomPtr g1(reader.read("LINESTRING (0 0, 1 0, 2 0, 3 0, 4 0, 5 0, 6 0, 7 0, 8 0, 9 0, 10 0)"));
+    GeomPtr g2(reader.read("LINESTRING (0 0, 0 1, 0 0, 0 1, 0 0, 1 0, 2 0, 4 0, 6 0, 8 0, 10 0)"));
+
+    DiscreteFrechetDistance full(*g1, *g2);
+    ensure_distance(full.distance(), 1.0, TOLERANCE);
+
+    DiscreteFrechetDistance wide(*g1, *g2);
+    wide.setBandFraction(1.0);
+    ensure_distance(wide.distance(), 1.0, TOLERANCE);
+
+    DiscreteFrechetDistance narrow(*g1, *g2);
+    narrow.setBandFraction(0.1);
+    ensure_distance(narrow.distance(), 3.0, TOLERANCE);
+
+    try {
+        narrow.setBandFraction(0.0);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
 } // namespace tut
@@ -73,6 +73,41 @@ struct test_DiscreteHausdorffDistance_data {
         ensure(diff <= TOLERANCE);
     }
 
+    // Distance computed by the filters, over all the points of both geometries
+    double
+    filterDistance(const Geometry& g1, const Geometry& g2, double densifyFactor)
+    {
+        PointPairDistance ptDist;
+        for(int i = 0; i < 2; i++) {
+            const Geometry& discreteGeom = i ? g2 : g1;
+            const Geometry& geom = i ? g1 : g2;
+            DiscreteHausdorffDistance::MaxPointDistanceFilter distFilter(geom);
+            discreteGeom.apply_ro(&distFilter);
+            ptDist.setMaximum(distFilter.getMaxPointDistance());
+            if(densifyFactor > 0) {
+                DiscreteHausdorffDistance::MaxDensifiedByFractionDistanceFilter fracFilter(geom, densifyFactor);
+                discreteGeom.apply_ro(fracFilter);
+                ptDist.setMaximum(fracFilter.getMaxPointDistance());
+            }
+        }
+        return ptDist.getDistance();
+    }
+
+    // A wavy line of n points, vertically offset
+    std::string
+    waveLine(int n, double offset, double amplitude)
+    {
+        std::ostringstream wkt;
+        wkt.precision(17);
+        wkt << "LINESTRING (";
+        for(int i = 0; i < n; i++) {
+            wkt << (i ? ", " : "") << i << " "
+                << offset + amplitude * std::sin(i * 0.3) + 0.01 * std::cos(i * 7.0);
+        }
+        wkt << ")";
+        return wkt.str();
+    }
+
     PrecisionModel pm;
     GeometryFactory::Ptr gf;
     geos::io::WKTReader reader;
@@ -133,5 +168,52 @@ void object::test<4>
     runTest("LINESTRING (130 0, 0 0, 0 150)", "LINESTRING (10 10, 10 150, 130 10)", 0.5, 70.0);
 }
 
-} // namespace tut
+// 5 - Indexed geometries give the same distance as the filters
+template<>
+template<>
+void object::test<5>
+()
+{
+    GeomPtr g1(reader.read(waveLine(200, 0.0, 5.0)));
+    GeomPtr g2(reader.read(waveLine(150, 0.5, 4.0)));
+    GeomPtr g3(reader.read(
+                   "MULTIPOINT ((3 4), (50 -2), (120 7), (199 0), (80 1))"));
+    GeomPtr g4(reader.read(
+                   "POLYGON ((0 -10, 200 -10, 200 10, 0 10, 0 -10), (50 -1, 60 -1, 60 1, 50 1, 50 -1))"));
+
+    ensure_distance(DiscreteHausdorffDistance::distance(*g1, *g2),
+                  filterDistance(*g1, *g2, 0), TOLERANCE);
+    ensure_distance(DiscreteHausdorffDistance::distance(*g1, *g2, 0.1),
+                  filterDistance(*g1, *g2, 0.1), TOLERANCE);
+    ensure_distance(DiscreteHausdorffDistance::distance(*g1, *g4),
+                  filterDistance(*g1, *g4, 0), TOLERANCE);
+    ensure_distance(DiscreteHausdorffDistance::distance(*g3, *g1, 0.01),
+                  filterDistance(*g3, *g1, 0.01), TOLERANCE);
+}
 
+// 6 - isWithinDistance
+template<>
+template<>
+void object::test<6>
+()
+{
+    GeomPtr g1(reader.read("LINESTRING (130 0, 0 0, 0 150)"));
+    GeomPtr g2(reader.read("LINESTRING (10 10, 10 150, 130 10)"));
+    ensure(DiscreteHausdorffDistance::isWithinDistance(*g1, *g2, 14.15));
+    ensure(!DiscreteHausdorffDistance::isWithinDistance(*g1, *g2, 14.14));
+    ensure(DiscreteHausdorffDistance::isWithinDistance(*g1, *g2, 70.0, 0.5));
+    ensure(!DiscreteHausdorffDistance::isWithinDistance(*g1, *g2, 69.9, 0.5));
+
+    GeomPtr g3(reader.read(waveLine(200, 0.0, 5.0)));
+    GeomPtr g4(reader.read(waveLine(150, 0.5, 4.0)));
+    double d = DiscreteHausdorffDistance::distance(*g3, *g4);
+    ensure(DiscreteHausdorffDistance::isWithinDistance(*g3, *g4, d));
+    ensure(!DiscreteHausdorffDistance::isWithinDistance(*g3, *g4, d * 0.999));
+    ensure(!DiscreteHausdorffDistance::isWithinDistance(*g3, *g4, 1.0));
+
+    d = DiscreteHausdorffDistance::distance(*g3, *g4, 0.1);
+    ensure(DiscreteHausdorffDistance::isWithinDistance(*g3, *g4, d, 0.1));
+    ensure(!DiscreteHausdorffDistance::isWithinDistance(*g3, *g4, d * 0.999, 0.1));
+}
+
+} // namespace tut
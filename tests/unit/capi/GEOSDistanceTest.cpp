@@ -132,6 +132,43 @@ void object::test<2>
     GEOSGeom_destroy(g2);
 }
 
+/* GEOSDistanceWithin agrees with GEOSDistance around the distance */
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::srand(12345);
+
+    GEOSGeometry* g1 = random_polygon(-3, -8, 7, 1000);
+    GEOSGeometry* g2 = random_polygon(14, 22, 6, 500);
+
+    double dist;
+    ensure(GEOSDistance(g1, g2, &dist));
+
+    ensure_equals(GEOSDistanceWithin(g1, g2, dist), 1);
+    ensure_equals(GEOSDistanceWithin(g1, g2, dist * 1.01), 1);
+    ensure_equals(GEOSDistanceWithin(g1, g2, dist * 0.99), 0);
+    ensure_equals(GEOSDistanceWithin(g2, g1, dist), 1);
+    ensure_equals(GEOSDistanceWithin(g2, g1, dist * 0.99), 0);
+
+    GEOSGeom_destroy(g1);
+    GEOSGeom_destroy(g2);
+}
+
+template<>
+template<>
+void object::test<4>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))");
+    geom2_ = GEOSGeomFromWKT("LINESTRING(2 2, 8 8)");
+    geom3_ = GEOSGeomFromWKT("POINT EMPTY");
+
+    ensure_equals(GEOSDistanceWithin(geom1_, geom2_, 0), 1);
+    ensure_equals(GEOSDistanceWithin(geom2_, geom1_, 0), 1);
+    ensure_equals(GEOSDistanceWithin(geom1_, geom3_, 100), 0);
+}
 
 } // namespace tut
 
@@ -9,6 +9,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <memory>
+#include <string>
 #include <math.h>
 
 namespace tut {
@@ -97,4 +98,42 @@ void object::test<2>
     ensure_distance(dist, 50., 1e-12);
 }
 
+// Long tracks, with two rows of couplings at a time
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::string wkt1 = "LINESTRING (";
+    std::string wkt2 = "LINESTRING (";
+    for(int i = 0; i < 1000; i++) {
+        std::string x = std::to_string(i);
+        wkt1 += (i ? ", " : "") + x + " 0";
+        wkt2 += (i ? ", " : "") + x + " 1";
+    }
+    geom1_ = GEOSGeomFromWKT((wkt1 + ")").c_str());
+    geom2_ = GEOSGeomFromWKT((wkt2 + ")").c_str());
+
+    double dist;
+    int ret = GEOSFrechetDistanceDensify(geom1_, geom2_, 0.5, &dist);
+
+    ensure_equals(ret, 1);
+    ensure_distance(dist, 1., 1e-12);
+}
+
+// Empty inputs are an error
+template<>
+template<>
+void object::test<4>
+()
+{
+    geom1_ = GEOSGeomFromWKT("LINESTRING EMPTY");
+    geom2_ = GEOSGeomFromWKT("LINESTRING (0 0, 50 50, 100 0)");
+
+    double dist;
+    int ret = GEOSFrechetDistance(geom1_, geom2_, &dist);
+
+    ensure_equals(ret, 0);
+}
+
 } // namespace tut
@@ -392,5 +392,123 @@ void object::test<11>
         ensure_equals(ret, 0);
     }
 }
+
+// Test PreparedTouches, PreparedOverlaps and PreparedRelatePattern
+// on adjacent and overlapping polygons
+template<>
+template<>
+void object::test<12>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))");
+    prepGeom1_ = GEOSPrepare(geom1_);
+    ensure(nullptr != prepGeom1_);
+
+    geom2_ = GEOSGeomFromWKT("POLYGON((10 0, 20 0, 20 10, 10 10, 10 0))");
+    ensure_equals(GEOSPreparedTouches(prepGeom1_, geom2_), 1);
+    ensure_equals(GEOSPreparedOverlaps(prepGeom1_, geom2_), 0);
+    ensure_equals(GEOSPreparedRelatePattern(prepGeom1_, geom2_, "FF2F11212"), 1);
+    GEOSGeom_destroy(geom2_);
+
+    geom2_ = GEOSGeomFromWKT("POLYGON((5 5, 15 5, 15 15, 5 15, 5 5))");
+    ensure_equals(GEOSPreparedTouches(prepGeom1_, geom2_), 0);
+    ensure_equals(GEOSPreparedOverlaps(prepGeom1_, geom2_), 1);
+    ensure_equals(GEOSPreparedRelatePattern(prepGeom1_, geom2_, "212101212"), 1);
+    ensure_equals(GEOSPreparedRelatePattern(prepGeom1_, geom2_, "T*T***T**"), 1);
+    ensure_equals(GEOSPreparedRelatePattern(prepGeom1_, geom2_, "T*F**F***"), 0);
+    GEOSGeom_destroy(geom2_);
+
+    geom2_ = GEOSGeomFromWKT("LINESTRING(5 5, 15 5)");
+    ensure_equals(GEOSPreparedCrosses(prepGeom1_, geom2_), 1);
+    ensure_equals(GEOSPreparedTouches(prepGeom1_, geom2_), 0);
+}
+
+// Distance, nearest points and within-distance against a prepared polygon
+template<>
+template<>
+void object::test<13>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2))");
+    prepGeom1_ = GEOSPrepare(geom1_);
+    ensure(nullptr != prepGeom1_);
+
+    double dist;
+    geom2_ = GEOSGeomFromWKT("LINESTRING(13 5, 20 5)");
+    ensure_equals(GEOSPreparedDistance(prepGeom1_, geom2_, &dist), 1);
+    ensure_equals(dist, 3);
+    ensure_equals(GEOSPreparedDistanceWithin(prepGeom1_, geom2_, 3), 1);
+    ensure_equals(GEOSPreparedDistanceWithin(prepGeom1_, geom2_, 2.9), 0);
+
+    GEOSCoordSequence* cs = GEOSPreparedNearestPoints(prepGeom1_, geom2_);
+    ensure(nullptr != cs);
+    double x, y;
+    GEOSCoordSeq_getX(cs, 0, &x);
+    GEOSCoordSeq_getY(cs, 0, &y);
+    ensure_equals(x, 10);
+    ensure_equals(y, 5);
+    GEOSCoordSeq_getX(cs, 1, &x);
+    GEOSCoordSeq_getY(cs, 1, &y);
+    ensure_equals(x, 13);
+    ensure_equals(y, 5);
+    GEOSCoordSeq_destroy(cs);
+    GEOSGeom_destroy(geom2_);
+
+    // in the hole
+    geom2_ = GEOSGeomFromWKT("POINT(5 4)");
+    ensure_equals(GEOSPreparedDistance(prepGeom1_, geom2_, &dist), 1);
+    ensure_equals(dist, 2);
+    GEOSGeom_destroy(geom2_);
+
+    // inside the polygon, away from its boundary
+    geom2_ = GEOSGeomFromWKT("POINT(1 5)");
+    ensure_equals(GEOSPreparedDistance(prepGeom1_, geom2_, &dist), 1);
+    ensure_equals(dist, 0);
+    ensure_equals(GEOSPreparedDistanceWithin(prepGeom1_, geom2_, 0), 1);
+    cs = GEOSPreparedNearestPoints(prepGeom1_, geom2_);
+    ensure(nullptr != cs);
+    GEOSCoordSeq_getX(cs, 0, &x);
+    GEOSCoordSeq_getY(cs, 0, &y);
+    ensure_equals(x, 1);
+    ensure_equals(y, 5);
+    GEOSCoordSeq_destroy(cs);
+    GEOSGeom_destroy(geom2_);
+
+    // around the polygon
+    geom2_ = GEOSGeomFromWKT("POLYGON((-5 -5, 15 -5, 15 15, -5 15, -5 -5))");
+    ensure_equals(GEOSPreparedDistance(prepGeom1_, geom2_, &dist), 1);
+    ensure_equals(dist, 0);
+    ensure_equals(GEOSPreparedDistanceWithin(prepGeom1_, geom2_, 0), 1);
+    GEOSGeom_destroy(geom2_);
+
+    geom2_ = GEOSGeomFromWKT("POINT EMPTY");
+    ensure_equals(GEOSPreparedDistanceWithin(prepGeom1_, geom2_, 100), 0);
+    ensure(nullptr == GEOSPreparedNearestPoints(prepGeom1_, geom2_));
+}
+
+// Distance against a prepared line, reusing its facet index
+template<>
+template<>
+void object::test<14>
+()
+{
+    geom1_ = GEOSGeomFromWKT("LINESTRING(0 0, 10 0, 10 10, 20 10, 20 0, 30 0)");
+    prepGeom1_ = GEOSPrepare(geom1_);
+    ensure(nullptr != prepGeom1_);
+
+    for(int i = 0; i < 30; i++) {
+        char wkt[64];
+        std::snprintf(wkt, sizeof(wkt), "POINT(%g 5)", i + 0.5);
+        GEOSGeometry* pt = GEOSGeomFromWKT(wkt);
+        double dist, expected;
+        ensure_equals(GEOSPreparedDistance(prepGeom1_, pt, &dist), 1);
+        ensure_equals(GEOSDistance(geom1_, pt, &expected), 1);
+        ensure_equals(dist, expected);
+        ensure_equals(GEOSPreparedDistanceWithin(prepGeom1_, pt, 4.5),
+                      expected <= 4.5 ? 1 : 0);
+        GEOSGeom_destroy(pt);
+    }
+}
+
 } // namespace tut
 
@@ -5,10 +5,12 @@
 // geos
 #include <geos_c.h>
 // std
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
 #include <cmath>
+#include <vector>
 
 struct INTPOINT {
     INTPOINT(int p_x, int p_y) : x(p_x), y(p_y) {}
@@ -259,7 +261,122 @@ void object::test<7>
     GEOSSTRtree_destroy(tree);
 }
 
-} // namespace tut
+// GEOSSTRtree_queryBatch gives the same items as GEOSSTRtree_query
+template<>
+template<>
+void object::test<8>
+()
+{
+    GEOSSTRtree* tree = GEOSSTRtree_create(4);
+    std::vector<INTPOINT> points;
+    std::vector<GEOSGeometry*> geoms;
+    for(int i = 0; i < 50; i++) {
+        for(int j = 0; j < 50; j++) {
+            points.emplace_back(i, j);
+        }
+    }
+    for(auto& p : points) {
+        geoms.push_back(INTPOINT2GEOS(&p));
+        GEOSSTRtree_insert(tree, geoms.back(), &p);
+    }
+
+    // minx, miny, maxx, maxy
+    const double envelopes[] = {
+        0, 0, 2.5, 1.5,
+        100, 100, 101, 101,
+        10.5, 10.5, 20, 12,
+        -1, 49, 0, 60
+    };
+    const size_t numEnvelopes = 4;
+
+    for(unsigned int numThreads = 1; numThreads <= 4; numThreads++) {
+        size_t* offsets = nullptr;
+        void** items = nullptr;
+        ensure_equals(GEOSSTRtree_queryBatch(tree, envelopes, numEnvelopes,
+                                             numThreads, &offsets, &items), 1);
+
+        ensure_equals(offsets[0], 0u);
+        for(size_t i = 0; i < numEnvelopes; i++) {
+            const double* e = envelopes + 4 * i;
+            GEOSCoordSequence* seq = GEOSCoordSeq_create(2, 2);
+            GEOSCoordSeq_setX(seq, 0, e[0]);
+            GEOSCoordSeq_setY(seq, 0, e[1]);
+            GEOSCoordSeq_setX(seq, 1, e[2]);
+            GEOSCoordSeq_setY(seq, 1, e[3]);
+            GEOSGeometry* q = GEOSGeom_createLineString(seq);
+            std::vector<void*> expected;
+            GEOSSTRtree_query(tree, q, [](void* item, void* userdata) {
+                static_cast<std::vector<void*>*>(userdata)->push_back(item);
+            }, &expected);
+            GEOSGeom_destroy(q);
+
+            std::vector<void*> found(items + offsets[i], items + offsets[i + 1]);
+            ensure(found == expected);
+        }
+        ensure_equals(offsets[numEnvelopes], 27u);
+
+        GEOSFree(offsets);
+        GEOSFree(items);
+    }
+
+    for(auto g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+    GEOSSTRtree_destroy(tree);
+}
 
+// GEOSSTRtree_queryBatch with far more threads than queries or processors
+template<>
+template<>
+void object::test<9>
+()
+{
+    GEOSSTRtree* tree = GEOSSTRtree_create(10);
+    std::vector<INTPOINT> points;
+    std::vector<GEOSGeometry*> geoms;
+    for(int i = 0; i < 50; i++) {
+        for(int j = 0; j < 50; j++) {
+            points.emplace_back(i, j);
+        }
+    }
+    for(auto& p : points) {
+        geoms.push_back(INTPOINT2GEOS(&p));
+        GEOSSTRtree_insert(tree, geoms.back(), &p);
+    }
 
+    // one 3x3 envelope around each point
+    std::vector<double> envelopes;
+    for(const auto& p : points) {
+        envelopes.push_back(p.x - 1);
+        envelopes.push_back(p.y - 1);
+        envelopes.push_back(p.x + 1);
+        envelopes.push_back(p.y + 1);
+    }
+    const size_t numEnvelopes = points.size();
+
+    size_t* offsets1 = nullptr;
+    void** items1 = nullptr;
+    ensure_equals(GEOSSTRtree_queryBatch(tree, envelopes.data(), numEnvelopes,
+                                         1, &offsets1, &items1), 1);
+
+    size_t* offsetsN = nullptr;
+    void** itemsN = nullptr;
+    ensure_equals(GEOSSTRtree_queryBatch(tree, envelopes.data(), numEnvelopes,
+                                         1000000, &offsetsN, &itemsN), 1);
+
+    ensure(std::equal(offsets1, offsets1 + numEnvelopes + 1, offsetsN));
+    ensure(std::equal(items1, items1 + offsets1[numEnvelopes], itemsN));
+    // 9 points around the inner ones, fewer along the edges
+    ensure_equals(offsets1[numEnvelopes], 48u * 48u * 9u + 4u * 48u * 6u + 4u * 4u);
+
+    GEOSFree(offsets1);
+    GEOSFree(items1);
+    GEOSFree(offsetsN);
+    GEOSFree(itemsN);
+    for(auto g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+    GEOSSTRtree_destroy(tree);
+}
 
+} // namespace tut
@@ -231,5 +231,21 @@ void object::test<10>
 
     ensure_equals(toWKT(geom2_), std::string("GEOMETRYCOLLECTION EMPTY"));
 }
+// Union on several threads
+template<>
+template<>
+void object::test<11>
+()
+{
+    geom1_ = GEOSGeomFromWKT("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((5 5, 15 5, 15 15, 5 15, 5 5)), ((20 0, 30 0, 30 10, 20 10, 20 0)))");
+    ensure(nullptr != geom1_);
+
+    geom2_ = GEOSUnaryUnionThreaded(geom1_, 4);
+    ensure(nullptr != geom2_);
+
+    GEOSGeometry* expected = GEOSUnaryUnion(geom1_);
+    ensure_equals(toWKT(geom2_), toWKT(expected));
+    GEOSGeom_destroy(expected);
+}
 } // namespace tut
 
@@ -0,0 +1,104 @@
+//
+// Test Suite for geos::geom::CoordinateHashMap class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateHashMap.h>
+// std
+#include <cstddef>
+#include <set>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_coordinatehashmap_data {
+
+    typedef geos::geom::Coordinate Coordinate;
+    typedef geos::geom::CoordinateHashMap<int> Map;
+
+    test_coordinatehashmap_data() {}
+};
+
+typedef test_group<test_coordinatehashmap_data> group;
+typedef group::object object;
+
+group test_coordinatehashmap_group("geos::geom::CoordinateHashMap");
+
+//
+// Test Cases
+//
+
+// Test insert and find
+template<>
+template<>
+void object::test<1>
+()
+{
+    Map map;
+    ensure(map.empty());
+    ensure(map.find(Coordinate(0, 0)) == nullptr);
+
+    auto res = map.insert(Coordinate(1, 2), 12);
+    ensure(res.second);
+    ensure_equals(*res.first, 12);
+
+    // an existing value is kept
+    res = map.insert(Coordinate(1, 2, 5), 99);
+    ensure(!res.second);
+    ensure_equals(*res.first, 12);
+    ensure_equals(map.size(), 1u);
+
+    // -0.0 and 0.0 are the same ordinate
+    map.insert(Coordinate(0, -0.0), 0);
+    ensure(map.find(Coordinate(-0.0, 0)) != nullptr);
+
+    ensure(map.find(Coordinate(2, 1)) == nullptr);
+    ensure_equals(*map.find(Coordinate(1, 2)), 12);
+}
+
+// Test growing and erasing, keeping every other key reachable
+template<>
+template<>
+void object::test<2>
+()
+{
+    Map map;
+    const int n = 1000;
+    for(int i = 0; i < n; i++) {
+        map.insert(Coordinate(i % 37, i / 37), i);
+    }
+    ensure_equals(map.size(), std::size_t(n));
+
+    for(int i = 0; i < n; i += 3) {
+        ensure(map.erase(Coordinate(i % 37, i / 37)));
+    }
+    ensure(!map.erase(Coordinate(0, 0)));
+
+    std::size_t found = 0;
+    for(int i = 0; i < n; i++) {
+        const int* v = map.find(Coordinate(i % 37, i / 37));
+        if(i % 3 == 0) {
+            ensure(v == nullptr);
+        }
+        else {
+            ensure(v != nullptr);
+            ensure_equals(*v, i);
+            found++;
+        }
+    }
+    ensure_equals(map.size(), found);
+
+    std::set<int> values;
+    map.forEach([&values](int v) {
+        values.insert(v);
+    });
+    ensure_equals(values.size(), found);
+}
+
+} // namespace tut
+
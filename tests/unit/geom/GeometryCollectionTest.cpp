@@ -3,6 +3,10 @@
 
 #include <tut/tut.hpp>
 #include <utility.h>
+// std
+#include <memory>
+#include <thread>
+#include <vector>
 
 
 namespace tut {
@@ -79,4 +83,38 @@ void object::test<2>
     gf->destroyGeometry(geom_col);
     gf->destroyGeometry(clone);
 }
+// Envelopes computed from several threads at once
+template<>
+template<>
+void object::test<3>
+()
+{
+    for(int round = 0; round < 20; round++) {
+        std::vector<GeometryPtr> lines;
+        for(int i = 0; i < 100; i++) {
+            auto cs = new geos::geom::CoordinateArraySequence();
+            cs->add(geos::geom::Coordinate(i, 0));
+            cs->add(geos::geom::Coordinate(i + 1, i));
+            lines.push_back(factory_->createLineString(cs));
+        }
+        std::unique_ptr<geos::geom::GeometryCollection> col(
+            factory_->createGeometryCollection(new std::vector<GeometryPtr>(lines)));
+
+        std::vector<geos::geom::Envelope> found(4);
+        std::vector<std::thread> threads;
+        for(std::size_t t = 0; t < found.size(); t++) {
+            threads.emplace_back([&col, &found, t]() {
+                found[t] = *col->getEnvelopeInternal();
+            });
+        }
+        for(auto& th : threads) {
+            th.join();
+        }
+
+        for(const auto& env : found) {
+            ensure(env == geos::geom::Envelope(0, 100, 0, 99));
+        }
+    }
+}
+
 } // namespace tut
@@ -0,0 +1,220 @@
+//
+// Test Suite for geos::geom::PackedCoordinateSequence class.
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/PackedCoordinateSequence.h>
+#include <geos/geom/PackedCoordinateSequenceFactory.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/algorithm/Area.h>
+#include <geos/algorithm/Length.h>
+#include <geos/index/chain/MonotoneChain.h>
+#include <geos/index/chain/MonotoneChainBuilder.h>
+// std
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using geos::geom::Coordinate;
+using geos::geom::CoordinateArraySequence;
+using geos::geom::CoordinateSequence;
+using geos::geom::PackedCoordinateSequence;
+using geos::geom::PackedCoordinateSequenceFactory;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_packedcoordinatesequence_data {
+    CoordinateArraySequence ring;
+
+    test_packedcoordinatesequence_data()
+    {
+        ring.add(Coordinate(0, 0, 1));
+        ring.add(Coordinate(10, 0, 2));
+        ring.add(Coordinate(10, 10, 3));
+        ring.add(Coordinate(5, 12, 4));
+        ring.add(Coordinate(0, 10, 5));
+        ring.add(Coordinate(0, 0, 1));
+    }
+};
+
+typedef test_group<test_packedcoordinatesequence_data> group;
+typedef group::object object;
+
+group test_packedcoordinatesequence_group("geos::geom::PackedCoordinateSequence");
+
+//
+// Test Cases
+//
+
+// Two-dimensional storage drops Z
+template<>
+template<>
+void object::test<1>
+()
+{
+    PackedCoordinateSequence seq(ring, 2);
+    ensure_equals(seq.size(), ring.size());
+    ensure_equals(seq.getDimension(), 2u);
+    ensure_equals(seq.data()[2], 10.0);
+    ensure_equals(seq.data()[3], 0.0);
+
+    Coordinate c;
+    seq.getAt(3, c);
+    ensure(c.equals2D(Coordinate(5, 12)));
+    ensure(std::isnan(c.z));
+    ensure(std::isnan(seq.getOrdinate(3, CoordinateSequence::Z)));
+    ensure_equals(seq.getX(3), 5.0);
+    ensure_equals(seq.getY(3), 12.0);
+}
+
+// Three-dimensional storage keeps Z
+template<>
+template<>
+void object::test<2>
+()
+{
+    PackedCoordinateSequence seq(ring, 3);
+    ensure_equals(seq.getDimension(), 3u);
+    ensure_equals(seq.getAt(3).z, 4.0);
+    ensure_equals(seq.getOrdinate(2, CoordinateSequence::Z), 3.0);
+    ensure(CoordinateSequence::equals(&seq, &ring));
+}
+
+// Reference accessors are refreshed after modification
+template<>
+template<>
+void object::test<3>
+()
+{
+    PackedCoordinateSequence seq(ring, 2);
+    const std::vector<Coordinate>* v = seq.toVector();
+    ensure_equals(v->size(), ring.size());
+
+    seq.setAt(Coordinate(1, 2), 1);
+    ensure(seq.getAt(1).equals2D(Coordinate(1, 2)));
+
+    seq.setOrdinate(1, CoordinateSequence::X, 3.0);
+    ensure_equals(seq.getAt(1).x, 3.0);
+
+    seq.add(Coordinate(7, 7));
+    ensure_equals(seq.size(), ring.size() + 1);
+    ensure(seq.back().equals2D(Coordinate(7, 7)));
+
+    seq.deleteAt(0);
+    ensure(seq.front().equals2D(Coordinate(3, 2)));
+}
+
+// add() and removeRepeatedPoints() skip 2D-equal neighbours
+template<>
+template<>
+void object::test<4>
+()
+{
+    PackedCoordinateSequence seq(0, 2);
+    seq.add(Coordinate(0, 0), false);
+    seq.add(Coordinate(0, 0), false);
+    seq.add(Coordinate(1, 0), true);
+    seq.add(Coordinate(1, 0), true);
+    seq.add(Coordinate(2, 0), true);
+    ensure_equals(seq.size(), 4u);
+    ensure(seq.hasRepeatedPoints());
+
+    seq.removeRepeatedPoints();
+    ensure_equals(seq.size(), 3u);
+    ensure(! seq.hasRepeatedPoints());
+    ensure_equals(seq.getX(2), 2.0);
+}
+
+// Kernels give the same results as for CoordinateArraySequence
+template<>
+template<>
+void object::test<5>
+()
+{
+    using geos::algorithm::Area;
+    using geos::algorithm::Length;
+    using geos::index::chain::MonotoneChainBuilder;
+
+    for(std::size_t dim = 2; dim <= 3; ++dim) {
+        PackedCoordinateSequence seq(ring, dim);
+
+        ensure_equals(Length::ofLine(&seq), Length::ofLine(&ring));
+        ensure_equals(Area::ofRingSigned(&seq), Area::ofRingSigned(&ring));
+
+        geos::geom::Envelope e1, e2;
+        seq.expandEnvelope(e1);
+        ring.expandEnvelope(e2);
+        ensure(e1.equals(&e2));
+
+        std::vector<std::size_t> s1, s2;
+        MonotoneChainBuilder::getChainStartIndices(seq, s1);
+        MonotoneChainBuilder::getChainStartIndices(ring, s2);
+        ensure(s1 == s2);
+    }
+}
+
+// Geometries built by a factory using packed sequences
+template<>
+template<>
+void object::test<6>
+()
+{
+    using namespace geos::geom;
+
+    PackedCoordinateSequenceFactory csf(2);
+    GeometryFactory::Ptr gf = GeometryFactory::create(&csf);
+    CoordinateSequence* cs = gf->getCoordinateSequenceFactory()->create(ring);
+    ensure(dynamic_cast<PackedCoordinateSequence*>(cs) != nullptr);
+
+    std::unique_ptr<Polygon> poly(gf->createPolygon(gf->createLinearRing(cs), nullptr));
+    ensure_equals(poly->getArea(), 110.0);
+    ensure_equals(poly->getEnvelopeInternal()->getMaxY(), 12.0);
+    ensure_equals(poly->getExteriorRing()->getNumPoints(), ring.size());
+}
+
+// The Coordinate cache is built once when several threads read it
+template<>
+template<>
+void object::test<7>
+()
+{
+    std::vector<double> ords;
+    for(int i = 0; i < 10000; i++) {
+        ords.push_back(i);
+        ords.push_back(-i);
+    }
+    PackedCoordinateSequence seq(std::move(ords), 2);
+
+    std::vector<std::thread> threads;
+    std::vector<int> mismatches(4, 0);
+    for(std::size_t t = 0; t < mismatches.size(); t++) {
+        threads.emplace_back([&seq, &mismatches, t]() {
+            for(std::size_t i = 0; i < seq.size(); i++) {
+                const Coordinate& c = seq.getAt(i);
+                if(c.x != static_cast<double>(i) || c.y != -static_cast<double>(i)) {
+                    mismatches[t]++;
+                }
+            }
+        });
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+    for(int count : mismatches) {
+        ensure_equals(count, 0);
+    }
+    ensure(&seq.getAt(0) == &(*seq.toVector())[0]);
+}
+
+} // namespace tut
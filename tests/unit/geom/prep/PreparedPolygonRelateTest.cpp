@@ -0,0 +1,228 @@
+//
+// Test Suite for the touches(), crosses(), overlaps() and relate()
+// functions of PreparedPolygon, against the ones of Geometry
+
+// tut
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <memory>
+#include <string>
+
+using namespace geos::geom;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_preparedpolygonrelate_data {
+    typedef std::unique_ptr<const geos::geom::prep::PreparedGeometry> PrepGeomAutoPtr;
+    typedef std::unique_ptr<geos::geom::Geometry> GeomAutoPtr;
+
+    geos::geom::GeometryFactory::Ptr factory;
+    geos::io::WKTReader reader;
+
+    test_preparedpolygonrelate_data()
+        : factory(GeometryFactory::create())
+        , reader(factory.get())
+    {}
+
+    // Checks the predicates of g1 prepared against those of g1
+    void
+    checkPrepared(const Geometry* g1, const Geometry* g2)
+    {
+        static const char* patterns[] = {
+            "FT*******", "F**T*****", "F***T****", "T*T******",
+            "T*****FF*", "FF*FF****", "0********", "1********",
+            "2********", "***T*****", "****1****"
+        };
+
+        PrepGeomAutoPtr pg1(prep::PreparedGeometryFactory::prepare(g1));
+        std::string msg = g1->toString() + " / " + g2->toString();
+
+        ensure_equals("touches " + msg, pg1->touches(g2), g1->touches(g2));
+        ensure_equals("crosses " + msg, pg1->crosses(g2), g1->crosses(g2));
+        ensure_equals("overlaps " + msg, pg1->overlaps(g2), g1->overlaps(g2));
+        for(const char* pattern : patterns) {
+            ensure_equals("relate " + std::string(pattern) + " " + msg,
+                          pg1->relate(g2, pattern), g1->relate(g2, pattern));
+        }
+        std::unique_ptr<IntersectionMatrix> im(g1->relate(g2));
+        ensure("relate " + im->toString() + " " + msg, pg1->relate(g2, im->toString()));
+    }
+
+    // Checks the polygon against each of the geometries, both ways
+    void
+    checkAll(const std::string& polyWkt, const char* const* wkts, std::size_t n)
+    {
+        GeomAutoPtr poly(reader.read(polyWkt));
+        for(std::size_t i = 0; i < n; i++) {
+            GeomAutoPtr g(reader.read(wkts[i]));
+            checkPrepared(poly.get(), g.get());
+            checkPrepared(g.get(), poly.get());
+        }
+    }
+
+    // A square with a square hole
+    const std::string polyWithHole =
+        "POLYGON((0 0, 10 0, 10 10, 0 10, 0 0), (3 3, 7 3, 7 7, 3 7, 3 3))";
+};
+
+typedef test_group<test_preparedpolygonrelate_data> group;
+typedef group::object object;
+
+group test_preparedpolygonrelate_group("geos::geom::prep::PreparedPolygonRelate");
+
+//
+// Test Cases
+//
+
+// 1 - Points
+template<>
+template<>
+void object::test<1>
+()
+{
+    const char* wkts[] = {
+        "POINT(1 1)",               // interior
+        "POINT(0 5)",               // on the shell
+        "POINT(0 0)",               // on a shell vertex
+        "POINT(3 5)",               // on the hole boundary
+        "POINT(5 5)",               // in the hole
+        "POINT(20 20)",             // outside
+        "MULTIPOINT((0 5), (20 20))",
+        "MULTIPOINT((0 5), (1 1))",
+        "MULTIPOINT((3 5), (5 5))",
+        "MULTIPOINT((1 1), (5 5))"
+    };
+    checkAll(polyWithHole, wkts, sizeof(wkts) / sizeof(wkts[0]));
+}
+
+// 2 - Lines
+template<>
+template<>
+void object::test<2>
+()
+{
+    const char* wkts[] = {
+        "LINESTRING(-5 5, 1 5)",            // crosses the shell
+        "LINESTRING(-5 5, 0 5)",            // ends on the shell
+        "LINESTRING(-5 0, 0 0)",            // ends on a shell vertex
+        "LINESTRING(0 -5, 0 15)",           // along a shell edge
+        "LINESTRING(0 2, 0 8)",             // within a shell edge
+        "LINESTRING(1 1, 2 2)",             // interior
+        "LINESTRING(1 1, 3 5)",             // interior, ending on the hole
+        "LINESTRING(5 5, 3 5)",             // in the hole, ending on its boundary
+        "LINESTRING(5 5, 1 5)",             // crosses the hole boundary
+        "LINESTRING(4 4, 6 6)",             // in the hole
+        "LINESTRING(3 3, 7 3)",             // along the hole boundary
+        "LINESTRING(-1 5, 11 5)",           // across the polygon and the hole
+        "LINESTRING(20 20, 30 30)",         // outside
+        "MULTILINESTRING((-5 5, 0 5), (20 20, 30 30))",
+        "MULTILINESTRING((-5 5, 0 5), (1 1, 2 2))"
+    };
+    checkAll(polyWithHole, wkts, sizeof(wkts) / sizeof(wkts[0]));
+}
+
+// 3 - Polygons
+template<>
+template<>
+void object::test<3>
+()
+{
+    const char* wkts[] = {
+        "POLYGON((5 -5, 15 -5, 15 5, 5 5, 5 -5))",          // overlaps
+        "POLYGON((10 0, 20 0, 20 10, 10 10, 10 0))",        // shares an edge
+        "POLYGON((10 2, 20 2, 20 8, 10 8, 10 2))",          // shares part of an edge
+        "POLYGON((10 10, 20 10, 20 20, 10 20, 10 10))",     // shares a vertex
+        "POLYGON((3 3, 7 3, 7 7, 3 7, 3 3))",               // fills the hole
+        "POLYGON((4 4, 6 4, 6 6, 4 6, 4 4))",               // in the hole
+        "POLYGON((4 3, 6 3, 6 5, 4 5, 4 3))",               // in the hole, on its boundary
+        "POLYGON((2 2, 8 2, 8 8, 2 8, 2 2))",               // covers the hole
+        "POLYGON((1 1, 2 1, 2 2, 1 2, 1 1))",               // interior
+        "POLYGON((0 0, 2 0, 2 2, 0 2, 0 0))",               // interior, on the shell
+        "POLYGON((-1 -1, 11 -1, 11 11, -1 11, -1 -1))",     // contains it
+        "POLYGON((20 20, 30 20, 30 30, 20 30, 20 20))",     // disjoint
+        "MULTIPOLYGON(((10 0, 20 0, 20 10, 10 10, 10 0)), ((4 4, 6 4, 6 6, 4 6, 4 4)))",
+        "MULTIPOLYGON(((10 0, 20 0, 20 10, 10 10, 10 0)), ((1 1, 2 1, 2 2, 1 2, 1 1)))"
+    };
+    checkAll(polyWithHole, wkts, sizeof(wkts) / sizeof(wkts[0]));
+}
+
+// 4 - A prepared MultiPolygon
+template<>
+template<>
+void object::test<4>
+()
+{
+    const char* wkts[] = {
+        "POINT(10 5)",
+        "LINESTRING(5 5, 15 5)",
+        "LINESTRING(10 0, 10 10)",
+        "POLYGON((10 0, 12 0, 12 10, 10 10, 10 0))",
+        "POLYGON((8 0, 12 0, 12 10, 8 10, 8 0))"
+    };
+    checkAll("MULTIPOLYGON(((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 0, 30 10, 20 10, 20 0)))",
+             wkts, sizeof(wkts) / sizeof(wkts[0]));
+}
+
+// 5 - The comparisons above are not vacuous
+template<>
+template<>
+void object::test<5>
+()
+{
+    GeomAutoPtr poly(reader.read(polyWithHole));
+    PrepGeomAutoPtr pg(prep::PreparedGeometryFactory::prepare(poly.get()));
+
+    GeomAutoPtr holeFiller(reader.read("POLYGON((3 3, 7 3, 7 7, 3 7, 3 3))"));
+    GeomAutoPtr crossing(reader.read("LINESTRING(5 5, 1 5)"));
+    GeomAutoPtr overlapping(reader.read("POLYGON((5 -5, 15 -5, 15 5, 5 5, 5 -5))"));
+    GeomAutoPtr inHole(reader.read("POINT(5 5)"));
+
+    ensure(pg->touches(holeFiller.get()));
+    ensure(!pg->overlaps(holeFiller.get()));
+    ensure(pg->crosses(crossing.get()));
+    ensure(!pg->touches(crossing.get()));
+    ensure(pg->overlaps(overlapping.get()));
+    ensure(pg->relate(overlapping.get(), "212101212"));
+    ensure(pg->relate(inHole.get(), "FF*FF****"));
+}
+
+// 6 - Rings touching inside a segment of the shell
+template<>
+template<>
+void object::test<6>
+()
+{
+    const char* wkts[] = {
+        "LINESTRING(5 -1, 5 1)",
+        "LINESTRING(5 -1, 5 0)",
+        "LINESTRING(4 -1, 6 1)",
+        "POLYGON((5 -1, 6 -1, 5 1, 5 -1))",
+        "POLYGON((4 -1, 6 -1, 6 -0.5, 5 0, 4 -0.5, 4 -1))"
+    };
+    // A hole touching the shell
+    checkAll("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0), (5 0, 4 3, 6 3, 5 0))",
+             wkts, sizeof(wkts) / sizeof(wkts[0]));
+    // Two parts touching
+    checkAll("MULTIPOLYGON(((0 0, 10 0, 10 10, 0 10, 0 0)), ((5 0, 4 -3, 6 -3, 5 0)))",
+             wkts, sizeof(wkts) / sizeof(wkts[0]));
+
+    GeomAutoPtr poly(reader.read("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0), (5 0, 4 3, 6 3, 5 0))"));
+    PrepGeomAutoPtr pg(prep::PreparedGeometryFactory::prepare(poly.get()));
+    GeomAutoPtr line(reader.read("LINESTRING(5 -1, 5 1)"));
+    ensure(pg->touches(line.get()));
+    ensure(!pg->crosses(line.get()));
+}
+
+} // namespace tut
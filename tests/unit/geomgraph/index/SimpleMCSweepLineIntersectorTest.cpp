@@ -0,0 +1,147 @@
+//
+// Test Suite for geos::geomgraph::index::SimpleMCSweepLineIntersector class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/geomgraph/GeometryGraph.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/operation/overlay/OverlayOp.h>
+#include <geos/operation/relate/RelateOp.h>
+#include <geos/operation/valid/IsValidOp.h>
+#include <geos/util/GeometricShapeFactory.h>
+// std
+#include <memory>
+#include <vector>
+
+using namespace geos::geom;
+using geos::geomgraph::GeometryGraph;
+using geos::operation::overlay::OverlayOp;
+using geos::operation::relate::RelateOp;
+using geos::operation::valid::IsValidOp;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_simplemcsweeplineintersector_data {
+    typedef std::unique_ptr<Geometry> GeomPtr;
+
+    PrecisionModel pm;
+    GeometryFactory::Ptr factory;
+
+    test_simplemcsweeplineintersector_data()
+        : pm(1000), factory(GeometryFactory::create(&pm, 0))
+    {}
+
+    // A grid of small circles, with enough monotone chains for the
+    // sweep to be shared between threads
+    GeomPtr
+    createCircleGrid(int gridSize, double spacing) const
+    {
+        geos::util::GeometricShapeFactory gsf(factory.get());
+        gsf.setNumPoints(32);
+        gsf.setSize(1.0);
+        std::vector<Geometry*>* polys = new std::vector<Geometry*>();
+        for(int i = 0; i < gridSize; i++) {
+            for(int j = 0; j < gridSize; j++) {
+                gsf.setCentre(Coordinate(i * spacing, j * spacing));
+                polys->push_back(gsf.createCircle());
+            }
+        }
+        return GeomPtr(factory->createMultiPolygon(polys));
+    }
+
+    GeomPtr
+    createCircle(double x, double y, double size, int npts) const
+    {
+        geos::util::GeometricShapeFactory gsf(factory.get());
+        gsf.setNumPoints(npts);
+        gsf.setSize(size);
+        gsf.setCentre(Coordinate(x, y));
+        return GeomPtr(gsf.createCircle());
+    }
+};
+
+typedef test_group<test_simplemcsweeplineintersector_data> group;
+typedef group::object object;
+
+group test_simplemcsweeplineintersector_group("geos::geomgraph::index::SimpleMCSweepLineIntersector");
+
+//
+// Test Cases
+//
+
+// Overlay and relate give the same result with several threads
+template<>
+template<>
+void object::test<1>
+()
+{
+    GeomPtr grid = createCircleGrid(25, 1.5);
+    GeomPtr circle = createCircle(18, 18, 30, 2000);
+
+    OverlayOp serialOp(grid.get(), circle.get());
+    GeomPtr serial(serialOp.getResultGeometry(OverlayOp::opINTERSECTION));
+    std::unique_ptr<IntersectionMatrix> serialMatrix(grid->relate(circle.get()));
+
+    OverlayOp parallelOp(grid.get(), circle.get());
+    parallelOp.setNumThreads(4);
+    GeomPtr parallel(parallelOp.getResultGeometry(OverlayOp::opINTERSECTION));
+
+    RelateOp relateOp(grid.get(), circle.get());
+    relateOp.setNumThreads(4);
+    std::unique_ptr<IntersectionMatrix> parallelMatrix(relateOp.getIntersectionMatrix());
+
+    ensure(!serial->isEmpty());
+    ensure(parallel->equalsExact(serial.get()));
+    ensure_equals(parallelMatrix->toString(), serialMatrix->toString());
+}
+
+// Validity checking finds the same errors with several threads
+template<>
+template<>
+void object::test<2>
+()
+{
+    // disjoint circles
+    GeomPtr valid = createCircleGrid(25, 3.0);
+    // overlapping circles
+    GeomPtr invalid = createCircleGrid(25, 0.9);
+
+    ensure(valid->isValid());
+    ensure(!invalid->isValid());
+
+    IsValidOp validOp(valid.get());
+    validOp.setNumThreads(4);
+    ensure(validOp.isValid());
+
+    IsValidOp invalidOp(invalid.get());
+    invalidOp.setNumThreads(4);
+    ensure(!invalidOp.isValid());
+}
+
+// The thread count belongs to each graph
+template<>
+template<>
+void object::test<3>
+()
+{
+    GeomPtr circle = createCircle(0, 0, 10, 100);
+
+    GeometryGraph g0(0, circle.get());
+    GeometryGraph g1(1, circle.get());
+    ensure_equals(g0.getNumThreads(), 1u);
+
+    g0.setNumThreads(4);
+    ensure_equals(g0.getNumThreads(), 4u);
+    ensure_equals(g1.getNumThreads(), 1u);
+}
+
+} // namespace tut
@@ -0,0 +1,156 @@
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/index/strtree/PackedSTRtree.h>
+#include <geos/geom/Envelope.h>
+#include <geos/util/UnsupportedOperationException.h>
+// std
+#include <algorithm>
+#include <vector>
+
+using namespace geos::index::strtree;
+using geos::geom::Envelope;
+
+namespace tut {
+// dummy data, not used
+struct test_packedstrtree_data {};
+
+using group = test_group<test_packedstrtree_data>;
+using object = group::object;
+
+group test_packedstrtree_group("geos::index::strtree::PackedSTRtree");
+
+//
+// Test Cases
+//
+
+// Empty tree
+template<>
+template<>
+void object::test<1>
+()
+{
+    PackedSTRtree t;
+    Envelope env(0, 10, 0, 10);
+    std::vector<void*> matches;
+    t.query(&env, matches);
+    ensure(t.isBuilt());
+    ensure(matches.empty());
+}
+
+// Single item
+template<>
+template<>
+void object::test<2>
+()
+{
+    PackedSTRtree t;
+    int item = 1;
+    Envelope itemEnv(1, 2, 1, 2);
+    t.insert(&itemEnv, &item);
+    Envelope nullEnv;
+    t.insert(&nullEnv, &item);
+    ensure_equals(t.size(), 1u);
+
+    std::vector<void*> matches;
+    Envelope hit(0, 1, 0, 1);
+    t.query(&hit, matches);
+    ensure_equals(matches.size(), 1u);
+    ensure_equals(matches[0], (void*) &item);
+
+    matches.clear();
+    Envelope miss(3, 4, 0, 10);
+    t.query(&miss, matches);
+    ensure(matches.empty());
+}
+
+// Queries find the same items as a linear scan
+template<>
+template<>
+void object::test<3>
+()
+{
+    const std::size_t n = 2000;
+    std::vector<Envelope> envs;
+    std::vector<std::size_t> ids(n);
+    seeded_random random(17);
+    for(std::size_t i = 0; i < n; i++) {
+        double x = random(1000);
+        double y = random(1000);
+        double w = static_cast<double>(i % 7);
+        double h = static_cast<double>(i % 5);
+        envs.emplace_back(x, x + w, y, y + h);
+        ids[i] = i;
+    }
+
+    PackedSTRtree t(4);
+    for(std::size_t i = 0; i < n; i++) {
+        t.insert(&envs[i], &ids[i]);
+    }
+    t.build();
+
+    for(double q = 0; q < 1000; q += 37) {
+        Envelope searchEnv(q, q + 50, 1000 - q, 1000 - q + 20);
+
+        std::vector<void*> expected;
+        for(std::size_t i = 0; i < n; i++) {
+            if(envs[i].intersects(searchEnv)) {
+                expected.push_back(&ids[i]);
+            }
+        }
+
+        std::vector<void*> matches;
+        t.query(searchEnv, [&matches](void* item) {
+            matches.push_back(item);
+        });
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(matches.begin(), matches.end());
+        ensure(matches == expected);
+    }
+}
+
+// Removing is not supported
+template<>
+template<>
+void object::test<4>
+()
+{
+    PackedSTRtree t;
+    int item = 1;
+    Envelope itemEnv(1, 2, 1, 2);
+    t.insert(&itemEnv, &item);
+    try {
+        t.remove(&itemEnv, &item);
+        fail("UnsupportedOperationException expected");
+    }
+    catch(const geos::util::UnsupportedOperationException&) {
+    }
+}
+
+// Items inserted by index, including index 0
+template<>
+template<>
+void object::test<5>
+()
+{
+    PackedSTRtree t;
+    for(std::size_t i = 0; i < 100; i++) {
+        double x = static_cast<double>(i);
+        Envelope itemEnv(x, x + 1, 0, 1);
+        t.insertIndex(&itemEnv, i);
+    }
+    t.build();
+
+    std::vector<std::size_t> matches;
+    t.queryIndex(Envelope(-1, 2.5, 0, 1), [&matches](std::size_t i) {
+        matches.push_back(i);
+    });
+    std::sort(matches.begin(), matches.end());
+    ensure_equals(matches.size(), 3u);
+    for(std::size_t i = 0; i < matches.size(); i++) {
+        ensure_equals(matches[i], i);
+    }
+}
+
+} // namespace tut
@@ -0,0 +1,197 @@
+//
+// Test Suite for geos::io::NumberConversion
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/NumberConversion.h>
+// std
+#include <clocale>
+#include <cmath>
+#include <limits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_numberconversion_data {
+    typedef geos::io::NumberConversion NumberConversion;
+
+    static bool
+    parse(const char* str, double& d)
+    {
+        return NumberConversion::parseDouble(str, std::strlen(str), d);
+    }
+
+    static std::string
+    fixed(double d, int precision)
+    {
+        char buf[NumberConversion::BUFFER_SIZE];
+        std::size_t len = NumberConversion::writeFixed(d, precision, buf, sizeof(buf));
+        return std::string(buf, len);
+    }
+
+    static std::string
+    general(double d, int precision)
+    {
+        char buf[NumberConversion::BUFFER_SIZE];
+        std::size_t len = NumberConversion::writeGeneral(d, precision, buf, sizeof(buf));
+        return std::string(buf, len);
+    }
+};
+
+typedef test_group<test_numberconversion_data> group;
+typedef group::object object;
+
+group test_numberconversion_group("geos::io::NumberConversion");
+
+//
+// Test Cases
+//
+
+// 1 - Formatting
+template<>
+template<>
+void object::test<1>
+()
+{
+    ensure_equals(fixed(1.5, 3), "1.500");
+    ensure_equals(fixed(-0.125, 2), "-0.12");
+    ensure_equals(fixed(1e20, 0), "100000000000000000000");
+    ensure_equals(general(1.5, 16), "1.5");
+    ensure_equals(general(0.1, 16), "0.1");
+    ensure_equals(general(1e-20, 6), "1e-20");
+    ensure_equals(general(123456789.0, 4), "1.235e+08");
+
+    // precision is capped, not overflowing the buffer
+    std::string big = fixed(-1.7976931348623157e308, 1000);
+    ensure_equals(big.size(), std::size_t(1 + 309 + 1 + NumberConversion::MAX_PRECISION));
+
+    // truncation to a small buffer
+    char buf[4];
+    std::size_t len = NumberConversion::writeFixed(3.14159, 4, buf, sizeof(buf));
+    ensure_equals(len, std::size_t(6));
+    ensure_equals(std::string(buf), "3.1");
+}
+
+// 2 - Parsing
+template<>
+template<>
+void object::test<2>
+()
+{
+    double d;
+    ensure(parse("1.5", d));
+    ensure_equals(d, 1.5);
+    ensure(parse("-.5", d));
+    ensure_equals(d, -0.5);
+    ensure(parse("+2.", d));
+    ensure_equals(d, 2.0);
+    ensure(parse("1e3", d));
+    ensure_equals(d, 1000.0);
+    ensure(parse("2.5E-3", d));
+    ensure_equals(d, 0.0025);
+    ensure(parse("-0", d));
+    ensure(d == 0.0 && std::signbit(d));
+    ensure(parse("1e400", d));
+    ensure(std::isinf(d) && d > 0);
+    ensure(parse("-1e400", d));
+    ensure(std::isinf(d) && d < 0);
+    ensure(parse("1e-400", d));
+    ensure_equals(d, 0.0);
+    ensure(parse("-1e-400", d));
+    ensure(d == 0.0 && std::signbit(d));
+    ensure(parse("4e-320", d));
+    ensure_equals(d, 4e-320);
+    ensure(parse("4.9406564584124654e-324", d));
+    ensure_equals(d, std::numeric_limits<double>::denorm_min());
+    ensure(parse("0.000000000000000000000000000001", d));
+    ensure_equals(d, 1e-30);
+    ensure(parse("12345678901234567890123", d));
+    ensure_equals(d, 12345678901234567890123.0);
+    // longer than the stack buffer of the slow path
+    std::string longNum = "0.1" + std::string(NumberConversion::BUFFER_SIZE, '0') + "1";
+    ensure(parse(longNum.c_str(), d));
+    ensure_equals(d, 0.1);
+    ensure(parse("INF", d));
+    ensure(std::isinf(d) && d > 0);
+    ensure(parse("-Infinity", d));
+    ensure(std::isinf(d) && d < 0);
+    ensure(parse("nan", d));
+    ensure(std::isnan(d));
+
+    ensure(! parse("", d));
+    ensure(! parse("-", d));
+    ensure(! parse(".", d));
+    ensure(! parse("1e", d));
+    ensure(! parse("1e+", d));
+    ensure(! parse("1.5x", d));
+    ensure(! parse(" 1", d));
+    ensure(! parse("1,5", d));
+    ensure(! parse("EMPTY", d));
+    ensure(! parse("nano", d));
+
+    // only the given length is parsed
+    ensure(NumberConversion::parseDouble("12)", 2, d));
+    ensure_equals(d, 12.0);
+}
+
+// 3 - Parsing is correctly rounded
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::mt19937_64 gen(4321);
+    std::uniform_real_distribution<double> mant(-1.0, 1.0);
+    std::uniform_int_distribution<int> expo(-300, 300);
+    char buf[64];
+    for(int i = 0; i < 10000; i++) {
+        double x = std::ldexp(mant(gen), expo(gen));
+        for(int precision = 6; precision <= 17; precision++) {
+            int len = std::snprintf(buf, sizeof(buf), "%.*g", precision, x);
+            double d;
+            ensure(NumberConversion::parseDouble(buf, static_cast<std::size_t>(len), d));
+            ensure_equals(d, std::strtod(buf, nullptr));
+        }
+    }
+}
+
+// 4 - The locale decimal separator is not used
+template<>
+template<>
+void object::test<4>
+()
+{
+    const char* locales[] = { "de_DE.UTF-8", "de_DE", "fr_FR.UTF-8", "fr_FR", "German" };
+    std::string saved(std::setlocale(LC_NUMERIC, nullptr));
+    bool found = false;
+    for(const char* loc : locales) {
+        if(std::setlocale(LC_NUMERIC, loc)) {
+            found = true;
+            break;
+        }
+    }
+    if(! found) {
+        return; // no locale with a decimal comma available
+    }
+
+    std::string f = fixed(-1.25, 2);
+    std::string g = general(0.5, 16);
+    double d = 0;
+    bool ok = parse("2.75", d);
+    std::setlocale(LC_NUMERIC, saved.c_str());
+
+    ensure_equals(f, "-1.25");
+    ensure_equals(g, "0.5");
+    ensure(ok);
+    ensure_equals(d, 2.75);
+}
+
+} // namespace tut
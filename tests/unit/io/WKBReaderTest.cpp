@@ -381,5 +381,109 @@ void object::test<15>
     );
 }
 
-} // namespace tut
+// 16 - Read from a byte buffer, both byte orders
+template<>
+template<>
+void object::test<16>
+()
+{
+    GeomPtr g(wktreader.read("LINESTRING(1 2, 3 4, 5 6)"));
+
+    std::stringstream ndr;
+    ndrwkbwriter.write(*g, ndr);
+    std::string ndrbuf = ndr.str();
+    GeomPtr g1(wkbreader.read(reinterpret_cast<const unsigned char*>(ndrbuf.data()), ndrbuf.size()));
+    ensure(g1->equalsExact(g.get()));
 
+    std::stringstream xdr;
+    xdrwkbwriter.write(*g, xdr);
+    std::string xdrbuf = xdr.str();
+    GeomPtr g2(wkbreader.read(reinterpret_cast<const unsigned char*>(xdrbuf.data()), xdrbuf.size()));
+    ensure(g2->equalsExact(g.get()));
+
+    // truncated buffer
+    std::string err;
+    try {
+        GeomPtr g3(wkbreader.read(reinterpret_cast<const unsigned char*>(xdrbuf.data()), xdrbuf.size() - 1));
+    }
+    catch(const geos::util::GEOSException& ex) {
+        err = ex.what();
+    }
+    ensure_equals(err, "ParseException: Unexpected EOF parsing WKB");
+}
+
+// 17 - Element counts larger than the input are rejected
+template<>
+template<>
+void object::test<17>
+()
+{
+    std::string err;
+    try {
+        // MULTIPOINT claiming 0x7fffffff points
+        std::stringstream hexwkb("0104000000FFFFFF7F");
+        GeomPtr g(wkbreader.readHEX(hexwkb));
+    }
+    catch(const geos::util::GEOSException& ex) {
+        err = ex.what();
+    }
+    ensure_equals(err, "ParseException: Invalid number of elements in WKB");
+}
+
+// 18 - Reading from a stream leaves it after the geometry
+template<>
+template<>
+void object::test<18>
+()
+{
+    GeomPtr g1(wktreader.read("POINT(1 2)"));
+    GeomPtr g2(wktreader.read("POINT(3 4)"));
+    std::stringstream wkb;
+    ndrwkbwriter.write(*g1, wkb);
+    ndrwkbwriter.write(*g2, wkb);
+
+    GeomPtr r1(wkbreader.read(wkb));
+    GeomPtr r2(wkbreader.read(wkb));
+    ensure(r1->equalsExact(g1.get()));
+    ensure(r2->equalsExact(g2.get()));
+}
+
+// 19 - Consecutive geometries from a stream which cannot seek
+template<>
+template<>
+void object::test<19>
+()
+{
+    // a streambuf without seekoff/seekpos, as a pipe
+    struct PipeBuf : public std::streambuf {
+        std::string bytes;
+        PipeBuf(const std::string& b) : bytes(b)
+        {
+            char* p = &bytes[0];
+            setg(p, p, p + bytes.size());
+        }
+    };
+
+    std::stringstream wkt;
+    wkt << "LINESTRING(";
+    for(int i = 0; i < 3000; i++) {
+        wkt << (i ? ", " : "") << i << " " << -i;
+    }
+    wkt << ")";
+    GeomPtr g1(wktreader.read(wkt.str()));
+    GeomPtr g2(wktreader.read("POINT(3 4)"));
+    std::stringstream wkb;
+    xdrwkbwriter.write(*g1, wkb);
+    xdrwkbwriter.write(*g2, wkb);
+
+    PipeBuf pipe(wkb.str());
+    std::istream is(&pipe);
+    ensure(is.tellg() == std::streampos(-1));
+
+    GeomPtr r1(wkbreader.read(is));
+    GeomPtr r2(wkbreader.read(is));
+    ensure(r1->equalsExact(g1.get()));
+    ensure(r2->equalsExact(g2.get()));
+}
+
+} // namespace tut
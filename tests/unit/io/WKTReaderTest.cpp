@@ -200,4 +200,22 @@ void object::test<8>
     }
 }
 
+// 9 - Numbers are read exactly, whatever their notation
+template<>
+template<>
+void object::test<9>
+()
+{
+    geos::io::WKTReader reader;
+    GeomPtr geom(reader.read("LINESTRING Z (0.1 -12345.678901234567 1e-3, +.5 2.5E+2 -0.30000000000000004)"));
+    std::unique_ptr<geos::geom::CoordinateSequence> coords(geom->getCoordinates());
+
+    ensure_equals(coords->getX(0), 0.1);
+    ensure_equals(coords->getY(0), -12345.678901234567);
+    ensure_equals(coords->getAt(0).z, 1e-3);
+    ensure_equals(coords->getX(1), 0.5);
+    ensure_equals(coords->getY(1), 250.0);
+    ensure_equals(coords->getAt(1).z, -0.30000000000000004);
+}
+
 } // namespace tut
@@ -0,0 +1,107 @@
+//
+// Test Suite for geos::math::DD
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/math/DD.h>
+#include <geos/algorithm/CGAlgorithmsDD.h>
+#include <geos/geom/Coordinate.h>
+// std
+#include <cmath>
+
+using geos::math::DD;
+using geos::geom::Coordinate;
+using geos::algorithm::CGAlgorithmsDD;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_dd_data {
+    test_dd_data() {}
+};
+
+typedef test_group<test_dd_data> group;
+typedef group::object object;
+
+group test_dd_group("geos::math::DD");
+
+//
+// Test Cases
+//
+
+// twoSum and twoProd are exact
+template<>
+template<>
+void object::test<1>
+()
+{
+    DD s = DD::twoSum(1.0, 1e-20);
+    ensure_equals(s.getHi(), 1.0);
+    ensure_equals(s.getLo(), 1e-20);
+
+    double a = 1.0 + std::ldexp(1.0, -30);
+    DD p = DD::twoProd(a, a);
+    // (1 + 2^-30)^2 = 1 + 2^-29 + 2^-60
+    ensure_equals(p.getHi(), 1.0 + std::ldexp(1.0, -29));
+    ensure_equals(p.getLo(), std::ldexp(1.0, -60));
+}
+
+// arithmetic keeps the low-order bits lost by double precision
+template<>
+template<>
+void object::test<2>
+()
+{
+    DD x = DD(1.0) + DD(1e-20);
+    DD y = x - DD(1.0);
+    ensure_equals(y.doubleValue(), 1e-20);
+
+    DD third = DD(1.0) / DD(3.0);
+    DD one = third * DD(3.0);
+    ensure(std::fabs((one - DD(1.0)).doubleValue()) < 1e-30);
+}
+
+// sign and comparisons
+template<>
+template<>
+void object::test<3>
+()
+{
+    ensure_equals(DD(0.0).signum(), 0);
+    ensure_equals(DD(0.0, -1e-40).signum(), -1);
+    ensure_equals(DD(-2.0).signum(), -1);
+    ensure_equals(DD(2.0, -1e-20).signum(), 1);
+    ensure(DD(1.0, 1e-20) > DD(1.0));
+    ensure(DD(1.0) < DD(1.0, 1e-20));
+    ensure(DD(1.0) == DD(1.0, 0.0));
+}
+
+// signOfDet2x2 decides cases where double precision cannot
+template<>
+template<>
+void object::test<4>
+()
+{
+    double e = std::ldexp(1.0, -30);
+    // (1+e)*(1-e) - 1*1 = -e^2, which rounds to 0 in double precision
+    ensure_equals((1 + e) * (1 - e) - 1.0, 0.0);
+    ensure_equals(DD::signOfDet2x2(DD(1 + e), DD(1.0), DD(1.0), DD(1 - e)), -1);
+    ensure_equals(CGAlgorithmsDD::signOfDet2x2(1 + e, 1.0, 1.0, 1 - e), -1);
+}
+
+// intersection of two segments
+template<>
+template<>
+void object::test<5>
+()
+{
+    Coordinate rv;
+    CGAlgorithmsDD::intersection(Coordinate(0, 0), Coordinate(10, 10),
+                                 Coordinate(0, 10), Coordinate(10, 0), rv);
+    ensure_equals(rv.x, 5.0);
+    ensure_equals(rv.y, 5.0);
+}
+
+} // namespace tut
@@ -8,8 +8,10 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/CoordinateArraySequenceFactory.h>
+#include <geos/util/IllegalStateException.h>
 // std
 #include <memory>
+#include <vector>
 
 namespace tut {
 //
@@ -235,10 +237,94 @@ void object::test<5>
 
 }
 
+// test splitting at nodes added out of order
+template<>
+template<>
+void object::test<6>
+()
+{
+    CoordinateSequenceAutoPtr cs(csFactory->create((size_t)0, 2));
+    cs->add(geos::geom::Coordinate(0, 0));
+    cs->add(geos::geom::Coordinate(10, 0));
+    cs->add(geos::geom::Coordinate(10, 10));
+
+    SegmentStringAutoPtr ss(makeSegmentString(cs.release()));
+
+    ss->addIntersection(geos::geom::Coordinate(10, 5), 1);
+    ss->addIntersection(geos::geom::Coordinate(7, 0), 0);
+    ss->addIntersection(geos::geom::Coordinate(3, 0), 0);
+    ss->addIntersection(geos::geom::Coordinate(7, 0), 0);
+    ensure_equals(ss->getNodeList().size(), 3u);
+
+    std::vector<geos::noding::SegmentString*> splitEdges;
+    ss->getNodeList().addSplitEdges(splitEdges);
+    ensure_equals(splitEdges.size(), 4u);
+
+    const double expected[][2] = { {0, 0}, {3, 0}, {7, 0}, {10, 5}, {10, 10} };
+    for(std::size_t i = 0; i < splitEdges.size(); i++) {
+        geos::noding::SegmentString* split = splitEdges[i];
+        ensure(split->getCoordinate(0).equals2D(
+                   geos::geom::Coordinate(expected[i][0], expected[i][1])));
+        ensure(split->getCoordinate(split->size() - 1).equals2D(
+                   geos::geom::Coordinate(expected[i + 1][0], expected[i + 1][1])));
+        delete split;
+    }
+}
+
+// Nodes are only sorted by prepare() or a non-const access
+template<>
+template<>
+void object::test<8>
+()
+{
+    using geos::geom::Coordinate;
+    using geos::noding::SegmentNode;
+    using geos::noding::SegmentNodeList;
+
+    CoordinateSequenceAutoPtr cs(csFactory->create((size_t)0, 2));
+    cs->add(Coordinate(0, 0));
+    cs->add(Coordinate(10, 0));
+    cs->add(Coordinate(10, 10));
+    SegmentStringAutoPtr ss(makeSegmentString(cs.release()));
+
+    SegmentNodeList& nodes = ss->getNodeList();
+    const SegmentNodeList& constNodes = nodes;
+    nodes.add(Coordinate(10, 5), 1);
+    nodes.add(Coordinate(5, 0), 0);
+    nodes.add(Coordinate(10, 5), 1);
+
+    // the const accessors require the list to be prepared
+    ensure(!constNodes.isPrepared());
+    bool thrown = false;
+    try {
+        constNodes.size();
+    }
+    catch(const geos::util::IllegalStateException&) {
+        thrown = true;
+    }
+    ensure(thrown);
+
+    nodes.prepare();
+    ensure(constNodes.isPrepared());
+    ensure_equals(constNodes.size(), 2u);
+    std::vector<Coordinate> coords;
+    for(const SegmentNode& node : constNodes) {
+        coords.push_back(node.coord);
+    }
+    ensure(coords[0] == Coordinate(5, 0));
+    ensure(coords[1] == Coordinate(10, 5));
+
+    // a non-const access sorts again after an add
+    nodes.add(Coordinate(2, 0), 0);
+    ensure(!constNodes.isPrepared());
+    ensure_equals(nodes.size(), 3u);
+    ensure(nodes.begin()->coord == Coordinate(2, 0));
+}
+
 // TODO: test getting noded substrings
 //  template<>
 //  template<>
-//  void object::test<6>()
+//  void object::test<7>()
 //  {
 //      geos::geom::Coordinate cs1p0(0, 0);
 //      geos::geom::Coordinate cs1p1(10, 0);
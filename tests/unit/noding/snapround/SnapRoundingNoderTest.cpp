@@ -0,0 +1,206 @@
+//
+// Test Suite for geos::noding::snapround::SnapRoundingNoder class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/noding/NodedSegmentString.h>
+#include <geos/noding/SegmentString.h>
+#include <geos/noding/snapround/MCIndexSnapRounder.h>
+#include <geos/noding/snapround/SnapRoundingNoder.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/PrecisionModel.h>
+// std
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_snaproundingnoder_data {
+
+    typedef geos::noding::SegmentString SegmentString;
+    typedef geos::noding::NodedSegmentString NodedSegmentString;
+    typedef geos::geom::Coordinate Coordinate;
+    typedef geos::geom::PrecisionModel PrecisionModel;
+
+    typedef std::vector<SegmentString*> SegStrVct;
+    typedef std::pair<Coordinate, Coordinate> Segment;
+
+    geos::io::WKTReader reader_;
+
+    void
+    addSegmentString(const std::string& wkt, SegStrVct& vct)
+    {
+        std::unique_ptr<geos::geom::Geometry> g(reader_.read(wkt));
+        vct.push_back(new NodedSegmentString(g->getCoordinates(), nullptr));
+    }
+
+    // Pseudo-random lines with integer vertices in [0, 1000), each
+    // vertex at most maxStep away from the previous one in x and y,
+    // many of them crossing
+    void
+    addRandomLines(std::size_t n, int maxStep, SegStrVct& vct)
+    {
+        seeded_random random(31);
+        auto next = [&random](unsigned int range) {
+            return static_cast<int>(random(range));
+        };
+        auto step = [&](int v) {
+            return std::min(999, std::max(0, v + next(static_cast<unsigned int>(2 * maxStep + 1)) - maxStep));
+        };
+        for(std::size_t i = 0; i < n; i++) {
+            std::vector<Coordinate>* pts = new std::vector<Coordinate>();
+            int x = next(1000);
+            int y = next(1000);
+            for(std::size_t j = 0, nPts = 2 + i % 4; j < nPts; j++) {
+                pts->emplace_back(x, y);
+                x = step(x);
+                y = step(y);
+            }
+            vct.push_back(new NodedSegmentString(
+                              new geos::geom::CoordinateArraySequence(pts), nullptr));
+        }
+    }
+
+    SegStrVct
+    copySegmentStrings(const SegStrVct& vct)
+    {
+        SegStrVct copy;
+        for(SegmentString* ss : vct) {
+            copy.push_back(new NodedSegmentString(ss->getCoordinates()->clone(), nullptr));
+        }
+        return copy;
+    }
+
+    // The noded substrings, each as the sequence of its coordinates
+    std::vector<std::vector<Coordinate>>
+    getSubstrings(const geos::noding::Noder& noder)
+    {
+        std::unique_ptr<SegStrVct> noded(noder.getNodedSubstrings());
+        std::vector<std::vector<Coordinate>> result;
+        for(SegmentString* ss : *noded) {
+            std::vector<Coordinate> pts;
+            ss->getCoordinates()->toVector(pts);
+            result.push_back(pts);
+            delete ss;
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // The segments of the noded substrings, in a canonical order
+    std::vector<Segment>
+    getSegments(const std::vector<std::vector<Coordinate>>& substrings)
+    {
+        std::vector<Segment> segments;
+        for(const auto& pts : substrings) {
+            for(std::size_t i = 1; i < pts.size(); i++) {
+                if(pts[i] < pts[i - 1]) {
+                    segments.emplace_back(pts[i], pts[i - 1]);
+                }
+                else {
+                    segments.emplace_back(pts[i - 1], pts[i]);
+                }
+            }
+        }
+        std::sort(segments.begin(), segments.end());
+        return segments;
+    }
+
+    void
+    freeSegmentStrings(SegStrVct& vct)
+    {
+        for(SegmentString* ss : vct) {
+            delete ss;
+        }
+        vct.clear();
+    }
+};
+
+typedef test_group<test_snaproundingnoder_data> group;
+typedef group::object object;
+
+group test_snaproundingnoder_group(
+    "geos::noding::snapround::SnapRoundingNoder"
+);
+
+//
+// Test Cases
+//
+
+// Two crossing lines are split at their rounded intersection
+template<>
+template<>
+void object::test<1>
+()
+{
+    SegStrVct nodable;
+    addSegmentString("LINESTRING(0 0, 10 9)", nodable);
+    addSegmentString("LINESTRING(0 10, 10 0)", nodable);
+
+    PrecisionModel pm(1.0);
+    geos::noding::snapround::SnapRoundingNoder noder(pm);
+    noder.computeNodes(&nodable);
+
+    auto substrings = getSubstrings(noder);
+    ensure_equals(substrings.size(), 4u);
+    for(const auto& pts : substrings) {
+        ensure_equals(pts.size(), 2u);
+        ensure(pts.front() == Coordinate(5, 5) || pts.back() == Coordinate(5, 5));
+    }
+
+    freeSegmentStrings(nodable);
+}
+
+// Same segments as MCIndexSnapRounder, whatever the number of threads
+template<>
+template<>
+void object::test<2>
+()
+{
+    // enough strings, hence chains, for several chunks of each
+    SegStrVct input;
+    addRandomLines(1500, 40, input);
+
+    PrecisionModel pm(1.0);
+
+    SegStrVct expectedNodable = copySegmentStrings(input);
+    geos::noding::snapround::MCIndexSnapRounder expectedNoder(pm);
+    expectedNoder.computeNodes(&expectedNodable);
+    auto expectedSegments = getSegments(getSubstrings(expectedNoder));
+    ensure(expectedSegments.size() > 5 * input.size());
+
+    std::vector<std::vector<Coordinate>> serialSubstrings;
+    for(std::size_t numThreads : {1, 4}) {
+        SegStrVct nodable = copySegmentStrings(input);
+        geos::noding::snapround::SnapRoundingNoder noder(pm);
+        noder.setNumThreads(numThreads);
+        noder.computeNodes(&nodable);
+        auto substrings = getSubstrings(noder);
+
+        ensure(getSegments(substrings) == expectedSegments);
+        if(numThreads == 1) {
+            serialSubstrings = substrings;
+        }
+        else {
+            ensure(substrings == serialSubstrings);
+        }
+        freeSegmentStrings(nodable);
+    }
+
+    freeSegmentStrings(expectedNodable);
+    freeSegmentStrings(input);
+}
+
+} // namespace tut
@@ -16,6 +16,7 @@
 #include <geos/geom/CoordinateSequence.h>
 // std
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -499,6 +500,114 @@ void object::test<19>
     ensure_equals(g1->distance(g2.get()), 0);
 }
 
+// Geometries above DistanceOp::INDEXED_FACET_THRESHOLD use the facet index
+template<>
+template<>
+void object::test<20>
+()
+{
+    using geos::operation::distance::DistanceOp;
+    using geos::geom::Coordinate;
+
+    std::ostringstream wkt0, wkt1;
+    wkt0 << "LINESTRING(";
+    wkt1 << "GEOMETRYCOLLECTION(LINESTRING EMPTY, LINESTRING(";
+    for(int i = 0; i < 100; i++) {
+        wkt0 << (i ? ", " : "") << i << " 0";
+        wkt1 << (i ? ", " : "") << i << " " << (i == 40 ? 2 : 10);
+    }
+    wkt0 << ")";
+    wkt1 << "))";
+    GeomPtr g0(wktreader.read(wkt0.str()));
+    GeomPtr g1(wktreader.read(wkt1.str()));
+    ensure(g0->getNumPoints() * g1->getNumPoints() > DistanceOp::INDEXED_FACET_THRESHOLD);
+
+    DistanceOp dist(*g0, *g1);
+    ensure_equals(dist.distance(), 2);
+    CSPtr cs(dist.nearestPoints());
+    ensure_equals(cs->getAt(0), Coordinate(40, 0));
+    ensure_equals(cs->getAt(1), Coordinate(40, 2));
+
+    cs.reset(DistanceOp::nearestPoints(g1.get(), g0.get()));
+    ensure_equals(cs->getAt(0), Coordinate(40, 2));
+    ensure_equals(cs->getAt(1), Coordinate(40, 0));
+}
+
+// Points against lines through the facet index, in both orders
+template<>
+template<>
+void object::test<21>
+()
+{
+    using geos::operation::distance::DistanceOp;
+    using geos::geom::Coordinate;
+
+    std::ostringstream wkt0, wkt1;
+    wkt0 << "MULTIPOINT(";
+    wkt1 << "LINESTRING(";
+    for(int i = 0; i < 60; i++) {
+        wkt0 << (i ? ", " : "") << "(" << i << " " << (i == 30 ? 5.5 : 20) << ")";
+        wkt1 << (i ? ", " : "") << 2 * i << " " << (i % 2) * 2;
+    }
+    wkt0 << ")";
+    wkt1 << ")";
+    GeomPtr g0(wktreader.read(wkt0.str()));
+    GeomPtr g1(wktreader.read(wkt1.str()));
+    ensure(g0->getNumPoints() * g1->getNumPoints() > DistanceOp::INDEXED_FACET_THRESHOLD);
+
+    ensure_equals(DistanceOp::distance(*g0, *g1), 3.5);
+    CSPtr cs(DistanceOp::nearestPoints(g0.get(), g1.get()));
+    ensure_equals(cs->getAt(0), Coordinate(30, 5.5));
+    ensure_equals(cs->getAt(1), Coordinate(30, 2));
+
+    cs.reset(DistanceOp::nearestPoints(g1.get(), g0.get()));
+    ensure_equals(cs->getAt(0), Coordinate(30, 2));
+    ensure_equals(cs->getAt(1), Coordinate(30, 5.5));
+}
+
+// isWithinDistance above DistanceOp::INDEXED_FACET_THRESHOLD
+template<>
+template<>
+void object::test<22>
+()
+{
+    using geos::operation::distance::DistanceOp;
+
+    std::ostringstream wkt0, wkt1;
+    wkt0 << "POLYGON((";
+    wkt1 << "LINESTRING(";
+    for(int i = 0; i < 100; i++) {
+        wkt0 << i << " 0, ";
+        wkt1 << (i ? ", " : "") << i << " " << (i == 40 ? 12 : 20);
+    }
+    wkt0 << "100 10, 0 10, 0 0))";
+    wkt1 << ")";
+    GeomPtr g0(wktreader.read(wkt0.str()));
+    GeomPtr g1(wktreader.read(wkt1.str()));
+    ensure(g0->getNumPoints() * g1->getNumPoints() > DistanceOp::INDEXED_FACET_THRESHOLD);
+
+    ensure(DistanceOp::isWithinDistance(*g0, *g1, 2));
+    ensure(DistanceOp::isWithinDistance(*g1, *g0, 2));
+    ensure(!DistanceOp::isWithinDistance(*g0, *g1, 1.9));
+    ensure(g0->isWithinDistance(g1.get(), 2));
+    ensure(!g0->isWithinDistance(g1.get(), 1.9));
+
+    // a line inside the polygon, away from its boundary
+    std::ostringstream wkt2;
+    wkt2 << "LINESTRING(";
+    for(int i = 0; i < 50; i++) {
+        wkt2 << (i ? ", " : "") << 10 + i << " " << 4 + (i % 2);
+    }
+    wkt2 << ")";
+    GeomPtr g2(wktreader.read(wkt2.str()));
+    ensure(g0->getNumPoints() * g2->getNumPoints() > DistanceOp::INDEXED_FACET_THRESHOLD);
+    ensure(DistanceOp::isWithinDistance(*g0, *g2, 0));
+    ensure(DistanceOp::isWithinDistance(*g2, *g0, 0));
+
+    GeomPtr empty(wktreader.read("POINT EMPTY"));
+    ensure(!DistanceOp::isWithinDistance(*g0, *empty, 100));
+}
+
 // TODO: finish the tests by adding:
 // 	LINESTRING - *all*
 // 	MULTILINESTRING - *all*
@@ -0,0 +1,307 @@
+//
+// Test Suite for geos::operation::overlay::OverlayComponentSplitter class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/operation/overlay/OverlayComponentSplitter.h>
+#include <geos/operation/overlay/OverlayOp.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/TopologyException.h>
+// std
+#include <memory>
+#include <string>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_overlaycomponentsplitter_data {
+
+    typedef geos::geom::Geometry Geometry;
+    typedef geos::operation::overlay::OverlayOp OverlayOp;
+    typedef geos::operation::overlay::OverlayComponentSplitter OverlayComponentSplitter;
+
+    geos::geom::GeometryFactory::Ptr factory;
+    geos::io::WKTReader reader;
+
+    test_overlaycomponentsplitter_data()
+        :
+        factory(geos::geom::GeometryFactory::create()),
+        reader(factory.get())
+    {}
+
+    std::unique_ptr<Geometry>
+    read(const std::string& wkt)
+    {
+        return std::unique_ptr<Geometry>(reader.read(wkt));
+    }
+
+    // Compares the split overlay with the plain one, as point sets
+    void
+    checkOverlay(const Geometry* g0, const Geometry* g1, OverlayOp::OpCode opCode)
+    {
+        std::unique_ptr<Geometry> expected(OverlayOp::overlayOp(g0, g1, opCode));
+        std::unique_ptr<Geometry> actual = OverlayComponentSplitter::overlay(g0, g1, opCode);
+        ensure_equals(actual->isEmpty(), expected->isEmpty());
+        if(!expected->isEmpty()) {
+            ensure(actual->equals(expected.get()));
+        }
+    }
+};
+
+typedef test_group<test_overlaycomponentsplitter_data> group;
+typedef group::object object;
+
+group test_overlaycomponentsplitter_group("geos::operation::overlay::OverlayComponentSplitter");
+
+//
+// Test Cases
+//
+
+// Only the components whose envelopes meet go through the overlay
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::unique_ptr<Geometry> g0 = read(
+        "MULTIPOLYGON(((0 0, 2 0, 2 2, 0 2, 0 0)), ((10 10, 12 10, 12 12, 10 12, 10 10)))");
+    std::unique_ptr<Geometry> g1 = read(
+        "MULTIPOLYGON(((1 1, 3 1, 3 3, 1 3, 1 1)), ((20 20, 22 20, 22 22, 20 22, 20 20)))");
+
+    OverlayComponentSplitter splitter(*g0, *g1, OverlayOp::opUNION);
+    ensure(splitter.hasDisjointComponents());
+    ensure_equals(splitter.getInteracting(0)->getNumGeometries(), 1u);
+    ensure_equals(splitter.getInteracting(1)->getNumGeometries(), 1u);
+    ensure(splitter.getInteracting(0)->equals(g0->getGeometryN(0)));
+    ensure(splitter.getInteracting(1)->equals(g1->getGeometryN(0)));
+}
+
+// Same point set as OverlayOp for every operation
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::unique_ptr<Geometry> g0 = read(
+        "MULTIPOLYGON(((0 0, 2 0, 2 2, 0 2, 0 0)), ((10 10, 12 10, 12 12, 10 12, 10 10)),"
+        "((30 0, 32 0, 32 2, 30 2, 30 0)))");
+    std::unique_ptr<Geometry> g1 = read(
+        "MULTIPOLYGON(((1 1, 3 1, 3 3, 1 3, 1 1)), ((20 20, 22 20, 22 22, 20 22, 20 20)),"
+        "((31 -1, 33 -1, 33 1, 31 1, 31 -1)))");
+
+    for(OverlayOp::OpCode opCode : {
+                OverlayOp::opINTERSECTION, OverlayOp::opUNION,
+                OverlayOp::opDIFFERENCE, OverlayOp::opSYMDIFFERENCE
+            }) {
+        checkOverlay(g0.get(), g1.get(), opCode);
+        checkOverlay(g1.get(), g0.get(), opCode);
+    }
+}
+
+// No interacting components at all
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::unique_ptr<Geometry> g0 = read(
+        "MULTIPOLYGON(((0 0, 1 0, 1 1, 0 1, 0 0)), ((5 5, 6 5, 6 6, 5 6, 5 5)))");
+    std::unique_ptr<Geometry> g1 = read("POLYGON((2 2, 3 2, 3 3, 2 3, 2 2))");
+
+    OverlayComponentSplitter splitter(*g0, *g1, OverlayOp::opUNION);
+    ensure(splitter.hasDisjointComponents());
+    ensure(splitter.getInteracting(0)->isEmpty());
+
+    ensure(OverlayComponentSplitter::overlay(g0.get(), g1.get(),
+           OverlayOp::opINTERSECTION)->isEmpty());
+    std::unique_ptr<Geometry> u = OverlayComponentSplitter::overlay(g0.get(), g1.get(),
+                                  OverlayOp::opUNION);
+    ensure_equals(u->getNumGeometries(), 3u);
+    std::unique_ptr<Geometry> d = OverlayComponentSplitter::overlay(g0.get(), g1.get(),
+                                  OverlayOp::opDIFFERENCE);
+    ensure(d->equals(g0.get()));
+}
+
+// Lines are never split, as their components are noded together
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::unique_ptr<Geometry> g0 = read("MULTILINESTRING((0 0, 10 10), (20 0, 30 0))");
+    std::unique_ptr<Geometry> g1 = read("MULTIPOLYGON(((0 9, 1 9, 1 10, 0 10, 0 9)))");
+
+    OverlayComponentSplitter splitter(*g0, *g1, OverlayOp::opUNION);
+    ensure(!splitter.hasDisjointComponents());
+    checkOverlay(g0.get(), g1.get(), OverlayOp::opUNION);
+}
+
+// Overlapping components of one operand go through the overlay, which
+// rejects them as OverlayOp does, even when the other operand is far
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::unique_ptr<Geometry> g0 = read(
+        "MULTIPOLYGON(((0 0, 2 0, 2 2, 0 2, 0 0)), ((1 1, 3 1, 3 3, 1 3, 1 1)),"
+        "((10 10, 12 10, 12 12, 10 12, 10 10)))");
+    std::unique_ptr<Geometry> g1 = read(
+        "MULTIPOLYGON(((20 20, 22 20, 22 22, 20 22, 20 20)), ((30 30, 32 30, 32 32, 30 32, 30 30)))");
+
+    OverlayComponentSplitter splitter(*g0, *g1, OverlayOp::opUNION);
+    ensure_equals(splitter.getInteracting(0)->getNumGeometries(), 2u);
+    ensure(splitter.getInteracting(1)->isEmpty());
+
+    bool thrown = false;
+    try {
+        OverlayComponentSplitter::overlay(g0.get(), g1.get(), OverlayOp::opUNION);
+    }
+    catch(const geos::util::TopologyException&) {
+        thrown = true;
+    }
+    ensure(thrown);
+}
+
+// Components not precise in the precision model go through the
+// overlay, while the validity of the components is not checked
+template<>
+template<>
+void object::test<6>
+()
+{
+    std::unique_ptr<Geometry> g0 = read(
+        "MULTIPOLYGON(((0 0, 2 2, 2 0, 0 2, 0 0)), ((10 10, 12 10, 12 12, 10 12, 10 10)))");
+    std::unique_ptr<Geometry> g1 = read("POLYGON((20 20, 22 20, 22 22, 20 22, 20 20))");
+    OverlayComponentSplitter splitter(*g0, *g1, OverlayOp::opUNION);
+    ensure("invalid", splitter.getInteracting(0)->isEmpty());
+
+    geos::geom::PrecisionModel pm(1.0);
+    geos::geom::GeometryFactory::Ptr fixedFactory = geos::geom::GeometryFactory::create(&pm);
+    // copied without rounding, which WKTReader would do
+    std::unique_ptr<Geometry> f0(fixedFactory->createGeometry(read(
+        "MULTIPOLYGON(((0 0, 2 0, 2 2.5, 0 2, 0 0)), ((10 10, 12 10, 12 12, 10 12, 10 10)))").get()));
+    std::unique_ptr<Geometry> f1(fixedFactory->createGeometry(g1.get()));
+    OverlayComponentSplitter fixedSplitter(*f0, *f1, OverlayOp::opUNION);
+    ensure_equals(fixedSplitter.getInteracting(0)->getNumGeometries(), 1u);
+    ensure("not precise", fixedSplitter.getInteracting(0)->equalsExact(f0->getGeometryN(0)));
+}
+
+// Disjoint components are oriented as the overlay output
+template<>
+template<>
+void object::test<7>
+()
+{
+    using geos::algorithm::Orientation;
+    using geos::geom::Polygon;
+
+    std::unique_ptr<Geometry> g0 = read(
+        "MULTIPOLYGON(((0 0, 2 0, 2 2, 0 2, 0 0)), ((10 10, 14 10, 14 14, 10 14, 10 10),"
+        "(11 11, 11 12, 12 12, 12 11, 11 11)))");
+    std::unique_ptr<Geometry> g1 = read(
+        "MULTIPOLYGON(((1 1, 3 1, 3 3, 1 3, 1 1)), ((20 20, 22 20, 22 22, 20 22, 20 20)))");
+
+    std::unique_ptr<Geometry> u = OverlayComponentSplitter::overlay(g0.get(), g1.get(),
+                                  OverlayOp::opUNION);
+    ensure_equals(u->getNumGeometries(), 3u);
+    for(std::size_t i = 0; i < u->getNumGeometries(); i++) {
+        const Polygon* poly = dynamic_cast<const Polygon*>(u->getGeometryN(i));
+        ensure(poly != nullptr);
+        ensure(!Orientation::isCCW(poly->getExteriorRing()->getCoordinatesRO()));
+        for(std::size_t j = 0; j < poly->getNumInteriorRing(); j++) {
+            ensure(Orientation::isCCW(poly->getInteriorRingN(j)->getCoordinatesRO()));
+        }
+    }
+}
+
+// Components of the second operand going through the overlay on their
+// own are kept by a union
+template<>
+template<>
+void object::test<8>
+()
+{
+    std::unique_ptr<Geometry> g0 = read("POLYGON((0 0, 2 0, 2 2, 0 2, 0 0))");
+    std::unique_ptr<Geometry> g1 = read(
+        "MULTIPOLYGON(((10 10, 12 10, 12 12, 10 12, 10 10)), ((12 12, 14 12, 14 14, 12 14, 12 12)),"
+        "((20 20, 22 20, 22 22, 20 22, 20 20)))");
+
+    OverlayComponentSplitter splitter(*g0, *g1, OverlayOp::opUNION);
+    ensure(splitter.getInteracting(0)->isEmpty());
+    ensure_equals(splitter.getInteracting(1)->getNumGeometries(), 2u);
+
+    for(OverlayOp::OpCode opCode : {
+                OverlayOp::opINTERSECTION, OverlayOp::opUNION,
+                OverlayOp::opDIFFERENCE, OverlayOp::opSYMDIFFERENCE
+            }) {
+        checkOverlay(g0.get(), g1.get(), opCode);
+        checkOverlay(g1.get(), g0.get(), opCode);
+    }
+}
+
+// Components which the operation drops are left out of the overlay
+// whatever their validity, and whether they meet components of their
+// own operand
+template<>
+template<>
+void object::test<9>
+()
+{
+    std::unique_ptr<Geometry> g0 = read(
+        "MULTIPOLYGON(((0 0, 2 0, 2 2, 0 2, 0 0)), ((1 1, 3 1, 3 3, 1 3, 1 1)),"
+        "((10 10, 12 12, 12 10, 10 12, 10 10)), ((30 30, 32 30, 32 32, 30 32, 30 30)))");
+    std::unique_ptr<Geometry> g1 = read(
+        "MULTIPOLYGON(((31 31, 33 31, 33 33, 31 33, 31 31)), ((40 40, 42 42, 42 40, 40 42, 40 40)))");
+
+    OverlayComponentSplitter intSplitter(*g0, *g1, OverlayOp::opINTERSECTION);
+    ensure_equals(intSplitter.getInteracting(0)->getNumGeometries(), 1u);
+    ensure(intSplitter.getInteracting(0)->equalsExact(g0->getGeometryN(3)));
+    ensure_equals(intSplitter.getInteracting(1)->getNumGeometries(), 1u);
+    ensure(intSplitter.getInteracting(1)->equalsExact(g1->getGeometryN(0)));
+
+    std::unique_ptr<Geometry> i = OverlayComponentSplitter::overlay(g0.get(), g1.get(),
+                                  OverlayOp::opINTERSECTION);
+    std::unique_ptr<Geometry> expected = read("POLYGON((31 31, 32 31, 32 32, 31 32, 31 31))");
+    ensure(i->equals(expected.get()));
+
+    // the difference keeps the components of the first operand
+    OverlayComponentSplitter diffSplitter(*g1, *g0, OverlayOp::opDIFFERENCE);
+    ensure_equals(diffSplitter.getInteracting(0)->getNumGeometries(), 1u);
+    ensure(diffSplitter.getInteracting(0)->equalsExact(g1->getGeometryN(0)));
+    ensure_equals(diffSplitter.getInteracting(1)->getNumGeometries(), 1u);
+    ensure(diffSplitter.getInteracting(1)->equalsExact(g0->getGeometryN(3)));
+}
+
+// With no interacting components, an empty result has the type
+// OverlayOp gives it
+template<>
+template<>
+void object::test<10>
+()
+{
+    std::unique_ptr<Geometry> g0 = read(
+        "MULTIPOLYGON(((0 0, 1 0, 1 1, 0 1, 0 0)), ((5 5, 6 5, 6 6, 5 6, 5 5)))");
+    std::unique_ptr<Geometry> g1 = read(
+        "MULTIPOLYGON(((5 0, 6 0, 6 1, 5 1, 5 0)), ((0 5, 1 5, 1 6, 0 6, 0 5)))");
+
+    std::unique_ptr<Geometry> expected(OverlayOp::overlayOp(g0.get(), g1.get(),
+                                       OverlayOp::opINTERSECTION));
+    std::unique_ptr<Geometry> i = OverlayComponentSplitter::overlay(g0.get(), g1.get(),
+                                  OverlayOp::opINTERSECTION);
+    ensure(i->isEmpty());
+    ensure_equals(i->getGeometryTypeId(), geos::geom::GEOS_POLYGON);
+    ensure_equals(i->getGeometryTypeId(), expected->getGeometryTypeId());
+}
+
+} // namespace tut
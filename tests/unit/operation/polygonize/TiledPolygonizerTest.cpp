@@ -0,0 +1,177 @@
+//
+// Test Suite for geos::operation::polygonize::TiledPolygonizer class.
+
+// tut
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/operation/polygonize/Polygonizer.h>
+#include <geos/operation/polygonize/TiledPolygonizer.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+// std
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_tiledpolygonizer_data {
+
+    typedef geos::geom::Geometry Geometry;
+    typedef geos::geom::Polygon Polygon;
+    typedef geos::operation::polygonize::Polygonizer Polygonizer;
+    typedef geos::operation::polygonize::TiledPolygonizer TiledPolygonizer;
+
+    geos::geom::GeometryFactory::Ptr factory;
+    geos::io::WKTReader reader;
+    geos::io::WKTWriter writer;
+
+    test_tiledpolygonizer_data()
+        :
+        factory(geos::geom::GeometryFactory::create()),
+        reader(factory.get())
+    {}
+
+    // The normalized polygons, as sorted WKT
+    std::vector<std::string>
+    normalizedWKT(std::vector<std::unique_ptr<Polygon>>& polys)
+    {
+        std::vector<std::string> wkts;
+        for(auto& p : polys) {
+            p->normalize();
+            wkts.push_back(writer.write(p.get()));
+        }
+        std::sort(wkts.begin(), wkts.end());
+        return wkts;
+    }
+
+    std::vector<std::string>
+    polygonize(const Geometry* g)
+    {
+        Polygonizer polygonizer;
+        polygonizer.add(g);
+        std::unique_ptr<std::vector<Polygon*>> polys(polygonizer.getPolygons());
+        std::vector<std::unique_ptr<Polygon>> result;
+        for(Polygon* p : *polys) {
+            result.emplace_back(p);
+        }
+        return normalizedWKT(result);
+    }
+
+    std::vector<std::string>
+    polygonizeTiled(const Geometry* g, double tileSize, std::size_t numThreads)
+    {
+        TiledPolygonizer polygonizer(tileSize);
+        polygonizer.setNumThreads(numThreads);
+        polygonizer.add(g);
+        std::vector<std::unique_ptr<Polygon>> result;
+        polygonizer.polygonize([&result](std::unique_ptr<Polygon> p) {
+            result.push_back(std::move(p));
+        });
+        return normalizedWKT(result);
+    }
+
+    // Pseudo-random segments and small squares, noded by a union
+    Geometry::Ptr
+    randomLinework(std::size_t nSegments, std::size_t nSquares)
+    {
+        seeded_random random(17);
+        auto next = [&random](unsigned int n) {
+            return static_cast<double>(random(n));
+        };
+        std::vector<Geometry*>* lines = new std::vector<Geometry*>();
+        for(std::size_t i = 0; i < nSegments; i++) {
+            std::vector<geos::geom::Coordinate>* pts = new std::vector<geos::geom::Coordinate>();
+            pts->emplace_back(next(100), next(100));
+            pts->emplace_back(next(100), next(100));
+            lines->push_back(factory->createLineString(
+                                 new geos::geom::CoordinateArraySequence(pts)));
+        }
+        for(std::size_t i = 0; i < nSquares; i++) {
+            double x = next(98);
+            double y = next(98);
+            std::vector<geos::geom::Coordinate>* pts = new std::vector<geos::geom::Coordinate>();
+            pts->emplace_back(x, y);
+            pts->emplace_back(x + 1.5, y);
+            pts->emplace_back(x + 1.5, y + 1.5);
+            pts->emplace_back(x, y + 1.5);
+            pts->emplace_back(x, y);
+            lines->push_back(factory->createLineString(
+                                 new geos::geom::CoordinateArraySequence(pts)));
+        }
+        std::unique_ptr<Geometry> mls(factory->createMultiLineString(lines));
+        return mls->Union();
+    }
+};
+
+typedef test_group<test_tiledpolygonizer_data> group;
+typedef group::object object;
+
+group test_tiledpolygonizer_group("geos::operation::polygonize::TiledPolygonizer");
+
+//
+// Test Cases
+//
+
+// Polygons inside a tile, across tiles, and a hole in a polygon
+// crossing tiles
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::unique_ptr<Geometry> g(reader.read(
+        "MULTILINESTRING((1 1, 4 1, 4 4, 1 4, 1 1),"
+        "(0 9, 0 0, 20 0, 20 9), (20 9, 0 9),"
+        "(12 2, 14 2, 14 4, 12 4, 12 2),"
+        "(0 9, 0 15, 20 15, 20 9))"));
+
+    std::vector<std::string> expected = polygonize(g.get());
+    ensure_equals(expected.size(), 4u);
+
+    ensure(polygonizeTiled(g.get(), 10, 1) == expected);
+    ensure(polygonizeTiled(g.get(), 3, 1) == expected);
+    ensure(polygonizeTiled(g.get(), 100, 1) == expected);
+}
+
+// Same polygons as Polygonizer, whatever the tile size and the
+// number of threads
+template<>
+template<>
+void object::test<2>
+()
+{
+    Geometry::Ptr g = randomLinework(60, 25);
+
+    std::vector<std::string> expected = polygonize(g.get());
+    ensure(expected.size() > 100);
+
+    for(double tileSize : {4.0, 15.0, 33.3, 200.0}) {
+        ensure(polygonizeTiled(g.get(), tileSize, 1) == expected);
+    }
+    ensure(polygonizeTiled(g.get(), 15.0, 3) == expected);
+}
+
+// Empty input gives no polygons
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::unique_ptr<Geometry> g(reader.read("LINESTRING EMPTY"));
+    ensure(polygonizeTiled(g.get(), 1, 1).empty());
+}
+
+} // namespace tut
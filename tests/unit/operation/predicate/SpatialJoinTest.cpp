@@ -0,0 +1,172 @@
+//
+// Test Suite for geos::operation::predicate::SpatialJoin class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/operation/predicate/SpatialJoin.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_spatialjoin_data {
+    typedef geos::geom::Geometry::Ptr GeomPtr;
+    typedef geos::operation::predicate::SpatialJoin SpatialJoin;
+
+    geos::geom::GeometryFactory::Ptr gf;
+    geos::io::WKTReader wktreader;
+    std::vector<GeomPtr> owned;
+    std::vector<const geos::geom::Geometry*> left;
+    std::vector<const geos::geom::Geometry*> right;
+
+    test_spatialjoin_data()
+        : gf(geos::geom::GeometryFactory::create()),
+          wktreader(gf.get())
+    {}
+
+    void
+    add(std::vector<const geos::geom::Geometry*>& geoms, const std::string& wkt)
+    {
+        owned.emplace_back(wktreader.read(wkt));
+        geoms.push_back(owned.back().get());
+    }
+
+    // Brute force version of SpatialJoin::join
+    std::vector<SpatialJoin::IndexPair>
+    nestedLoopJoin(SpatialJoin::Predicate pred, double distance)
+    {
+        std::vector<SpatialJoin::IndexPair> pairs;
+        for(std::size_t i = 0; i < left.size(); i++) {
+            for(std::size_t j = 0; j < right.size(); j++) {
+                bool match;
+                switch(pred) {
+                case SpatialJoin::INTERSECTS:
+                    match = left[i]->intersects(right[j]);
+                    break;
+                case SpatialJoin::CONTAINS:
+                    match = left[i]->contains(right[j]);
+                    break;
+                case SpatialJoin::COVERS:
+                    match = left[i]->covers(right[j]);
+                    break;
+                default:
+                    match = left[i]->isWithinDistance(right[j], distance);
+                }
+                if(match) {
+                    pairs.emplace_back(i, j);
+                }
+            }
+        }
+        return pairs;
+    }
+};
+
+typedef test_group<test_spatialjoin_data> group;
+typedef group::object object;
+
+group test_spatialjoin_group("geos::operation::predicate::SpatialJoin");
+
+//
+// Test Cases
+//
+
+// Simple cases of each predicate
+template<>
+template<>
+void object::test<1>
+()
+{
+    add(left, "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    add(left, "POLYGON ((20 0, 30 0, 30 10, 20 10, 20 0))");
+    add(right, "POINT (5 5)");
+    add(right, "POINT (10 5)");
+    add(right, "LINESTRING (12 5, 18 5)");
+    add(right, "POINT (25 5)");
+    add(right, "POINT EMPTY");
+
+    std::vector<SpatialJoin::IndexPair> pairs;
+
+    pairs = SpatialJoin::join(left, right, SpatialJoin::INTERSECTS);
+    ensure_equals(pairs.size(), 3u);
+    ensure(pairs[0] == SpatialJoin::IndexPair(0, 0));
+    ensure(pairs[1] == SpatialJoin::IndexPair(0, 1));
+    ensure(pairs[2] == SpatialJoin::IndexPair(1, 3));
+
+    pairs = SpatialJoin::join(left, right, SpatialJoin::CONTAINS);
+    ensure_equals(pairs.size(), 2u);
+    ensure(pairs[0] == SpatialJoin::IndexPair(0, 0));
+    ensure(pairs[1] == SpatialJoin::IndexPair(1, 3));
+
+    pairs = SpatialJoin::join(left, right, SpatialJoin::COVERS);
+    ensure_equals(pairs.size(), 3u);
+
+    pairs = SpatialJoin::join(left, right, SpatialJoin::WITHIN_DISTANCE, 2.0);
+    ensure_equals(pairs.size(), 5u);
+    ensure(pairs[2] == SpatialJoin::IndexPair(0, 2));
+    ensure(pairs[3] == SpatialJoin::IndexPair(1, 2));
+}
+
+// Several threads give the same pairs as a nested loop
+template<>
+template<>
+void object::test<2>
+()
+{
+    for(int i = 0; i < 30; i++) {
+        for(int j = 0; j < 30; j++) {
+            std::string wkt = "POINT (" + std::to_string(i) + " "
+                              + std::to_string(j) + ")";
+            add(right, wkt);
+        }
+    }
+    for(int i = 0; i < 200; i++) {
+        double x = (i * 37) % 30;
+        double y = (i * 11) % 30;
+        std::string wkt = "POLYGON ((" + std::to_string(x) + " " + std::to_string(y)
+                          + ", " + std::to_string(x + 3.5) + " " + std::to_string(y)
+                          + ", " + std::to_string(x) + " " + std::to_string(y + 2.5)
+                          + ", " + std::to_string(x) + " " + std::to_string(y) + "))";
+        add(left, wkt);
+    }
+
+    SpatialJoin op(left, right);
+    op.setNumThreads(4);
+    ensure(op.join(SpatialJoin::INTERSECTS) == nestedLoopJoin(SpatialJoin::INTERSECTS, 0));
+    ensure(op.join(SpatialJoin::CONTAINS) == nestedLoopJoin(SpatialJoin::CONTAINS, 0));
+    ensure(op.join(SpatialJoin::WITHIN_DISTANCE, 0.7) ==
+           nestedLoopJoin(SpatialJoin::WITHIN_DISTANCE, 0.7));
+}
+
+// Distances between lines and areas, including areas inside holes
+// and areas inside areas
+template<>
+template<>
+void object::test<3>
+()
+{
+    add(left, "POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (40 40, 60 40, 60 60, 40 60, 40 40))");
+    add(left, "LINESTRING (0 -10, 50 -5, 100 -10)");
+    add(right, "POLYGON ((10 10, 20 10, 20 20, 10 20, 10 10))");
+    add(right, "POLYGON ((45 45, 55 45, 55 55, 45 55, 45 45))");
+    add(right, "LINESTRING (44 50, 56 50)");
+    add(right, "LINESTRING (50 -3, 50 -1)");
+    add(right, "POLYGON ((-20 -20, 120 -20, 120 120, -20 120, -20 -20))");
+
+    SpatialJoin op(left, right);
+    for(double distance : { 0.0, 1.0, 3.0, 5.0 }) {
+        ensure(op.join(SpatialJoin::WITHIN_DISTANCE, distance) ==
+               nestedLoopJoin(SpatialJoin::WITHIN_DISTANCE, distance));
+    }
+}
+
+} // namespace tut
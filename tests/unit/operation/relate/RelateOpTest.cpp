@@ -0,0 +1,133 @@
+//
+// Test Suite for geos::operation::relate::RelateOp class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/operation/relate/RelateOp.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_relateop_data {
+
+    typedef geos::geom::Geometry Geometry;
+    typedef geos::geom::IntersectionMatrix IntersectionMatrix;
+    typedef geos::operation::relate::RelateOp RelateOp;
+
+    geos::geom::GeometryFactory::Ptr factory;
+    geos::io::WKTReader reader;
+
+    test_relateop_data()
+        :
+        factory(geos::geom::GeometryFactory::create()),
+        reader(factory.get())
+    {}
+
+    std::unique_ptr<Geometry>
+    read(const std::string& wkt)
+    {
+        return std::unique_ptr<Geometry>(reader.read(wkt));
+    }
+
+    // RelateOp::matches agrees with the whole matrix, for each pattern
+    void
+    checkMatches(const std::string& wktA, const std::string& wktB)
+    {
+        static const std::vector<std::string> patterns {
+            "T*T******", "T*****T**", "0********", "1*T***T**", "T*T***T**",
+            "FT*******", "F**T*****", "F***T****", "FF*FF****", "T*F**F***",
+            "212101212", "2********", "****0****", "*****F***"
+        };
+        std::unique_ptr<Geometry> a = read(wktA);
+        std::unique_ptr<Geometry> b = read(wktB);
+        std::unique_ptr<IntersectionMatrix> im(RelateOp::relate(a.get(), b.get()));
+        for(const std::string& pattern : patterns) {
+            ensure_equals(wktA + " / " + wktB + " " + pattern,
+                          RelateOp::matches(a.get(), b.get(), {pattern}),
+                          im->matches(pattern));
+        }
+    }
+};
+
+typedef test_group<test_relateop_data> group;
+typedef group::object object;
+
+group test_relateop_group("geos::operation::relate::RelateOp");
+
+//
+// Test Cases
+//
+
+// Same answers as the whole matrix, for all kinds of geometries
+template<>
+template<>
+void object::test<1>
+()
+{
+    const char* wkts[] = {
+        "POINT(1 1)",
+        "MULTIPOINT((0 0), (5 5))",
+        "LINESTRING(0 0, 10 10)",
+        "LINESTRING(0 10, 10 0)",
+        "LINESTRING(0 0, 10 0, 10 10, 0 0)",
+        "POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POLYGON((5 5, 15 5, 15 15, 5 15, 5 5))",
+        "POLYGON((10 0, 20 0, 20 10, 10 10, 10 0))",
+        "MULTIPOLYGON(((2 2, 3 2, 3 3, 2 3, 2 2)), ((30 30, 31 30, 31 31, 30 31, 30 30)))"
+    };
+    for(const char* a : wkts) {
+        for(const char* b : wkts) {
+            checkMatches(a, b);
+        }
+    }
+}
+
+// Any of several patterns may match
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::unique_ptr<Geometry> a = read("POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))");
+    std::unique_ptr<Geometry> b = read("POLYGON((10 0, 20 0, 20 10, 10 10, 10 0))");
+    std::unique_ptr<Geometry> c = read("POLYGON((5 5, 15 5, 15 15, 5 15, 5 5))");
+    std::vector<std::string> touches { "FT*******", "F**T*****", "F***T****" };
+
+    ensure(RelateOp::matches(a.get(), b.get(), touches));
+    ensure(!RelateOp::matches(a.get(), c.get(), touches));
+    ensure(a->touches(b.get()));
+    ensure(!a->touches(c.get()));
+    ensure(a->overlaps(c.get()));
+    ensure(!a->overlaps(b.get()));
+}
+
+// Patterns of the wrong length are rejected
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::unique_ptr<Geometry> a = read("POINT(1 1)");
+    std::unique_ptr<Geometry> b = read("POINT(2 2)");
+    try {
+        RelateOp::matches(a.get(), b.get(), {"T*T"});
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
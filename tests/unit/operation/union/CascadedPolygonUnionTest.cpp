@@ -121,7 +121,7 @@ void object::test<1>
 }
 
 void
-create_discs(geos::geom::GeometryFactory& gf, int num, double radius,
+create_discs(const geos::geom::GeometryFactory& gf, int num, double radius,
              std::vector<geos::geom::Polygon*>* g)
 {
     for(int i = 0; i < num; ++i) {
@@ -162,5 +162,27 @@ create_discs(geos::geom::GeometryFactory& gf, int num, double radius,
 //         std::for_each(g.begin(), g.end(), delete_geometry);
 //     }
 
+// Unioning on several threads gives the same result as on one
+template<>
+template<>
+void object::test<4>
+()
+{
+    using geos::operation::geounion::CascadedPolygonUnion;
+
+    std::vector<geos::geom::Polygon*> g;
+    create_discs(gf, 20, 0.7, &g);
+
+    std::unique_ptr<geos::geom::Geometry> serial(
+        CascadedPolygonUnion::Union(&g));
+    std::unique_ptr<geos::geom::Geometry> parallel(
+        CascadedPolygonUnion::Union(&g, 4));
+
+    ensure(parallel->isValid());
+    ensure(serial->equalsExact(parallel.get()));
+
+    for_each(g.begin(), g.end(), delete_geometry);
+}
+
 } // namespace tut
 
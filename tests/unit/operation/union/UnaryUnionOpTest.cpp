@@ -13,6 +13,7 @@
 #include <geos/io/WKTWriter.h>
 // std
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -204,5 +205,37 @@ void object::test<7>
     doTest(geoms, "GEOMETRYCOLLECTION EMPTY");
 }
 
+// Unioning the polygons on several threads gives the same result
+template<>
+template<>
+void object::test<8>
+()
+{
+    std::vector<Geom*> geoms;
+    for(int i = 0; i < 20; ++i) {
+        for(int j = 0; j < 20; ++j) {
+            std::ostringstream wkt;
+            wkt << "POLYGON ((" << i * 7 << " " << j * 7 << ", "
+                << i * 7 + 10 << " " << j * 7 << ", "
+                << i * 7 + 10 << " " << j * 7 + 10 << ", "
+                << i * 7 << " " << j * 7 + 10 << ", "
+                << i * 7 << " " << j * 7 << "))";
+            geoms.push_back(readWKT(wkt.str()).release());
+        }
+    }
+    geoms.push_back(readWKT("LINESTRING (-10 -10, 200 200)").release());
+
+    GeomPtr serial = UnaryUnionOp::Union(geoms);
+
+    UnaryUnionOp op(geoms);
+    op.setNumThreads(4);
+    GeomPtr parallel = op.Union();
+
+    bool ok = serial->equalsExact(parallel.get());
+    delAll(geoms);
+
+    ensure(ok);
+}
+
 } // namespace tut
 
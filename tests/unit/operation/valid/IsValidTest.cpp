@@ -14,6 +14,7 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/operation/valid/TopologyValidationError.h>
+#include <geos/io/WKTReader.h>
 #include <geos/constants.h> // for std::isnan
 // std
 #include <cmath>
@@ -36,8 +37,11 @@ struct test_isvalidop_data {
     geos::geom::PrecisionModel pm_;
     GeometryFactory::Ptr factory_;
 
+    geos::io::WKTReader reader_;
+
     test_isvalidop_data()
-        : pm_(1), factory_(GeometryFactory::create(&pm_, 0))
+        : pm_(1), factory_(GeometryFactory::create(&pm_, 0)),
+          reader_(factory_.get())
     {}
 };
 
@@ -76,5 +80,34 @@ void object::test<1>
     ensure_equals(valid, false);
 }
 
+// 2 - Nested shells among disjoint parts of a MultiPolygon
+template<>
+template<>
+void object::test<2>
+()
+{
+    // an island in a hole is valid
+    GeomPtr valid(reader_.read(
+        "MULTIPOLYGON(((0 0, 0 1, 1 1, 1 0, 0 0)),"
+        "((10 10, 10 20, 20 20, 20 10, 10 10),"
+        "(12 12, 18 12, 18 18, 12 18, 12 12)),"
+        "((14 14, 14 16, 16 16, 16 14, 14 14)),"
+        "((30 0, 30 1, 31 1, 31 0, 30 0)))"));
+    ensure(IsValidOp(valid.get()).isValid());
+
+    // an island in the shell is not
+    GeomPtr nested(reader_.read(
+        "MULTIPOLYGON(((0 0, 0 1, 1 1, 1 0, 0 0)),"
+        "((11 11, 11 12, 12 12, 12 11, 11 11)),"
+        "((10 10, 10 20, 20 20, 20 10, 10 10),"
+        "(14 14, 16 14, 16 16, 14 16, 14 14)),"
+        "((30 0, 30 1, 31 1, 31 0, 30 0)))"));
+    IsValidOp isValidOp(nested.get());
+    ensure(!isValidOp.isValid());
+    TopologyValidationError* err = isValidOp.getValidationError();
+    ensure_equals(err->getErrorType(),
+                  TopologyValidationError::eNestedShells);
+    ensure_equals(err->getCoordinate(), Coordinate(11, 11));
+}
 
 } // namespace tut
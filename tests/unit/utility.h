@@ -29,6 +29,7 @@
 #include <memory>
 #include <cstdlib>
 #include <cassert>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -223,6 +224,23 @@ struct wkb_hex_decoder {
     }
 };
 
+// Pseudo-random integers for test fixtures. std::minstd_rand is fully
+// specified by the standard, so a seed gives the same fixture everywhere.
+struct seeded_random {
+    explicit
+    seeded_random(unsigned int seed)
+        : engine(seed)
+    {}
+
+    // Integer in [0, n)
+    unsigned int
+    operator()(unsigned int n)
+    {
+        return static_cast<unsigned int>(engine() % n);
+    }
+
+    std::minstd_rand engine;
+};
 
 } // namespace tut
 